@@ -0,0 +1,32 @@
+// файл: Backoff.h
+// Экспоненциальная пауза между попытками подключения со случайной составляющей
+// Чистая функция: случайное число передается снаружи (на устройстве - esp_random())
+
+#ifndef BACKOFF_H
+#define BACKOFF_H
+
+#include <stdint.h>
+
+/**
+ * Пауза перед следующей попыткой
+ * - Основа удваивается с каждой неудачей подряд: minMs, 2*minMs, 4*minMs...
+ *   до предела maxMs
+ * - Половина основы случайная (джиттер): устройства, потерявшие брокер
+ *   одновременно, переподключаются вразнобой, а не одной волной
+ * @param failures - неудач подряд (1 - первая)
+ * @param minMs - первая пауза (мс)
+ * @param maxMs - предел паузы (мс)
+ * @param randomValue - случайное 32-битное число
+ * @return пауза в диапазоне [основа / 2, основа] (мс)
+ */
+inline uint32_t backoffDelay(uint32_t failures, uint32_t minMs, uint32_t maxMs, uint32_t randomValue) {
+    uint32_t delayMs = minMs;
+    for (uint32_t i = 1; i < failures && delayMs < maxMs; i++) {
+        delayMs = delayMs > maxMs / 2 ? maxMs : delayMs * 2;
+    }
+    if (delayMs > maxMs) delayMs = maxMs;
+
+    return delayMs / 2 + randomValue % (delayMs / 2 + 1);
+}
+
+#endif
@@ -315,6 +315,9 @@ void Display::drawErrorScreen(ErrorType error) {
     case ERR_FILL_TIMEOUT:
       errorText = "ТАЙМАУТ";
       break;
+    case ERR_RESERVOIR_EMPTY:
+      errorText = "БАК ПУСТ";
+      break;
     default:
       errorText = "НЕИЗВЕСТНО";
       break;
@@ -0,0 +1,53 @@
+// файл: EventQueue.cpp
+// Реализация очереди событий
+
+#include "EventQueue.h"
+
+EventQueue::EventQueue() {
+    queue = nullptr;
+    posted.store(0, std::memory_order_relaxed);
+    dropped.store(0, std::memory_order_relaxed);
+    maxLatency = 0;
+}
+
+void EventQueue::begin() {
+    if (queue) return;
+    queue = xQueueCreateStatic(EVENT_QUEUE_SIZE, sizeof(SystemEvent), queueStorage, &queueControl);
+}
+
+bool EventQueue::post(EventType type, int32_t arg) {
+    if (!queue) return false;
+
+    SystemEvent evt = { type, arg, (uint32_t)micros() };
+    if (xQueueSend(queue, &evt, 0) != pdTRUE) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    posted.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool IRAM_ATTR EventQueue::postFromISR(EventType type, int32_t arg) {
+    if (!queue) return false;
+
+    SystemEvent evt = { type, arg, (uint32_t)micros() };
+    BaseType_t woken = pdFALSE;
+    if (xQueueSendFromISR(queue, &evt, &woken) != pdTRUE) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    posted.fetch_add(1, std::memory_order_relaxed);
+
+    // Если ожидающая задача важнее прерванной - переключаемся на нее сразу
+    if (woken) portYIELD_FROM_ISR();
+    return true;
+}
+
+bool EventQueue::wait(SystemEvent& evt, uint32_t timeoutMs) {
+    if (!queue) return false;
+    if (xQueueReceive(queue, &evt, pdMS_TO_TICKS(timeoutMs)) != pdTRUE) return false;
+
+    uint32_t latency = (uint32_t)micros() - evt.timestamp;
+    if (latency > maxLatency) maxLatency = latency;
+    return true;
+}
@@ -0,0 +1,101 @@
+// файл: EventQueue.h
+// Очередь событий для конечного автомата
+// Кнопка (из прерывания), MQTT и веб кладут сюда типизированные события,
+// основной цикл просыпается сразу и передает их автомату
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include "config.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <atomic>
+
+// ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
+#define EVENT_QUEUE_SIZE 16            // Емкость очереди (событий)
+
+/**
+ * Типы событий
+ */
+enum EventType : uint8_t {
+    EVT_NONE,
+    EVT_BUTTON_EDGE,        // Изменение уровня на пине кнопки (из прерывания)
+    EVT_MQTT_COMMAND,       // Команда MQTT, arg - MQTT_COMMAND_ARG(код 1-8, номер для подтверждения)
+    EVT_FILL,               // Налить до веса, arg - целевой вес (г)
+    EVT_STOP,               // Экстренная остановка налива
+    EVT_CALIBRATE,          // Запуск калибровки
+    EVT_OTA_START,          // Началось обновление по воздуху
+    
+    // События сетевой задачи (своя очередь на ядре 0): Wi-Fi и его настройки
+    // меняет только она, параллельно с wifiManager.loop() их трогать нельзя
+    EVT_WIFI_RESET,         // Сброс Wi-Fi и MQTT, arg = 1 - и пароля веб-интерфейса
+    EVT_CONFIG_PORTAL       // Запустить точку доступа для настройки
+};
+
+// Аргумент EVT_MQTT_COMMAND: код команды в младшем байте, номер команды
+// для подтверждения (0 - подтверждение не нужно) - в старших
+#define MQTT_COMMAND_ARG(mode, tag) ((int32_t)(mode) | ((int32_t)(tag) << 8))
+#define MQTT_COMMAND_MODE(arg) ((int)((arg) & 0xFF))
+#define MQTT_COMMAND_TAG(arg) ((uint16_t)((arg) >> 8))
+
+/**
+ * Событие: тип, аргумент и момент публикации (для замера задержки)
+ */
+struct SystemEvent {
+    EventType type;
+    int32_t arg;
+    uint32_t timestamp;     // micros() в момент post()
+};
+
+/**
+ * Очередь фиксированной емкости поверх статической очереди FreeRTOS
+ * - Память выделена заранее внутри объекта, куча не используется
+ * - Безопасна для нескольких производителей (задачи и прерывания)
+ * - При переполнении событие отбрасывается и учитывается в getDropped()
+ */
+class EventQueue {
+private:
+    StaticQueue_t queueControl;
+    uint8_t queueStorage[EVENT_QUEUE_SIZE * sizeof(SystemEvent)];
+    QueueHandle_t queue;
+
+    // Статистика: счетчики увеличивают прерывание и задачи на обоих ядрах,
+    // поэтому инкремент атомарный (volatile ++ терял бы отсчеты)
+    std::atomic<uint32_t> posted;
+    std::atomic<uint32_t> dropped;
+    uint32_t maxLatency;     // Максимальное время от post() до извлечения (мкс)
+
+public:
+    EventQueue();
+
+    /** Создать очередь (до первого post()) */
+    void begin();
+
+    /**
+     * Положить событие (из задачи)
+     * @return false - очередь полна или не создана
+     */
+    bool post(EventType type, int32_t arg = 0);
+
+    /**
+     * Положить событие из обработчика прерывания
+     * @return false - очередь полна или не создана
+     */
+    bool postFromISR(EventType type, int32_t arg = 0);
+
+    /**
+     * Дождаться события
+     * @param evt - сюда записывается событие
+     * @param timeoutMs - сколько ждать (0 - только проверить)
+     * @return true - событие получено
+     */
+    bool wait(SystemEvent& evt, uint32_t timeoutMs);
+
+    // ==================== СТАТИСТИКА ====================
+    uint32_t getPosted() { return posted.load(std::memory_order_relaxed); }
+    uint32_t getDropped() { return dropped.load(std::memory_order_relaxed); }
+    uint32_t getMaxLatency() { return maxLatency; }
+    uint32_t getPending() { return queue ? uxQueueMessagesWaiting(queue) : 0; }
+};
+
+#endif
@@ -0,0 +1,86 @@
+// файл: FillCommand.h
+// Коды команд налива, цель налива по коду и проверка, можно ли наливать
+// Общие для MQTT, веба и событий правила на переданных значениях, без Arduino:
+// веб проверяет команду по снимку, автомат - на текущих данных
+
+#ifndef FILL_COMMAND_H
+#define FILL_COMMAND_H
+
+#include "config.h"
+
+// ==================== КОДЫ MQTT КОМАНД ====================
+// Эти числовые коды приходят из MQTT топика /devices/pump/filling
+// Каждое число соответствует определенной команде от Алисы
+
+#define CMD_ONE_CUP 1      // Команда 1: одна кружка / налить до минимума (500 мл)
+#define CMD_TWO_CUPS 2      // Команда 2: две кружки (500 мл)
+#define CMD_THREE_CUPS 3    // Команда 3: три кружки (750 мл)
+#define CMD_FOUR_CUPS 4     // Команда 4: четыре кружки (1000 мл)
+#define CMD_FIVE_CUPS 5     // Команда 5: пять кружек (1250 мл)
+#define CMD_SIX_CUPS 6      // Команда 6: шесть кружек (1500 мл)
+#define CMD_FULL 7          // Команда 7: полный чайник (1700 мл)
+#define CMD_STOP 8          // Команда 8: экстренная остановка налива
+
+// ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
+#define FILL_MIN_DELTA 10.0f           // Цель ближе к текущему весу - наливать нечего (г)
+
+/**
+ * Результат проверки налива
+ */
+enum FillCheck : uint8_t {
+    FILL_CHECK_OK,
+    FILL_CHECK_BUSY,          // Автомат не в IDLE
+    FILL_CHECK_NO_KETTLE,     // Весы не готовы или чайника нет
+    FILL_CHECK_REACHED        // Цель уже достигнута
+};
+
+/**
+ * Цель налива для кода команды
+ * @param mode - код команды CMD_ONE_CUP..CMD_FULL
+ * @param currentWeight - текущий вес (г)
+ * @param emptyWeight - вес пустого чайника (г)
+ * @return целевой вес (г), меньше 0 - код не является командой налива
+ */
+inline float commandFillTarget(int mode, float currentWeight, float emptyWeight) {
+    float currentWater = currentWeight - emptyWeight;
+    if (currentWater < 0) currentWater = 0;
+    
+    switch (mode) {
+        case CMD_ONE_CUP:
+            // Одна кружка, а если воды меньше минимума - до минимума
+            if (currentWater < MIN_WATER_LEVEL) return emptyWeight + MIN_WATER_LEVEL;
+            return currentWeight + CUP_VOLUME;
+        case CMD_TWO_CUPS:   return emptyWeight + 500.0f;
+        case CMD_THREE_CUPS: return emptyWeight + 750.0f;
+        case CMD_FOUR_CUPS:  return emptyWeight + 1000.0f;
+        case CMD_FIVE_CUPS:  return emptyWeight + 1250.0f;
+        case CMD_SIX_CUPS:   return emptyWeight + 1500.0f;
+        case CMD_FULL:       return emptyWeight + FULL_WATER_LEVEL;
+        default:             return -1.0f;
+    }
+}
+
+/**
+ * Проверить, можно ли начать налив
+ * @param targetWeight - целевой вес (г), ограничивается полным чайником
+ * @return FILL_CHECK_OK - налив до targetWeight можно начинать
+ */
+inline FillCheck checkFill(SystemState state, bool kettleReady, float currentWeight,
+                           float emptyWeight, float& targetWeight) {
+    // Налив начинается только из IDLE
+    if (state != ST_IDLE) return FILL_CHECK_BUSY;
+    
+    // Без чайника на готовых весах наливать некуда
+    if (!kettleReady) return FILL_CHECK_NO_KETTLE;
+    
+    // Не больше полного чайника
+    float maxWeight = emptyWeight + FULL_WATER_LEVEL;
+    if (targetWeight > maxWeight) targetWeight = maxWeight;
+    
+    // Есть ли смысл наливать
+    if (targetWeight <= currentWeight + FILL_MIN_DELTA) return FILL_CHECK_REACHED;
+    
+    return FILL_CHECK_OK;
+}
+
+#endif
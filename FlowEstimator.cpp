@@ -0,0 +1,114 @@
+// файл: FlowEstimator.cpp
+// Реализация потоковой оценки скорости потока воды
+
+#include "FlowEstimator.h"
+
+// ==================== КОНСТРУКТОР ====================
+FlowEstimator::FlowEstimator(unsigned long window) : windowMs(window) {
+    reset();
+}
+
+void FlowEstimator::reset() {
+    head = 0;
+    count = 0;
+    originMs = 0;
+    sumT = sumW = sumTT = sumTW = sumWW = 0;
+    rate = 0;
+    rateVariance = 0;
+    fittedWeight = 0;
+    valid = false;
+}
+
+// ==================== ОБНОВЛЕНИЕ СУММ ====================
+void FlowEstimator::accumulate(uint32_t timeMs, float weight, double sign) {
+    double t = (int32_t)(timeMs - originMs) / 1000.0;
+    double w = weight;
+    sumT += sign * t;
+    sumW += sign * w;
+    sumTT += sign * t * t;
+    sumTW += sign * t * w;
+    sumWW += sign * w * w;
+}
+
+void FlowEstimator::removeOldest() {
+    accumulate(times[head], weights[head], -1.0);
+    head = (head + 1) % FLOW_MAX_SAMPLES;
+    count--;
+}
+
+void FlowEstimator::rebase(uint32_t newOriginMs) {
+    // Редкая операция O(N): переносим начало отсчета и пересобираем суммы,
+    // заодно сбрасывая накопленную ошибку округления
+    originMs = newOriginMs;
+    sumT = sumW = sumTT = sumTW = sumWW = 0;
+    for (int i = 0; i < count; i++) {
+        int idx = (head + i) % FLOW_MAX_SAMPLES;
+        accumulate(times[idx], weights[idx], 1.0);
+    }
+}
+
+// ==================== ДОБАВЛЕНИЕ ОТСЧЕТА ====================
+void FlowEstimator::addSample(uint32_t timeMs, float weight) {
+    if (count == 0) {
+        originMs = timeMs;
+    } else if (timeMs - originMs > FLOW_REBASE_TIME) {
+        rebase(times[head]);
+    }
+
+    if (count == FLOW_MAX_SAMPLES) {
+        removeOldest();
+    }
+
+    int idx = (head + count) % FLOW_MAX_SAMPLES;
+    times[idx] = timeMs;
+    weights[idx] = weight;
+    count++;
+    accumulate(timeMs, weight, 1.0);
+
+    while (count > 1 && timeMs - times[head] > windowMs) {
+        removeOldest();
+    }
+
+    recompute();
+}
+
+// ==================== РАСЧЕТ РЕГРЕССИИ ====================
+void FlowEstimator::recompute() {
+    if (count < FLOW_MIN_SAMPLES) {
+        valid = false;
+        return;
+    }
+
+    double n = count;
+    double sxx = sumTT - sumT * sumT / n;
+    double sxy = sumTW - sumT * sumW / n;
+    double syy = sumWW - sumW * sumW / n;
+
+    if (sxx <= 1e-9) {
+        valid = false;
+        return;
+    }
+
+    double slope = sxy / sxx;
+    double sse = syy - slope * sxy;
+    if (sse < 0) sse = 0;
+
+    double lastT = (int32_t)(times[(head + count - 1) % FLOW_MAX_SAMPLES] - originMs) / 1000.0;
+    double intercept = (sumW - slope * sumT) / n;
+
+    rate = (float)slope;
+    rateVariance = (float)(sse / (n - 2) / sxx);
+    fittedWeight = (float)(intercept + slope * lastT);
+    valid = true;
+}
+
+// ==================== ПРОГНОЗ ====================
+float FlowEstimator::getTimeToTarget(float target) {
+    if (!valid) return -1;
+
+    float remaining = target - fittedWeight;
+    if (remaining <= 0) return 0;
+    if (rate <= 0.01f) return -1;
+
+    return remaining / rate;
+}
@@ -0,0 +1,80 @@
+// файл: FlowEstimator.h
+// Оценка скорости потока воды (г/с) линейной регрессией по скользящему окну времени
+
+#ifndef FLOW_ESTIMATOR_H
+#define FLOW_ESTIMATOR_H
+
+#include <Arduino.h>
+
+// ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
+#define FLOW_WINDOW_MS 1500          // Окно регрессии по умолчанию (мс)
+#define FLOW_MAX_SAMPLES 128         // Емкость окна (80 SPS * 1.5 с = 120 отсчетов)
+#define FLOW_MIN_SAMPLES 8           // Минимум отсчетов для достоверной оценки
+#define FLOW_REBASE_TIME 600000UL    // Период переноса начала отсчета времени (мс)
+
+/**
+ * Потоковая оценка наклона веса по времени методом наименьших квадратов
+ * - Отсчеты хранятся в кольцевом буфере фиксированного размера (без кучи)
+ * - Суммы регрессии обновляются при добавлении и удалении отсчета,
+ *   поэтому каждый отсчет обрабатывается за O(1)
+ * - Из окна удаляются отсчеты старше windowMs и вытесненные по емкости
+ * - Результаты пересчитываются в addSample(), геттеры только читают поля
+ */
+class FlowEstimator {
+private:
+    // ==================== ОКНО ОТСЧЕТОВ ====================
+    uint32_t times[FLOW_MAX_SAMPLES];   // Время отсчета (мс)
+    float weights[FLOW_MAX_SAMPLES];    // Вес (г)
+    int head;                           // Позиция самого старого отсчета
+    int count;                          // Количество отсчетов в окне
+    unsigned long windowMs;             // Длина окна по времени
+
+    // ==================== СУММЫ РЕГРЕССИИ ====================
+    // Время берется в секундах относительно originMs, чтобы не терять точность
+    uint32_t originMs;
+    double sumT, sumW, sumTT, sumTW, sumWW;
+
+    // ==================== РЕЗУЛЬТАТЫ ====================
+    float rate;          // Наклон (г/с)
+    float rateVariance;  // Дисперсия оценки наклона ((г/с)^2)
+    float fittedWeight;  // Вес по регрессии в момент последнего отсчета
+    bool valid;          // Достаточно ли данных для оценки
+
+    void accumulate(uint32_t timeMs, float weight, double sign);
+    void removeOldest();
+    void rebase(uint32_t newOriginMs);
+    void recompute();
+
+public:
+    // ==================== КОНСТРУКТОР ====================
+    FlowEstimator(unsigned long windowMs = FLOW_WINDOW_MS);
+
+    // ==================== ОСНОВНЫЕ МЕТОДЫ ====================
+    /**
+     * Добавить отсчет веса
+     * @param timeMs - время отсчета (millis())
+     * @param weight - отфильтрованный вес (г)
+     */
+    void addSample(uint32_t timeMs, float weight);
+    void reset();
+    void setWindow(unsigned long ms) { windowMs = ms; }
+    unsigned long getWindow() { return windowMs; }
+
+    // ==================== РЕЗУЛЬТАТЫ ====================
+    /** @return true, если в окне достаточно отсчетов для оценки */
+    bool isValid() { return valid; }
+
+    /** @return скорость изменения веса (г/с), положительная при наливе */
+    float getRate() { return valid ? rate : 0; }
+
+    /** @return дисперсия оценки скорости ((г/с)^2) */
+    float getRateVariance() { return valid ? rateVariance : 0; }
+
+    /**
+     * Прогноз времени до достижения веса target при текущей скорости
+     * @return секунды до цели, 0 если цель уже достигнута, -1 если поток отсутствует
+     */
+    float getTimeToTarget(float target);
+};
+
+#endif
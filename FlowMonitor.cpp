@@ -0,0 +1,59 @@
+// файл: FlowMonitor.cpp
+// Реализация детектора отсутствия потока и опустевшего бака
+
+#include "FlowMonitor.h"
+
+FlowMonitor::FlowMonitor() {
+    armed = false;
+    armTime = 0;
+    lowFlowSince = 0;
+    decaySince = 0;
+    peakRate = 0;
+}
+
+void FlowMonitor::arm() {
+    armed = true;
+    armTime = millis();
+    lowFlowSince = 0;
+    decaySince = 0;
+    peakRate = 0;
+}
+
+unsigned long FlowMonitor::getArmedTime() {
+    return armed ? millis() - armTime : 0;
+}
+
+FlowCheck FlowMonitor::update(FlowEstimator& flow) {
+    if (!armed || !flow.isValid()) return FLOW_CHECK_OK;
+
+    unsigned long now = millis();
+    if ((long)(now - armTime) < (long)NO_FLOW_PRIME_TIME) return FLOW_CHECK_OK;
+
+    float rate = flow.getRate();
+    float margin = NO_FLOW_CONFIDENCE * sqrtf(flow.getRateVariance());
+
+    // Пик учитываем только по уверенной оценке, чтобы шум его не завышал
+    if (rate - margin > peakRate) peakRate = rate - margin;
+
+    // ===== ПОТОКА НЕТ: даже с запасом на погрешность скорость около нуля =====
+    if (rate + margin < NO_FLOW_MIN_RATE) {
+        if (lowFlowSince == 0) lowFlowSince = now;
+        if ((long)(now - lowFlowSince) >= (long)NO_FLOW_CONFIRM_TIME) {
+            return peakRate >= FLOW_ESTABLISHED_RATE ? FLOW_CHECK_DRY : FLOW_CHECK_NO_FLOW;
+        }
+    } else {
+        lowFlowSince = 0;
+    }
+
+    // ===== БАК ПУСТЕЕТ: поток был, но уверенно упал относительно пика =====
+    if (peakRate >= FLOW_ESTABLISHED_RATE && rate + margin < peakRate * DRY_FLOW_RATIO) {
+        if (decaySince == 0) decaySince = now;
+        if ((long)(now - decaySince) >= (long)DRY_CONFIRM_TIME) {
+            return FLOW_CHECK_DRY;
+        }
+    } else {
+        decaySince = 0;
+    }
+
+    return FLOW_CHECK_OK;
+}
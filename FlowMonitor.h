@@ -0,0 +1,58 @@
+// файл: FlowMonitor.h
+// Быстрое обнаружение отсутствия потока и опустевшего бака по скорости изменения веса
+
+#ifndef FLOW_MONITOR_H
+#define FLOW_MONITOR_H
+
+#include "config.h"
+#include "FlowEstimator.h"
+
+/**
+ * Результат проверки потока
+ */
+enum FlowCheck {
+    FLOW_CHECK_OK,          // Поток в норме (или еще рано судить)
+    FLOW_CHECK_NO_FLOW,     // Вода так и не пошла
+    FLOW_CHECK_DRY          // Поток был, но упал почти до нуля - бак опустел
+};
+
+/**
+ * Детектор по производной веса (скорости потока из FlowEstimator)
+ * - Включается, когда серво над чайником и помпа включена
+ * - Нет потока: верхняя граница доверительного интервала скорости
+ *   ниже NO_FLOW_MIN_RATE дольше NO_FLOW_CONFIRM_TIME
+ * - Бак пустеет: скорость упала ниже DRY_FLOW_RATIO от пиковой
+ *   дольше DRY_CONFIRM_TIME
+ * Пороги - в config.h рядом с параметрами налива
+ */
+class FlowMonitor {
+private:
+    bool armed;
+    unsigned long armTime;          // Когда помпа начала качать
+    unsigned long lowFlowSince;     // Начало текущего участка без потока (0 - нет)
+    unsigned long decaySince;       // Начало текущего участка падения потока (0 - нет)
+    float peakRate;                 // Максимальная уверенная скорость за налив
+
+public:
+    FlowMonitor();
+
+    /** Начать наблюдение (помпа включена, серво на месте) */
+    void arm();
+
+    /** Прекратить наблюдение */
+    void disarm() { armed = false; }
+    bool isArmed() { return armed; }
+
+    /**
+     * Проверить поток (вызывать на каждом обновлении налива)
+     * @param flow - оценка скорости потока
+     * @return результат проверки
+     */
+    FlowCheck update(FlowEstimator& flow);
+
+    /** @return время от включения помпы (мс) - для журнала срабатываний */
+    unsigned long getArmedTime();
+    float getPeakRate() { return peakRate; }
+};
+
+#endif
@@ -0,0 +1,130 @@
+// файл: JsonWriter.cpp
+// Реализация потоковой записи JSON
+
+#include "JsonWriter.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+
+JsonWriter::JsonWriter(char* buf, size_t bufSize, FlushFunction flush, void* context) {
+    buffer = buf;
+    size = bufSize;
+    used = 0;
+    total = 0;
+    overflow = bufSize < 2;
+    flushFn = flush;
+    flushContext = context;
+    depth = 0;
+    hasItems = 0;
+}
+
+// ==================== ЗАПИСЬ СИМВОЛОВ ====================
+void JsonWriter::write(char c) {
+    if (overflow) return;
+
+    // Без функции сброса последний байт оставляем под нулевой символ
+    if (used + 1 >= size) {
+        if (!flushFn) {
+            overflow = true;
+            return;
+        }
+        flushFn(flushContext, buffer, used);
+        used = 0;
+    }
+    buffer[used++] = c;
+    total++;
+}
+
+void JsonWriter::write(const char* text) {
+    while (*text) write(*text++);
+}
+
+void JsonWriter::writeString(const char* text) {
+    if (!text) {
+        write("null");
+        return;
+    }
+
+    write('"');
+    for (; *text; text++) {
+        char c = *text;
+        switch (c) {
+            case '"': write("\\\""); break;
+            case '\\': write("\\\\"); break;
+            case '\n': write("\\n"); break;
+            case '\r': write("\\r"); break;
+            case '\t': write("\\t"); break;
+            default:
+                if ((uint8_t)c < 0x20) {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", (uint8_t)c);
+                    write(escaped);
+                } else {
+                    write(c);  // UTF-8 пишем как есть
+                }
+        }
+    }
+    write('"');
+}
+
+void JsonWriter::writeNumber(const char* format, ...) {
+    char text[24];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    write(text);
+}
+
+void JsonWriter::writeFloat(double value, uint8_t decimals) {
+    if (isnan(value) || isinf(value)) {
+        write("null");
+        return;
+    }
+    writeNumber("%.*f", (int)decimals, value);
+}
+
+// ==================== СТРУКТУРА ====================
+void JsonWriter::separator() {
+    if (depth == 0) return;
+    uint16_t bit = 1u << (depth - 1);
+    if (hasItems & bit) write(',');
+    hasItems |= bit;
+}
+
+void JsonWriter::key(const char* name) {
+    separator();
+    writeString(name);
+    write(':');
+}
+
+void JsonWriter::open(char bracket) {
+    write(bracket);
+    if (depth >= JSON_WRITER_DEPTH) {
+        overflow = true;
+        return;
+    }
+    depth++;
+    hasItems &= ~(1u << (depth - 1));
+}
+
+void JsonWriter::close(char bracket) {
+    if (depth > 0) depth--;
+    write(bracket);
+}
+
+size_t JsonWriter::finish() {
+    if (overflow) {
+        if (size > 0) buffer[0] = '\0';
+        return 0;
+    }
+
+    if (flushFn) {
+        if (used > 0) flushFn(flushContext, buffer, used);
+        used = 0;
+    } else {
+        buffer[used] = '\0';
+    }
+    return total;
+}
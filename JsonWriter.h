@@ -0,0 +1,102 @@
+// файл: JsonWriter.h
+// Потоковая запись JSON в фиксированный буфер без DOM и без String
+// Используется для /api/status, событий /api/events и телеметрии MQTT
+
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
+#define JSON_WRITER_DEPTH 16           // Максимальная вложенность объектов и массивов
+
+/**
+ * Потоковый писатель JSON
+ * - Пишет текст сразу в буфер вызывающего: нет документа в памяти,
+ *   нет промежуточной строки и обращений к куче
+ * - С функцией сброса буфер работает как окно: заполненная часть
+ *   отдается наружу (например, в чанк HTTP ответа), и запись продолжается,
+ *   поэтому размер ответа не ограничен размером буфера
+ * - Без функции сброса то, что не поместилось, отбрасывается и
+ *   выставляется overflowed() - такой результат нельзя отправлять
+ * - Запятые между элементами расставляются автоматически
+ * - Ключи и строки экранируются; NaN и бесконечность пишутся как null
+ */
+class JsonWriter {
+public:
+    /**
+     * Функция сброса заполненной части буфера
+     * @param context - значение, переданное в конструктор
+     */
+    typedef void (*FlushFunction)(void* context, const char* data, size_t length);
+
+private:
+    char* buffer;
+    size_t size;
+    size_t used;            // Байт в буфере
+    size_t total;           // Всего записано (с учетом сброшенного)
+    bool overflow;
+    FlushFunction flushFn;
+    void* flushContext;
+
+    uint8_t depth;
+    uint16_t hasItems;      // Бит на уровень: в контейнере уже есть элементы
+
+    void write(char c);
+    void write(const char* text);
+    void writeString(const char* text);
+    void separator();       // Запятая перед элементом, если он не первый
+    void key(const char* name);
+    void open(char bracket);
+    void close(char bracket);
+    void writeNumber(const char* format, ...);
+
+public:
+    JsonWriter(char* buf, size_t bufSize, FlushFunction flush = nullptr, void* context = nullptr);
+
+    // ==================== КОНТЕЙНЕРЫ ====================
+    void beginObject() { separator(); open('{'); }
+    void beginObject(const char* name) { key(name); open('{'); }
+    void endObject() { close('}'); }
+    void beginArray() { separator(); open('['); }
+    void beginArray(const char* name) { key(name); open('['); }
+    void endArray() { close(']'); }
+
+    // ==================== ПОЛЯ ОБЪЕКТА ====================
+    void field(const char* name, const char* value) { key(name); writeString(value); }
+    void field(const char* name, bool value) { key(name); write(value ? "true" : "false"); }
+    void field(const char* name, int value) { key(name); writeNumber("%d", value); }
+    void field(const char* name, unsigned int value) { key(name); writeNumber("%u", value); }
+    void field(const char* name, long value) { key(name); writeNumber("%ld", value); }
+    void field(const char* name, unsigned long value) { key(name); writeNumber("%lu", value); }
+    void field(const char* name, unsigned long long value) { key(name); writeNumber("%llu", value); }
+    void field(const char* name, double value, uint8_t decimals = 2) { key(name); writeFloat(value, decimals); }
+    void nullField(const char* name) { key(name); write("null"); }
+
+    // ==================== ЭЛЕМЕНТЫ МАССИВА ====================
+    void value(const char* v) { separator(); writeString(v); }
+    void value(bool v) { separator(); write(v ? "true" : "false"); }
+    void value(int v) { separator(); writeNumber("%d", v); }
+    void value(unsigned int v) { separator(); writeNumber("%u", v); }
+    void value(long v) { separator(); writeNumber("%ld", v); }
+    void value(unsigned long v) { separator(); writeNumber("%lu", v); }
+    void value(double v, uint8_t decimals = 2) { separator(); writeFloat(v, decimals); }
+
+    /** Записать число с фиксированным числом знаков после запятой */
+    void writeFloat(double value, uint8_t decimals);
+
+    /**
+     * Завершить запись: сбросить остаток буфера (если есть функция сброса)
+     * и дописать нулевой символ (если нет)
+     * @return общая длина JSON, 0 - переполнение
+     */
+    size_t finish();
+
+    // ==================== СОСТОЯНИЕ ====================
+    bool overflowed() const { return overflow; }
+    size_t length() const { return total; }
+    const char* c_str() const { return buffer; }
+};
+
+#endif
@@ -0,0 +1,109 @@
+// файл: LevelQuantizer.h
+// Квантование непрерывной величины в уровни с гистерезисом и минимальным временем удержания
+// Используется для уровня воды, публикуемого в MQTT (0/1/2)
+
+#ifndef LEVEL_QUANTIZER_H
+#define LEVEL_QUANTIZER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * Квантователь на N уровней по N-1 порогам
+ * - Уровень i: thresholds[i-1] <= value < thresholds[i] (без гистерезиса)
+ * - Гистерезис: чтобы подняться выше порога, значение должно превысить
+ *   его на hysteresis, чтобы опуститься ниже - уйти на hysteresis под него;
+ *   шум внутри полосы порог +- hysteresis уровень не меняет
+ * - Удержание: новый уровень принимается, только если он продержался
+ *   dwellMs; кратковременные выбросы считаются подавленными
+ * - Первое значение после reset() принимается сразу
+ */
+template <size_t N>
+class LevelQuantizer {
+    static_assert(N >= 2, "LevelQuantizer: нужно хотя бы два уровня");
+
+private:
+    float thresholds[N - 1];   // Пороги по возрастанию
+    float hysteresis;
+    uint32_t dwellMs;
+
+    int level;                 // Принятый уровень, -1 - еще не было значений
+    int pending;               // Кандидат на смену уровня
+    uint32_t pendingSince;     // Когда кандидат появился (millis)
+
+    uint32_t changes;          // Принятых смен уровня
+    uint32_t suppressed;       // Кандидатов, не продержавшихся dwellMs
+
+    // Уровень для значения с учетом гистерезиса относительно текущего уровня
+    int target(float value) const {
+        int result = level;
+        while (result < (int)N - 1 && value >= thresholds[result] + hysteresis) result++;
+        while (result > 0 && value < thresholds[result - 1] - hysteresis) result--;
+        return result;
+    }
+
+    // Уровень для значения без гистерезиса
+    int raw(float value) const {
+        int result = 0;
+        while (result < (int)N - 1 && value >= thresholds[result]) result++;
+        return result;
+    }
+
+public:
+    LevelQuantizer(const float (&levelThresholds)[N - 1], float hysteresisBand, uint32_t dwell)
+        : hysteresis(hysteresisBand), dwellMs(dwell), changes(0), suppressed(0) {
+        for (size_t i = 0; i < N - 1; i++) thresholds[i] = levelThresholds[i];
+        reset();
+    }
+
+    /** Забыть текущий уровень: следующее значение будет принято сразу */
+    void reset() {
+        level = -1;
+        pending = -1;
+        pendingSince = 0;
+    }
+
+    /**
+     * Обработать новое значение
+     * @param value - измеренная величина
+     * @param now - текущее время (мс)
+     * @return принятый уровень
+     */
+    int update(float value, uint32_t now) {
+        if (level < 0) {
+            level = raw(value);
+            pending = level;
+            return level;
+        }
+
+        int candidate = target(value);
+
+        if (candidate == level) {
+            // Кандидат вернулся к текущему уровню до конца удержания
+            if (pending != level) {
+                suppressed++;
+                pending = level;
+            }
+            return level;
+        }
+
+        if (candidate != pending) {
+            if (pending != level) suppressed++;
+            pending = candidate;
+            pendingSince = now;
+        }
+
+        if (now - pendingSince >= dwellMs) {
+            level = pending;
+            changes++;
+        }
+        return level;
+    }
+
+    // ==================== СТАТИСТИКА ====================
+    int getLevel() const { return level; }
+    uint32_t getChanges() const { return changes; }
+    uint32_t getSuppressed() const { return suppressed; }
+};
+
+#endif
@@ -2,45 +2,91 @@
 // Реализация методов класса MQTTManager с исправлением утечек памяти
 
 #include "MQTTManager.h"
-
-// ==================== КОНСТАНТЫ ====================
-#define MQTT_SERVER "mqtt.dealgate.ru"
-#define MQTT_PORT 1883
-#define MQTT_RECONNECT_DELAY 5000
-#define MQTT_PUBLISH_INTERVAL 5000
+#include "debug.h"
 
 static MQTTManager* instance = nullptr;
 
+// Пороги уровней воды: 0 - пусто, 1 - низкий, 2 - нормальный
+static const float WATER_LEVEL_THRESHOLDS[2] = { WATER_LEVEL_EMPTY, WATER_LEVEL_LOW };
+
 // ==================== КОНСТРУКТОР ====================
 MQTTManager::MQTTManager(Scale& s, StateMachine& sm, WiFiManager& wm) 
     : mqttClient(wifiClient), 
       scale(s), 
       stateMachine(sm), 
       wifiManager(wm),
-      lastReconnectAttempt(0),
+      connState(MQTT_CONN_DISCONNECTED),
+      connectorTask(nullptr),
+      lastFailCode(0),
+      messagesReceived(0),
+      receiveHeapOps(0),
+      lastReceiveTime(0),
+      maxReceiveTime(0),
+      pendingHead(0),
+      recentIdsDirty(false),
+      nextCommandTag(1),
+      queuedAckCount(0),
+      commandsDuplicate(0),
+      acksSent(0),
+      outboxDrainRate(0),
+      telemetryCount(0),
+      telemetryVersion(0),
+      lastTelemetryTime(0),
+      telemetrySent(0),
+      lastTelemetrySize(0),
       lastPublishTime(0),
       lastHeartbeatTime(0),
       lastConnectionCheckTime(0),
       messagesSent(0),
       messagesFailed(0),
-      reconnectAttempts(0),
+      waterLevel(WATER_LEVEL_THRESHOLDS, WATER_LEVEL_HYSTERESIS, WATER_LEVEL_DWELL),
+      waterStatePublishes(0),
       lastWaterState(-1),
       lastKettlePresent(false),
       lastMqttConnected(false),
       commandCallback(nullptr)
 {
     instance = this;
-    clientId = "smartpump";
+    memset(pendingCommands, 0, sizeof(pendingCommands));
+    buildTopics();
+}
+
+// ==================== ТОПИКИ ====================
+void MQTTManager::buildTopics() {
+    char macHex[MQTT_MAC_HEX_SIZE];
+    mqttMacHex(ESP.getEfuseMac(), macHex);
+    
+    // Client ID уникален всегда, имя в топиках - только по MQTT_DEVICE_NAME_PER_MAC
+    mqttDeviceName(clientId, sizeof(clientId), MQTT_CLIENT_PREFIX, macHex);
+#ifdef MQTT_DEVICE_NAME_PER_MAC
+    mqttDeviceName(deviceName, sizeof(deviceName), MQTT_DEVICE_NAME, macHex);
+#else
+    mqttDeviceName(deviceName, sizeof(deviceName), MQTT_DEVICE_NAME, nullptr);
+#endif
     
-    // Инициализируем топики
-    waterLevelTopic = "/devices/pump/water_level";
-    kettleTopic = "/devices/pump/kettle";
-    fillingTopic = "/devices/pump/filling";
+    buildTopic(waterLevelTopic, "water_level");
+    buildTopic(kettleTopic, "kettle");
+    buildTopic(fillingTopic, "filling");
+    buildTopic(telemetryTopic, "telemetry");
+    buildTopic(ackTopic, "ack");
+    
+    // Таблица входящих топиков: длины считаются один раз здесь, а не на каждое сообщение
+    routes[0] = { fillingTopic, strlen(fillingTopic), &MQTTManager::handleFillingCommand };
+}
+
+void MQTTManager::buildTopic(char* buffer, const char* leaf) {
+    if (!mqttTopic(buffer, MQTT_TOPIC_MAX, MQTT_TOPIC_ROOT, deviceName, leaf)) {
+        LOG_ERROR("MQTT: топик не помещается в буфер, проверьте MQTT_TOPIC_ROOT");
+    }
 }
 
 // ==================== ДЕСТРУКТОР ====================
 MQTTManager::~MQTTManager() {
     // Отключаемся от MQTT
+    if (connectorTask) {
+        vTaskDelete(connectorTask);
+        connectorTask = nullptr;
+    }
     if (mqttClient.connected()) {
         mqttClient.disconnect();
     }
@@ -62,10 +108,6 @@ MQTTManager::~MQTTManager() {
 // ==================== ОЧИСТКА СТРОК ====================
 void MQTTManager::clearStrings() {
     // Очищаем все строки (освобождаем память)
-    clientId = String();
-    waterLevelTopic = String();
-    kettleTopic = String();
-    fillingTopic = String();
     mqttUser = String();
     mqttPass = String();
 }
@@ -74,13 +116,29 @@ void MQTTManager::clearStrings() {
 void MQTTManager::begin() {
     mqttClient.setServer(MQTT_SERVER, MQTT_PORT);
     mqttClient.setCallback(mqttCallback);
-    mqttClient.setBufferSize(512);
+    mqttClient.setBufferSize(MQTT_BUFFER_SIZE);
+    mqttClient.setSocketTimeout(MQTT_CONNACK_TIMEOUT);
+    
+    if (!outbox.begin()) {
+        Serial.println("⚠ Очередь MQTT во флеше недоступна - без связи состояния теряются");
+    }
+    loadRecentIds();
+    
+    // Блокирующие DNS, TCP connect и ожидание CONNACK выполняет отдельная
+    // задача: сетевой цикл (веб, OTA) не стоит, пока брокер недоступен
+    if (!connectorTask) {
+        xTaskCreatePinnedToCore(connectorTaskEntry, "mqtt_conn", MQTT_CONNECTOR_STACK, this,
+                                NETWORK_TASK_PRIORITY, &connectorTask, NETWORK_TASK_CORE);
+    }
     
     Serial.println("=== MQTT Конфигурация ===");
-    Serial.printf("Client ID: %s\n", clientId.c_str());
+    Serial.printf("Client ID: %s\n", clientId);
     Serial.printf("Сервер: %s:%d\n", MQTT_SERVER, MQTT_PORT);
-    Serial.printf("Топик уровня воды: %s\n", waterLevelTopic.c_str());
-    Serial.printf("Топик наличия чайника: %s\n", kettleTopic.c_str());
+    Serial.printf("Топик уровня воды: %s\n", waterLevelTopic);
+    Serial.printf("Топик наличия чайника: %s\n", kettleTopic);
+    Serial.printf("Топик команд: %s\n", fillingTopic);
+    Serial.printf("Топик телеметрии: %s\n", telemetryTopic);
+    Serial.printf("Топик подтверждений: %s\n", ackTopic);
     Serial.println("Уровни воды:");
     Serial.println("  0 = Пустой (< 500 мл)");
     Serial.println("  1 = Низкий (500-1000 мл)");
@@ -91,7 +149,8 @@ void MQTTManager::begin() {
         Serial.printf("  Пользователь: %s\n", mqttUser.c_str());
         Serial.printf("  Пароль: %s\n", "********");
         
-        connect();
+        // Первая попытка - как только появится Wi-Fi (в loop())
+        reconnectState.retryNow(millis());
     } else {
         Serial.println("⚠ Учетные данные MQTT не найдены в Preferences");
         Serial.println("  Используйте команду для установки:");
@@ -107,7 +166,7 @@ void MQTTManager::loop() {
     
     if (now - lastConnectionCheckTime > 1000) {
         lastConnectionCheckTime = now;
-        bool currentlyConnected = mqttClient.connected();
+        bool currentlyConnected = isConnected();
         
         if (currentlyConnected != lastMqttConnected) {
             lastMqttConnected = currentlyConnected;
@@ -119,184 +178,422 @@ void MQTTManager::loop() {
         }
     }
     
-    if (!mqttClient.connected()) {
-        if (now - lastReconnectAttempt > MQTT_RECONNECT_DELAY) {
-            lastReconnectAttempt = now;
-            reconnectAttempts++;
-            Serial.printf("Попытка переподключения MQTT #%lu...\n", reconnectAttempts);
-            connect();
-        }
-    } else {
-        mqttClient.loop();
-        
-        if (now - lastPublishTime > MQTT_PUBLISH_INTERVAL) {
-            lastPublishTime = now;
-            publishWaterState();
-            publishKettleState();
-        }
+    switch (connState.load()) {
+        case MQTT_CONN_DISCONNECTED:
+            if (!reconnectState.isDue(now)) break;
+            
+            if (!wifiManager.hasMqttCredentials()) {
+                reconnectState.blocked(MQTT_FAIL_NO_CREDENTIALS, now);
+                break;
+            }
+            
+            reconnectState.beginAttempt(now);
+            Serial.printf("Попытка подключения MQTT #%lu...\n", reconnectState.getAttempts());
+            
+            // Клиент переходит во владение задачи подключения
+            connState = MQTT_CONN_CONNECTING;
+            xTaskNotifyGive(connectorTask);
+            break;
+            
+        case MQTT_CONN_CONNECTING:
+            // Клиент занят задачей подключения - не трогаем
+            break;
+            
+        case MQTT_CONN_ESTABLISHED:
+            onConnected();
+            break;
+            
+        case MQTT_CONN_CONNECTED:
+            if (!mqttClient.connected()) {
+                lastFailCode = mqttClient.state();
+                Serial.printf("✗ MQTT соединение потеряно (код=%d)\n", lastFailCode);
+                wifiClient.stop();
+                scheduleReconnect(MQTT_FAIL_LOST);
+                break;
+            }
+            
+            mqttClient.loop();
+            flushQueuedAcks();
+            if (recentIdsDirty) saveRecentIds();
+            drainOutbox();
+            
+            if (now - lastPublishTime > MQTT_PUBLISH_INTERVAL) {
+                lastPublishTime = now;
+                publishWaterState();
+                publishKettleState();
+            }
+            break;
     }
 }
 
 // ==================== ПОДКЛЮЧЕНИЕ ====================
-void MQTTManager::connect() {
-    if (!wifiManager.hasMqttCredentials()) {
-        Serial.println("⚠ Невозможно подключиться: нет учетных данных MQTT");
-        return;
+void MQTTManager::connectorTaskEntry(void* param) {
+    MQTTManager* self = (MQTTManager*)param;
+    
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (self->connState.load() == MQTT_CONN_CONNECTING) {
+            self->connect();
+        }
     }
+}
+
+void MQTTManager::connect() {
+    MqttFailReason reason = MQTT_FAIL_NONE;
     
-    Serial.print("Подключение к Dealgate MQTT... ");
+    // ===== ШАГ 1: DNS =====
+    IPAddress brokerIP;
+    if (!WiFi.hostByName(MQTT_SERVER, brokerIP)) {
+        reason = MQTT_FAIL_DNS;
+    }
+    // ===== ШАГ 2: TCP с ограниченным таймаутом =====
+    else if (!wifiClient.connect(brokerIP, MQTT_PORT, MQTT_TCP_TIMEOUT)) {
+        reason = MQTT_FAIL_TCP;
+    }
+    // ===== ШАГ 3: MQTT CONNECT поверх открытого сокета =====
+    else {
+        mqttClient.setServer(brokerIP, MQTT_PORT);
+        bool connected = mqttClient.connect(
+            clientId,
+            wifiManager.getMqttUser().c_str(),
+            wifiManager.getMqttPass().c_str(),
+            NULL, 0, false, NULL,
+            false   // Постоянная сессия: брокер хранит подписку и команды QoS1 на время разрыва
+        );
+        
+        if (!connected) {
+            reason = mqttClient.state() == MQTT_CONNECTION_TIMEOUT ?
+                     MQTT_FAIL_TIMEOUT : MQTT_FAIL_REFUSED;
+        }
+    }
     
-    bool connected = mqttClient.connect(
-        clientId.c_str(),
-        wifiManager.getMqttUser().c_str(),
-        wifiManager.getMqttPass().c_str(),
-        NULL, 0, false, NULL
-    );
+    reconnectState.attemptFinished(millis());
     
-    if (connected) {
-        Serial.println("OK");
-        messagesFailed = 0;
-        subscribe();
-        publishWaterState();
-        publishKettleState();
-    } else {
-        Serial.printf("ОШИБКА (код=%d)\n", mqttClient.state());
-        messagesFailed++;
+    if (reason == MQTT_FAIL_NONE) {
+        Serial.printf("MQTT: подключено за %lu мс\n", reconnectState.getLastLatency());
+        reconnectState.succeeded();
+        connState = MQTT_CONN_ESTABLISHED;
+        return;
     }
+    
+    lastFailCode = mqttClient.state();
+    Serial.printf("MQTT: ОШИБКА подключения (%s, код=%d) за %lu мс\n",
+                  failReasonName(reason), lastFailCode, reconnectState.getLastLatency());
+    wifiClient.stop();
+    messagesFailed++;
+    scheduleReconnect(reason);
+}
+
+void MQTTManager::onConnected() {
+    messagesFailed = 0;
+    connState = MQTT_CONN_CONNECTED;
+    subscribe();
+    
+    // Сначала накопленное за время без связи, потом текущее состояние
+    drainOutbox();
+    publishWaterState();
+    publishKettleState();
+}
+
+void MQTTManager::scheduleReconnect(MqttFailReason reason) {
+    uint32_t delayMs = reconnectState.failed(reason, millis(), esp_random());
+    connState = MQTT_CONN_DISCONNECTED;
+    DPRINTF("MQTT: следующая попытка через %lu мс\n", (unsigned long)delayMs);
+}
+
+unsigned long MQTTManager::getRetryDelay() {
+    if (connState.load() != MQTT_CONN_DISCONNECTED) return 0;
+    return reconnectState.retryDelay(millis());
 }
 
 // ==================== ПОДПИСКА ====================
 void MQTTManager::subscribe() {
-    if (mqttClient.subscribe(fillingTopic.c_str())) {
-        Serial.printf("Подписка на топик: %s\n", fillingTopic.c_str());
+    // QoS1: команда, отправленная во время разрыва, будет доставлена после переподключения
+    if (mqttClient.subscribe(fillingTopic, 1)) {
+        Serial.printf("Подписка на топик: %s\n", fillingTopic);
     }
 }
 
 // ==================== CALLBACK ====================
 void MQTTManager::mqttCallback(char* topic, byte* payload, unsigned int length) {
     if (!instance) return;
+    instance->handleMessage(topic, payload, length);
+}
+
+void MQTTManager::handleMessage(const char* topic, const byte* payload, unsigned int length) {
+    // Вызывается из mqttClient.loop(): топик и payload лежат в буфере клиента
+    // и действительны до выхода, поэтому разбираем их на месте без копий
+    uint32_t start = micros();
+    uint32_t heapBefore = ESP.getFreeHeap();
+    messagesReceived++;
+    
+    const TopicRoute* route = mqttMatchRoute(routes, MQTT_ROUTE_COUNT, topic);
+    if (route) (this->*route->handler)(payload, length);
+    
+    // Разбор, проверка и передача команды не должны обращаться к куче
+    // (подтверждения публикуются после выхода из mqttClient.loop());
+    // разбор и маршруты без кучи проверяет test/test_mqtt_command.cpp
+    if (ESP.getFreeHeap() != heapBefore) {
+        receiveHeapOps++;
+        DPRINTF("⚠️ MQTT: обработка сообщения изменила кучу (%ld байт)\n",
+                (long)heapBefore - (long)ESP.getFreeHeap());
+    }
+    
+    lastReceiveTime = micros() - start;
+    if (lastReceiveTime > maxReceiveTime) maxReceiveTime = lastReceiveTime;
+}
+
+void MQTTManager::handleFillingCommand(const byte* payload, unsigned int length) {
+    // Формат: "<код>" или "<код>:<идентификатор>" (MqttCommand.h)
+    char id[MQTT_COMMAND_ID_MAX];
+    int mode;
+    MqttCommandStatus status = mqttAcceptFillingCommand(payload, length, recentIds, mode, id,
+        [this](int m, const char* commandId) { return dispatchFillingCommand(m, commandId); });
     
-    // Создаем копию сообщения с нуль-терминатором
-    char* message = new char[length + 1];
-    if (!message) return;  // Проверка выделения памяти
+    // Строки журнала короче буфера Print::printf (64 байта): длиннее - это malloc
+    switch (status) {
+        case MQTT_COMMAND_ACCEPTED:
+            if (id[0] != '\0') recentIdsDirty = true;  // Во флеш - после выхода из mqttClient.loop()
+            break;
+        case MQTT_COMMAND_INVALID:
+            Serial.printf("MQTT: неверная команда (%u байт)\n", length);
+            queueAck(id, mode, "rejected");
+            break;
+        case MQTT_COMMAND_DUPLICATE:
+            // Повтор уже выполненной команды (QoS1 доставляет минимум один раз)
+            commandsDuplicate++;
+            Serial.print("MQTT: повтор команды ");
+            Serial.println(id);
+            queueAck(id, mode, "duplicate");
+            break;
+        case MQTT_COMMAND_REJECTED:
+            // Идентификатор не запомнен: повтор этой команды выполнится
+            queueAck(id, mode, "rejected");
+            break;
+    }
+}
+
+bool MQTTManager::dispatchFillingCommand(int mode, const char* id) {
+    uint16_t tag = nextCommandTag++;
+    if (nextCommandTag == 0) nextCommandTag = 1;  // 0 - без подтверждения
     
-    memcpy(message, payload, length);
-    message[length] = '\0';
+    PendingCommand& pending = pendingCommands[pendingHead];
+    pendingHead = (pendingHead + 1) % MQTT_PENDING_COMMANDS;
+    pending.tag = tag;
+    pending.mode = mode;
+    memcpy(pending.id, id, sizeof(pending.id));
     
-    Serial.printf("MQTT команда получена [%s]: %s\n", topic, message);
+    Serial.printf("Выполнение команды налива: режим %d\n", mode);
+    if (!commandCallback || !commandCallback(mode, tag)) {
+        pending.tag = 0;
+        return false;
+    }
+    return true;
+}
+
+// ==================== ПОДТВЕРЖДЕНИЕ КОМАНД ====================
+void MQTTManager::loadRecentIds() {
+    // Повторная доставка QoS 1 после перезагрузки тоже должна узнаваться как повтор
+    if (!preferences.begin(MQTT_IDS_PREFS, false)) return;
+    if (preferences.getBytesLength("ids") != RecentCommandIds::storageSize()) return;
     
-    String topicStr = String(topic);
+    preferences.getBytes("ids", recentIds.storage(), RecentCommandIds::storageSize());
+    recentIds.restore(preferences.getUChar("head", 0));
+}
+
+void MQTTManager::saveRecentIds() {
+    // Запись только при новом идентификаторе - не чаще команд с id
+    preferences.putBytes("ids", recentIds.storage(), RecentCommandIds::storageSize());
+    preferences.putUChar("head", recentIds.getHead());
+    recentIdsDirty = false;
+}
+
+void MQTTManager::publishAck(const char* id, int mode, const char* status, uint32_t timestamp,
+                             float volume) {
+    char payload[OUTBOX_PAYLOAD_MAX];
+    if (mqttFormatAck(payload, sizeof(payload), id, mode, status, timestamp, volume) == 0) return;
     
-    if (topicStr == instance->fillingTopic) {
-        int mode = atoi(message);
+    // Подтверждения идут через очередь: результат не теряется при разрыве
+    if (publishState(ackTopic, payload, false)) acksSent++;
+}
+
+void MQTTManager::queueAck(const char* id, int mode, const char* status) {
+    // Внутри mqttClient.loop() не публикуем: буфер клиента занят входящим сообщением
+    if (queuedAckCount == MQTT_ACK_QUEUE) {
+        messagesFailed++;
+        return;
+    }
+    QueuedAck& ack = queuedAcks[queuedAckCount++];
+    memcpy(ack.id, id, sizeof(ack.id));
+    ack.mode = mode;
+    ack.status = status;
+    ack.timestamp = millis();
+}
+
+void MQTTManager::flushQueuedAcks() {
+    for (uint8_t i = 0; i < queuedAckCount; i++) {
+        const QueuedAck& ack = queuedAcks[i];
+        publishAck(ack.id, ack.mode, ack.status, ack.timestamp);
+    }
+    queuedAckCount = 0;
+}
+
+void MQTTManager::processCommandResults() {
+    CommandResult result;
+    while (stateMachine.popCommandResult(result)) {
+        PendingCommand* pending = nullptr;
+        for (int i = 0; i < MQTT_PENDING_COMMANDS; i++) {
+            if (pendingCommands[i].tag == result.tag) {
+                pending = &pendingCommands[i];
+                break;
+            }
+        }
+        if (!pending) continue;  // Вытеснена более новыми командами
         
-        if (mode >= 1 && mode <= 8 && instance->commandCallback) {
-            Serial.printf("Выполнение команды налива: режим %d\n", mode);
-            instance->commandCallback(mode);
+        switch (result.outcome) {
+            case CMD_RESULT_ACCEPTED:
+                publishAck(pending->id, pending->mode, "accepted", result.timestamp);
+                break;
+            case CMD_RESULT_REJECTED:
+                publishAck(pending->id, pending->mode, "rejected", result.timestamp, result.volume);
+                pending->tag = 0;
+                break;
+            case CMD_RESULT_COMPLETED:
+                publishAck(pending->id, pending->mode, "completed", result.timestamp, result.volume);
+                pending->tag = 0;
+                break;
+            case CMD_RESULT_FAILED:
+                publishAck(pending->id, pending->mode, "failed", result.timestamp, result.volume);
+                pending->tag = 0;
+                break;
+            case CMD_RESULT_STOPPED:
+                publishAck(pending->id, pending->mode, "stopped", result.timestamp, result.volume);
+                pending->tag = 0;
+                break;
         }
     }
-    
-    // Освобождаем память
-    delete[] message;
 }
 
 // ==================== ПУБЛИКАЦИЯ ====================
-bool MQTTManager::publish(const String& topic, const String& payload, bool retained) {
-    if (!mqttClient.connected()) {
+bool MQTTManager::publish(const char* topic, const char* payload, bool retained) {
+    if (!isConnected() || !mqttClient.connected()) {
         messagesFailed++;
         return false;
     }
     
-    // Ограничиваем длину payload для предотвращения переполнения буфера
-    String safePayload = payload;
-    if (safePayload.length() > 250) {
-        safePayload = safePayload.substring(0, 250);
-        Serial.println("⚠ Payload слишком длинный, обрезан");
-    }
-    
-    bool result = mqttClient.publish(topic.c_str(), safePayload.c_str(), retained);
+    // Сообщение длиннее буфера клиента PubSubClient не отправит (вернет false)
+    bool result = mqttClient.publish(topic, payload, retained);
     
     if (result) {
         messagesSent++;
-        Serial.printf("MQTT публикация [%s]: %s\n", topic.c_str(), safePayload.c_str());
+        DPRINTF("MQTT публикация [%s]: %s\n", topic, payload);
     } else {
         messagesFailed++;
-        Serial.printf("MQTT публикация ОШИБКА [%s]\n", topic.c_str());
+        Serial.printf("MQTT публикация ОШИБКА [%s]\n", topic);
     }
     
     return result;
 }
 
-// ==================== РАСЧЕТ УРОВНЯ ВОДЫ ====================
-int MQTTManager::calculateWaterState() {
-    float waterVolume = scale.getCurrentWeight() - scale.getEmptyWeight();
-    if (waterVolume < 0) waterVolume = 0;
-    
-    float volumeML = waterVolume;
-    
-    int state;
-    if (volumeML < WATER_LEVEL_EMPTY) {
-        state = 0;
-        Serial.printf("Объем воды: %.0f мл -> состояние 0 (ПУСТО)\n", volumeML);
-    } else if (volumeML <= WATER_LEVEL_LOW) {
-        state = 1;
-        Serial.printf("Объем воды: %.0f мл -> состояние 1 (НИЗКИЙ)\n", volumeML);
-    } else {
-        state = 2;
-        Serial.printf("Объем воды: %.0f мл -> состояние 2 (НОРМАЛЬНЫЙ)\n", volumeML);
+// ==================== ОЧЕРЕДЬ СОСТОЯНИЙ ====================
+bool MQTTManager::publishState(const char* topic, const char* payload, bool retained) {
+    // Пока в очереди есть старые сообщения, новые идут за ними - порядок сохраняется
+    if (isConnected() && outbox.isEmpty()) {
+        if (publish(topic, payload, retained)) return true;
+    }
+    
+    if (outbox.push(topic, payload, retained)) {
+        DPRINTF("📮 MQTT сообщение в очереди [%s]: %s (всего %lu)\n",
+                topic, payload, (unsigned long)outbox.getDepth());
+        return true;
+    }
+    
+    messagesFailed++;
+    return false;
+}
+
+void MQTTManager::drainOutbox() {
+    if (outbox.isEmpty() || !isConnected()) return;
+    
+    uint32_t start = micros();
+    int sent = 0;
+    OutboxRecord rec;
+    
+    while (sent < OUTBOX_BATCH && outbox.peek(rec)) {
+        if (!mqttClient.publish(rec.topic, rec.payload, rec.retained)) {
+            messagesFailed++;
+            break;  // Повторим с этого же сообщения в следующем проходе
+        }
+        outbox.pop();
+        messagesSent++;
+        sent++;
     }
     
-    return state;
+    // Номер отправленного сохраняем раз на пачку, а не на каждое сообщение
+    outbox.commit();
+    
+    if (sent > 0) {
+        uint32_t elapsed = micros() - start;
+        outboxDrainRate = elapsed > 0 ? sent * 1000000.0f / elapsed : 0;
+        Serial.printf("📮 Из очереди MQTT отправлено: %d (осталось %lu)\n",
+                      sent, (unsigned long)outbox.getDepth());
+    }
+}
+
+// ==================== РАСЧЕТ УРОВНЯ ВОДЫ ====================
+int MQTTManager::calculateWaterState(const SystemSnapshot& snap) {
+    // Гистерезис и удержание: шум веса у порогов не вызывает серию публикаций
+    return waterLevel.update(snap.waterVolume, millis());
 }
 
 // ==================== ПУБЛИКАЦИЯ УРОВНЯ ВОДЫ ====================
 bool MQTTManager::publishWaterState() {
-    if (!scale.isKettlePresent()) {
-        int currentState = 0;
-        
-        if (currentState != lastWaterState) {
-            Serial.printf("Состояние воды (нет чайника): %d -> %d\n", lastWaterState, currentState);
-            
-            String payload = String(currentState);
-            bool result = publish(waterLevelTopic, payload, false);
-            
-            if (result) {
-                lastWaterState = currentState;
-            }
-            
-            return result;
-        }
-        return true;
+    SystemSnapshot snap;
+    stateMachine.readSnapshot(snap);
+    if (snap.version == 0) return true;  // Весы еще не опрошены
+    
+    int currentState;
+    if (snap.kettlePresent) {
+        currentState = calculateWaterState(snap);
+    } else {
+        // Без чайника - сразу 0; вернувшийся чайник получает уровень без удержания
+        currentState = 0;
+        waterLevel.reset();
     }
     
-    int currentState = calculateWaterState();
+    if (currentState == lastWaterState) return true;
     
-    if (currentState != lastWaterState) {
-        Serial.printf("Состояние воды изменилось: %d -> %d\n", lastWaterState, currentState);
-        
-        String payload = String(currentState);
-        bool result = publish(waterLevelTopic, payload, false);
-        
-        if (result) {
-            lastWaterState = currentState;
-        }
-        
-        return result;
+    static const char* levelNames[] = {"ПУСТО", "НИЗКИЙ", "НОРМАЛЬНЫЙ"};
+    Serial.printf("Состояние воды изменилось: %d -> %d (%s, %.0f мл%s)\n",
+                  lastWaterState, currentState, levelNames[currentState], snap.waterVolume,
+                  snap.kettlePresent ? "" : ", нет чайника");
+    
+    char payload[4];
+    snprintf(payload, sizeof(payload), "%d", currentState);
+    bool result = publishState(waterLevelTopic, payload, false);
+    
+    if (result) {
+        lastWaterState = currentState;
+        waterStatePublishes++;
     }
     
-    return true;
+    return result;
 }
 
 // ==================== ПУБЛИКАЦИЯ НАЛИЧИЯ ЧАЙНИКА ====================
 bool MQTTManager::publishKettleState() {
-    bool kettlePresent = scale.isKettlePresent();
+    SystemSnapshot snap;
+    stateMachine.readSnapshot(snap);
+    if (snap.version == 0) return true;  // Весы еще не опрошены
+    bool kettlePresent = snap.kettlePresent;
     int value = kettlePresent ? 1 : 0;
     
     if (value != lastKettlePresent) {
         Serial.printf("Наличие чайника изменилось: %d -> %d\n", lastKettlePresent, value);
         
-        String payload = String(value);
-        bool result = publish(kettleTopic, payload, false);
+        char payload[4];
+        snprintf(payload, sizeof(payload), "%d", value);
+        bool result = publishState(kettleTopic, payload, false);
         
         if (result) {
             lastKettlePresent = value;
@@ -308,6 +605,117 @@ bool MQTTManager::publishKettleState() {
     return true;
 }
 
+// ==================== ТЕЛЕМЕТРИЯ ====================
+bool MQTTManager::telemetryChanged(const SystemSnapshot& snap) {
+    if (telemetryVersion == 0) return true;
+    
+    // Во время налива пишем каждый сэмпл, в покое - только заметные изменения
+    if (snap.state == ST_FILLING) return true;
+    return snap.state != lastTelemetry.state ||
+           snap.pumpOn != lastTelemetry.pumpOn ||
+           snap.powerRelayOn != lastTelemetry.powerRelayOn ||
+           snap.kettlePresent != lastTelemetry.kettlePresent ||
+           fabsf(snap.currentWeight - lastTelemetry.currentWeight) >= TELEMETRY_WEIGHT_STEP;
+}
+
+void MQTTManager::sampleTelemetry(const SystemSnapshot& snap) {
+    if (snap.version == telemetryVersion || !telemetryChanged(snap)) return;
+    
+    telemetryVersion = snap.version;
+    lastTelemetry = snap;
+    
+    // Пачка полна - вытесняем самый старый сэмпл
+    if (telemetryCount == TELEMETRY_SAMPLES) {
+        memmove(&telemetrySamples[0], &telemetrySamples[1],
+                (TELEMETRY_SAMPLES - 1) * sizeof(TelemetrySample));
+        telemetryCount--;
+    }
+    
+    TelemetrySample& sample = telemetrySamples[telemetryCount++];
+    sample.timestamp = snap.timestamp;
+    sample.weight = snap.currentWeight;
+    sample.flow = snap.flowRate;
+}
+
+size_t MQTTManager::serializeTelemetry(const SystemSnapshot& snap) {
+    static const char* stateNames[] = {"INIT", "IDLE", "FILLING", "CALIBRATION", "ERROR"};
+    
+    JsonWriter json(telemetryBuffer, sizeof(telemetryBuffer));
+    json.beginObject();
+    json.field("t", snap.timestamp);
+    json.field("state", stateNames[snap.state]);
+    json.field("weight", snap.currentWeight, 1);
+    json.field("volume", snap.waterVolume, 0);
+    json.field("flow", snap.flowRate, 1);
+    json.field("pump", snap.pumpOn ? 1 : 0);
+    json.field("relay", snap.powerRelayOn ? 1 : 0);
+    json.field("kettle", snap.kettlePresent ? 1 : 0);
+    
+    if (snap.state == ST_FILLING) {
+        float span = snap.fillTarget - snap.fillStart;
+        float progress = span > 0 ? (snap.currentWeight - snap.fillStart) / span * 100 : 0;
+        json.field("target", snap.fillTarget, 0);
+        json.field("progress", (int)constrain(progress, 0, 100));
+        json.field("eta", snap.timeToTarget, 1);
+    }
+    if (snap.error != ERR_NONE) {
+        json.field("error", (int)snap.error);
+        json.field("errorName", errorName(snap.error));
+    }
+    
+    // Сэмплы: [мс до момента t, вес г, поток г/с]
+    json.beginArray("samples");
+    for (uint8_t i = 0; i < telemetryCount; i++) {
+        const TelemetrySample& sample = telemetrySamples[i];
+        json.beginArray();
+        json.value(snap.timestamp - sample.timestamp);
+        json.value(sample.weight, 1);
+        json.value(sample.flow, 1);
+        json.endArray();
+    }
+    json.endArray();
+    json.endObject();
+    
+    // Обрезанный JSON не публикуем (finish() вернет 0)
+    return json.finish();
+}
+
+bool MQTTManager::publishTelemetry() {
+    SystemSnapshot snap;
+    stateMachine.readSnapshot(snap);
+    if (snap.version == 0) return true;  // Весы еще не опрошены
+    
+    sampleTelemetry(snap);
+    
+    // Во время налива - часто, с прогрессом и прогнозом; в покое - редко
+    unsigned long interval = snap.state == ST_FILLING ?
+                             MQTT_TELEMETRY_FAST_INTERVAL : MQTT_PUBLISH_INTERVAL;
+    unsigned long now = millis();
+    if (now - lastTelemetryTime < interval) return true;
+    
+    // Ничего не изменилось с прошлой отправки - не публикуем
+    if (telemetryCount == 0) return true;
+    
+    // Телеметрия быстро устаревает: без связи не копим ее в очереди во флеше
+    if (!isConnected()) {
+        telemetryCount = 0;
+        return false;
+    }
+    
+    lastTelemetryTime = now;
+    lastTelemetrySize = serializeTelemetry(snap);
+    telemetryCount = 0;
+    if (lastTelemetrySize == 0) {
+        messagesFailed++;
+        DPRINTLN("⚠️ MQTT: телеметрия не поместилась в буфер");
+        return false;
+    }
+    
+    bool result = publish(telemetryTopic, telemetryBuffer, false);
+    if (result) telemetrySent++;
+    return result;
+}
+
 // ==================== РАБОТА С УЧЕТНЫМИ ДАННЫМИ ====================
 bool MQTTManager::loadCredentials() {
     // Больше НЕ работаем с Preferences напрямую
@@ -333,14 +741,20 @@ bool MQTTManager::hasCredentials() {
 
 // ==================== УПРАВЛЕНИЕ ПОДКЛЮЧЕНИЕМ ====================
 void MQTTManager::disconnect() {
+    // Во время подключения клиентом владеет задача подключения
+    if (connState.load() == MQTT_CONN_CONNECTING) return;
+    
     if (mqttClient.connected()) {
         mqttClient.disconnect();
         Serial.println("MQTT отключен");
     }
+    connState = MQTT_CONN_DISCONNECTED;
+    reconnectState.postpone(millis(), MQTT_BACKOFF_MAX);
 }
 
 void MQTTManager::reconnect() {
+    if (connState.load() == MQTT_CONN_CONNECTING) return;
+    
     disconnect();
-    delay(100);
-    connect();
+    reconnectState.retryNow(millis());
 }
\ No newline at end of file
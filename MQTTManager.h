@@ -12,24 +12,73 @@
 #include "Scale.h"
 #include "StateMachine.h"
 #include "WiFiManager.h"
+#include "MqttOutbox.h"
+#include "LevelQuantizer.h"
+#include "JsonWriter.h"
+#include "MqttReconnect.h"
+#include "MqttTopics.h"
+#include "MqttCommand.h"
+#include <atomic>
 
-#define WATER_LEVEL_EMPTY 500
-#define WATER_LEVEL_LOW 1000
+// ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
+#define MQTT_CONNECTOR_STACK 4096      // Стек задачи подключения (байт)
+#define MQTT_ID_MAX 32                 // Максимальная длина Client ID и имени устройства (с нулем)
+#define MQTT_TOPIC_MAX OUTBOX_TOPIC_MAX // Топики должны помещаться в запись очереди
+#define MQTT_ROUTE_COUNT 1             // Входящих топиков (подписок)
+#define MQTT_IDS_PREFS "mqtt_ids"      // Пространство Preferences для последних идентификаторов
+#define MQTT_PENDING_COMMANDS 4        // Команд, ожидающих подтверждения
+#define MQTT_ACK_QUEUE 4               // Подтверждений из обработчика сообщения, ждущих выхода из loop()
+#define MQTT_BUFFER_SIZE 512           // Буфер клиента: топик + сообщение (байт)
+#define TELEMETRY_SAMPLES 10           // Максимум сэмплов в одном сообщении телеметрии
+#define TELEMETRY_JSON_MAX 448         // Буфер сериализованной телеметрии (байт)
+#define TELEMETRY_WEIGHT_STEP 1.0f     // Изменение веса вне налива, которое попадает в телеметрию (г)
 
-typedef void (*CommandCallback)(int mode);
+/**
+ * Сэмпл телеметрии
+ */
+struct TelemetrySample {
+    uint32_t timestamp;     // millis() снимка
+    float weight;           // г
+    float flow;             // г/с
+};
+
+/**
+ * Передать команду на выполнение
+ * @param mode - код команды (1-8)
+ * @param tag - номер команды, по которому придет CommandResult
+ * @return false - команду не удалось поставить в очередь
+ */
+typedef bool (*CommandCallback)(int mode, uint16_t tag);
 
 class MQTTManager {
 private:
     // ==================== ОСНОВНЫЕ ОБЪЕКТЫ ====================
     WiFiClient wifiClient;
     PubSubClient mqttClient;
-    Preferences preferences;  // Оставляем, но будем правильно закрывать
+    Preferences preferences;  // Последние идентификаторы команд (MQTT_IDS_PREFS)
+    
+    // ==================== ВХОДЯЩИЕ ТОПИКИ ====================
+    /**
+     * Маршрут входящего сообщения: топик сравнивается сначала по длине,
+     * затем через memcmp (mqttMatchRoute), обработчик разбирает payload
+     * прямо в буфере клиента
+     */
+    struct TopicRoute {
+        const char* topic;
+        size_t length;
+        void (MQTTManager::*handler)(const byte* payload, unsigned int length);
+    };
     
     // ==================== НАСТРОЙКИ ТОПИКОВ ====================
-    String clientId;
-    String waterLevelTopic;
-    String kettleTopic;
-    String fillingTopic;
+    // Строятся один раз в конструкторе из MAC-адреса и больше не меняются
+    char deviceName[MQTT_ID_MAX];
+    char clientId[MQTT_ID_MAX];
+    char waterLevelTopic[MQTT_TOPIC_MAX];
+    char kettleTopic[MQTT_TOPIC_MAX];
+    char fillingTopic[MQTT_TOPIC_MAX];
+    char telemetryTopic[MQTT_TOPIC_MAX];
+    char ackTopic[MQTT_TOPIC_MAX];
+    TopicRoute routes[MQTT_ROUTE_COUNT];
     
     // ==================== УЧЕТНЫЕ ДАННЫЕ ====================
     String mqttUser;
@@ -43,14 +92,67 @@ private:
     StateMachine& stateMachine;
     WiFiManager& wifiManager;
     
+    // ==================== ПОДКЛЮЧЕНИЕ ====================
+    std::atomic<uint8_t> connState;    // MqttConnState
+    TaskHandle_t connectorTask;        // Задача, выполняющая блокирующие шаги подключения
+    MqttReconnect reconnectState;      // Пауза между попытками, длительность, причины неудач
+    int lastFailCode;                  // mqttClient.state() при последней неудаче
+    
+    // ==================== ПРИЕМ СООБЩЕНИЙ ====================
+    unsigned long messagesReceived;
+    unsigned long receiveHeapOps;      // Сообщений, при обработке которых изменилась свободная куча
+    uint32_t lastReceiveTime;          // Длительность обработки последнего сообщения (мкс)
+    uint32_t maxReceiveTime;
+    
+    // ==================== ПОДТВЕРЖДЕНИЕ КОМАНД ====================
+    struct PendingCommand {
+        uint16_t tag;                  // 0 - слот свободен
+        uint8_t mode;
+        char id[MQTT_COMMAND_ID_MAX];  // Пусто - команда без идентификатора
+    };
+    PendingCommand pendingCommands[MQTT_PENDING_COMMANDS];
+    uint8_t pendingHead;               // Следующий слот (при нехватке вытесняется самый старый)
+    RecentCommandIds recentIds;
+    bool recentIdsDirty;               // Новый идентификатор еще не сохранен во флеш
+    uint16_t nextCommandTag;
+    
+    // Подтверждения из обработчика: публикуются после выхода из mqttClient.loop()
+    struct QueuedAck {
+        char id[MQTT_COMMAND_ID_MAX];
+        int mode;                      // Как пришел: у отклоненной команды может быть вне 1-8
+        const char* status;            // Строковый литерал
+        uint32_t timestamp;
+    };
+    QueuedAck queuedAcks[MQTT_ACK_QUEUE];
+    uint8_t queuedAckCount;
+    unsigned long commandsDuplicate;
+    unsigned long acksSent;
+    
+    // ==================== ОЧЕРЕДЬ СОСТОЯНИЙ ====================
+    MqttOutbox outbox;                 // Сообщения, ожидающие подключения (во флеше)
+    float outboxDrainRate;             // Скорость отправки последней пачки (сообщений/с)
+    
+    // ==================== ТЕЛЕМЕТРИЯ ====================
+    // Буферы выделены один раз и переиспользуются для каждого сообщения
+    TelemetrySample telemetrySamples[TELEMETRY_SAMPLES];
+    uint8_t telemetryCount;            // Сэмплов, накопленных с прошлой отправки
+    uint32_t telemetryVersion;         // Версия снимка последнего сэмпла
+    SystemSnapshot lastTelemetry;      // Снимок последнего сэмпла (для поиска изменений)
+    unsigned long lastTelemetryTime;
+    unsigned long telemetrySent;
+    size_t lastTelemetrySize;
+    char telemetryBuffer[TELEMETRY_JSON_MAX];
+    
     // ==================== ТАЙМИНГИ И СТАТИСТИКА ====================
-    unsigned long lastReconnectAttempt;
     unsigned long lastPublishTime;
     unsigned long lastHeartbeatTime;
     unsigned long lastConnectionCheckTime;
     unsigned long messagesSent;
     unsigned long messagesFailed;
-    unsigned long reconnectAttempts;
+    
+    // ==================== УРОВЕНЬ ВОДЫ ====================
+    LevelQuantizer<3> waterLevel;
+    unsigned long waterStatePublishes;
     
     // ==================== КЭШ ====================
     int lastWaterState;
@@ -58,11 +160,40 @@ private:
     bool lastMqttConnected;
     
     // ==================== ПРИВАТНЫЕ МЕТОДЫ ====================
-    void connect();
+    void buildTopics();
+    void buildTopic(char* buffer, const char* leaf);
+    static void connectorTaskEntry(void* param);
+    void connect();                              // Выполняется в задаче подключения
+    void onConnected();                          // Подписка и первые публикации
+    void scheduleReconnect(MqttFailReason reason);
     void subscribe();
     static void mqttCallback(char* topic, byte* payload, unsigned int length);
-    bool publish(const String& topic, const String& payload, bool retained = false);
-    int calculateWaterState();
+    void handleMessage(const char* topic, const byte* payload, unsigned int length);
+    void handleFillingCommand(const byte* payload, unsigned int length);
+    
+    // Передать разобранную команду автомату (false - очередь полна)
+    bool dispatchFillingCommand(int mode, const char* id);
+    
+    // Повторы команд и подтверждения
+    void loadRecentIds();
+    void saveRecentIds();
+    void publishAck(const char* id, int mode, const char* status, uint32_t timestamp,
+                    float volume = -1);
+    void queueAck(const char* id, int mode, const char* status);  // Из обработчика сообщения
+    void flushQueuedAcks();
+    bool publish(const char* topic, const char* payload, bool retained = false);
+    
+    // Публикация состояния: без связи (или пока очередь не пуста) - в очередь во флеше
+    bool publishState(const char* topic, const char* payload, bool retained = false);
+    
+    // Отправить пачку сообщений из очереди по порядку
+    void drainOutbox();
+    int calculateWaterState(const SystemSnapshot& snap);
+    
+    // Телеметрия: сэмпл при изменении, сериализация пачки в telemetryBuffer
+    bool telemetryChanged(const SystemSnapshot& snap);
+    void sampleTelemetry(const SystemSnapshot& snap);
+    size_t serializeTelemetry(const SystemSnapshot& snap);
     
     // ==================== УПРАВЛЕНИЕ ПАМЯТЬЮ ====================
     void clearStrings();  // Метод для очистки строк
@@ -90,17 +221,70 @@ public:
     // ==================== ПУБЛИКАЦИЯ СТАТУСОВ ====================
     bool publishWaterState();
     bool publishKettleState();
+    
+    /**
+     * Накопить сэмпл и при наступлении срока опубликовать пачку телеметрии
+     * Вызывается из задачи публикации; во время налива публикует
+     * раз в MQTT_TELEMETRY_FAST_INTERVAL, в покое - раз в MQTT_PUBLISH_INTERVAL
+     * и только если что-то изменилось
+     */
+    bool publishTelemetry();
+    
+    /**
+     * Опубликовать подтверждения по результатам команд из автомата
+     * Вызывается из задачи публикации
+     */
+    void processCommandResults();
      
     // ==================== УПРАВЛЕНИЕ ПОДКЛЮЧЕНИЕМ ====================
-    bool isConnected() { return mqttClient.connected(); }
+    bool isConnected() { return connState.load() == MQTT_CONN_CONNECTED; }
     void disconnect();
-    void reconnect();
+    void reconnect();   // Переподключиться без паузы
+    
+    // ==================== СТАТИСТИКА ПОДКЛЮЧЕНИЯ ====================
+    MqttConnState getConnState() { return (MqttConnState)connState.load(); }
+    MqttFailReason getLastFailReason() { return reconnectState.getLastFailReason(); }
+    int getLastFailCode() { return lastFailCode; }
+    unsigned long getLastConnectLatency() { return reconnectState.getLastLatency(); }
+    unsigned long getMaxConnectLatency() { return reconnectState.getMaxLatency(); }
+    unsigned long getConnectSuccesses() { return reconnectState.getSuccesses(); }
+    unsigned long getConnectFailures(MqttFailReason reason) { return reconnectState.getFailures(reason); }
+    
+    // ==================== СТАТИСТИКА ПРИЕМА ====================
+    unsigned long getMessagesReceived() { return messagesReceived; }
+    unsigned long getReceiveHeapOps() { return receiveHeapOps; }
+    uint32_t getLastReceiveTime() { return lastReceiveTime; }
+    uint32_t getMaxReceiveTime() { return maxReceiveTime; }
+    
+    // ==================== СТАТИСТИКА КОМАНД ====================
+    unsigned long getCommandsDuplicate() { return commandsDuplicate; }
+    unsigned long getAcksSent() { return acksSent; }
+    
+    // ==================== СТАТИСТИКА УРОВНЯ ВОДЫ ====================
+    unsigned long getWaterStatePublishes() { return waterStatePublishes; }
+    uint32_t getWaterStateSuppressed() { return waterLevel.getSuppressed(); }
+    
+    // ==================== СТАТИСТИКА ТЕЛЕМЕТРИИ ====================
+    unsigned long getTelemetrySent() { return telemetrySent; }
+    size_t getLastTelemetrySize() { return lastTelemetrySize; }
+    
+    // ==================== СТАТИСТИКА ОЧЕРЕДИ ====================
+    MqttOutbox& getOutbox() { return outbox; }
+    float getOutboxDrainRate() { return outboxDrainRate; }
+    
+    /** @return сколько осталось до следующей попытки (мс), 0 - не ждем */
+    unsigned long getRetryDelay();
+    
+    static const char* connStateName(MqttConnState state) { return mqttConnStateName(state); }
+    static const char* failReasonName(MqttFailReason reason) { return mqttFailReasonName(reason); }
     
     // ==================== ГЕТТЕРЫ ====================
     unsigned long getMessagesSent() { return messagesSent; }
     unsigned long getMessagesFailed() { return messagesFailed; }
-    unsigned long getReconnectAttempts() { return reconnectAttempts; }
+    unsigned long getReconnectAttempts() { return reconnectState.getAttempts(); }
     String getCurrentUser() { return mqttUser; }
+    const char* getClientId() { return clientId; }
+    const char* getDeviceName() { return deviceName; }
 };
 
 #endif
\ No newline at end of file
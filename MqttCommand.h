@@ -0,0 +1,180 @@
+// файл: MqttCommand.h
+// Разбор команд MQTT, отсев повторов, подтверждения и выбор обработчика по топику
+// Без Arduino и кучи: разбирается прямо буфер клиента, проверяется хост-тестом
+
+#ifndef MQTT_COMMAND_H
+#define MQTT_COMMAND_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <ctype.h>
+
+// ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
+#define MQTT_COMMAND_ID_MAX 17         // Идентификатор команды: до 16 символов [A-Za-z0-9_-] (с нулем)
+#define MQTT_RECENT_IDS 8              // Последних идентификаторов для отсева повторов
+#define MQTT_COMMAND_MODE_MIN 1        // Коды команд налива и СТОП
+#define MQTT_COMMAND_MODE_MAX 8
+
+/**
+ * Разобрать неотрицательное целое без копирования
+ * Допускаются пробелы по краям, другие символы - ошибка
+ * @return false - не число
+ */
+inline bool mqttParseUnsigned(const uint8_t* data, unsigned int length, int& value) {
+    unsigned int i = 0;
+    while (i < length && isspace(data[i])) i++;
+    while (length > i && isspace(data[length - 1])) length--;
+    if (i == length || length - i > 9) return false;  // Пусто или не помещается в int
+
+    value = 0;
+    for (; i < length; i++) {
+        if (data[i] < '0' || data[i] > '9') return false;
+        value = value * 10 + (data[i] - '0');
+    }
+    return true;
+}
+
+/**
+ * Разобрать идентификатор команды: 1-16 символов [A-Za-z0-9_-]
+ * @param id - буфер на MQTT_COMMAND_ID_MAX символов, при отказе не меняется
+ * @return false - идентификатор недопустим
+ */
+inline bool mqttParseCommandId(const uint8_t* data, unsigned int length, char* id) {
+    while (length > 0 && isspace(data[0])) { data++; length--; }
+    while (length > 0 && isspace(data[length - 1])) length--;
+    if (length == 0 || length >= MQTT_COMMAND_ID_MAX) return false;
+
+    // Ограниченный алфавит: идентификатор вставляется в JSON без экранирования.
+    // Копируем только проверенный целиком: отказ не должен вернуть обрезанный id
+    for (unsigned int i = 0; i < length; i++) {
+        if (!isalnum(data[i]) && data[i] != '_' && data[i] != '-') return false;
+    }
+    memcpy(id, data, length);
+    id[length] = '\0';
+    return true;
+}
+
+/**
+ * Разобрать команду налива: "<код>" или "<код>:<идентификатор>"
+ * @param mode - код команды (разобранный, даже если вне 1-8: для подтверждения)
+ * @param id - буфер на MQTT_COMMAND_ID_MAX символов, пусто - без идентификатора
+ * @return false - неверный формат, код или идентификатор
+ */
+inline bool mqttParseFillingCommand(const uint8_t* payload, unsigned int length, int& mode, char* id) {
+    const uint8_t* separator = (const uint8_t*)memchr(payload, ':', length);
+    unsigned int modeLength = separator ? separator - payload : length;
+
+    id[0] = '\0';
+    mode = 0;
+    if (!mqttParseUnsigned(payload, modeLength, mode)) return false;
+    if (mode < MQTT_COMMAND_MODE_MIN || mode > MQTT_COMMAND_MODE_MAX) return false;
+    return !separator || mqttParseCommandId(separator + 1, length - modeLength - 1, id);
+}
+
+/**
+ * Последние идентификаторы выполненных команд
+ * - Кольцо фиксированного размера: новый вытесняет самый старый
+ * - Хранится во флеше как есть (storage() и getHead()), чтобы повторная
+ *   доставка после перезагрузки тоже узнавалась
+ */
+class RecentCommandIds {
+private:
+    char ids[MQTT_RECENT_IDS][MQTT_COMMAND_ID_MAX];
+    uint8_t head;
+
+public:
+    RecentCommandIds() : head(0) { memset(ids, 0, sizeof(ids)); }
+
+    bool contains(const char* id) const {
+        if (id[0] == '\0') return false;
+        for (int i = 0; i < MQTT_RECENT_IDS; i++) {
+            if (strcmp(ids[i], id) == 0) return true;
+        }
+        return false;
+    }
+
+    void remember(const char* id) {
+        size_t length = strnlen(id, MQTT_COMMAND_ID_MAX - 1);
+        memset(ids[head], 0, MQTT_COMMAND_ID_MAX);
+        memcpy(ids[head], id, length);
+        head = (head + 1) % MQTT_RECENT_IDS;
+    }
+
+    // ==================== ХРАНЕНИЕ ВО ФЛЕШЕ ====================
+    void* storage() { return ids; }
+    static constexpr size_t storageSize() { return sizeof(ids); }
+    uint8_t getHead() const { return head; }
+
+    /** После чтения storage() из флеша: восстановить голову и нули в конце строк */
+    void restore(uint8_t savedHead) {
+        head = savedHead % MQTT_RECENT_IDS;
+        for (int i = 0; i < MQTT_RECENT_IDS; i++) ids[i][MQTT_COMMAND_ID_MAX - 1] = '\0';
+    }
+};
+
+/**
+ * Итог приема команды налива
+ */
+enum MqttCommandStatus : uint8_t {
+    MQTT_COMMAND_ACCEPTED,     // Передана на выполнение
+    MQTT_COMMAND_INVALID,      // Неверный формат
+    MQTT_COMMAND_DUPLICATE,    // Идентификатор уже выполнялся
+    MQTT_COMMAND_REJECTED      // Исполнитель не принял (очередь полна)
+};
+
+/**
+ * Принять команду налива: разбор, отсев повторов, передача исполнителю
+ * Идентификатор запоминается только после того, как исполнитель команду
+ * принял: повтор отклоненной команды выполняется, а не считается дубликатом
+ * @param dispatch - bool(int mode, const char* id): передать команду на выполнение
+ * @param mode, id - разобранная команда (для подтверждения)
+ */
+template <typename Dispatch>
+MqttCommandStatus mqttAcceptFillingCommand(const uint8_t* payload, unsigned int length,
+                                           RecentCommandIds& recent, int& mode, char* id,
+                                           Dispatch dispatch) {
+    if (!mqttParseFillingCommand(payload, length, mode, id)) return MQTT_COMMAND_INVALID;
+    if (recent.contains(id)) return MQTT_COMMAND_DUPLICATE;
+    if (!dispatch(mode, (const char*)id)) return MQTT_COMMAND_REJECTED;
+    if (id[0] != '\0') recent.remember(id);
+    return MQTT_COMMAND_ACCEPTED;
+}
+
+/**
+ * Подтверждение команды: {"id":...,"mode":...,"status":...,"t":...[,"volume":...]}
+ * @param id - проверенный идентификатор ([A-Za-z0-9_-], экранирование не нужно)
+ * @param volume - объем воды (мл), меньше 0 - без поля volume
+ * @return длина без нуля, 0 - не поместилось в буфер
+ */
+inline size_t mqttFormatAck(char* out, size_t size, const char* id, int mode, const char* status,
+                            uint32_t timestamp, float volume = -1) {
+    int length = snprintf(out, size, "{\"id\":\"%s\",\"mode\":%d,\"status\":\"%s\",\"t\":%lu",
+                          id, mode, status, (unsigned long)timestamp);
+    if (volume >= 0 && length > 0 && length < (int)size) {
+        length += snprintf(out + length, size - length, ",\"volume\":%.0f", volume);
+    }
+    if (length <= 0 || (size_t)length + 1 >= size) return 0;
+    out[length] = '}';
+    out[length + 1] = '\0';
+    return length + 1;
+}
+
+/**
+ * Найти маршрут входящего сообщения: сначала по длине топика, затем memcmp
+ * @param routes - массив структур с полями topic и length (длина посчитана заранее)
+ * @return маршрут или nullptr
+ */
+template <typename Route>
+const Route* mqttMatchRoute(const Route* routes, size_t count, const char* topic) {
+    size_t topicLength = strlen(topic);
+    for (size_t i = 0; i < count; i++) {
+        if (routes[i].length == topicLength && memcmp(routes[i].topic, topic, topicLength) == 0) {
+            return &routes[i];
+        }
+    }
+    return nullptr;
+}
+
+#endif
@@ -0,0 +1,158 @@
+// файл: MqttOutbox.cpp
+// Реализация очереди исходящих MQTT сообщений во флеш-памяти
+
+#include "MqttOutbox.h"
+#include "debug.h"
+
+MqttOutbox::MqttOutbox() {
+    ready = false;
+    head = 0;
+    tail = 0;
+    savedTail = 0;
+    enqueued = 0;
+    drained = 0;
+    dropped = 0;
+    corrupted = 0;
+}
+
+// ==================== CRC32 ====================
+uint32_t MqttOutbox::crc32(const uint8_t* data, size_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+    while (length--) {
+        crc ^= *data++;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+// ==================== ИНИЦИАЛИЗАЦИЯ ====================
+bool MqttOutbox::begin() {
+    const size_t fileSize = OUTBOX_SLOTS * sizeof(OutboxRecord);
+
+    // Файл создается один раз нужного размера, дальше только перезапись слотов
+    File file = SPIFFS.open(OUTBOX_FILE, "r");
+    bool valid = file && file.size() == fileSize;
+    if (file) file.close();
+
+    if (!valid) {
+        file = SPIFFS.open(OUTBOX_FILE, "w");
+        if (!file) {
+            LOG_ERROR("📮 Не удалось создать файл очереди MQTT");
+            return false;
+        }
+        OutboxRecord empty;
+        memset(&empty, 0, sizeof(empty));
+        for (int i = 0; i < OUTBOX_SLOTS; i++) {
+            file.write((const uint8_t*)&empty, sizeof(empty));
+        }
+        file.close();
+    }
+
+    prefs.begin(OUTBOX_PREFS, false);
+    savedTail = prefs.getUInt("acked", 0);
+
+    // Ищем последнее записанное сообщение среди целых записей
+    bool found = false;
+    uint32_t maxSeq = 0;
+    file = SPIFFS.open(OUTBOX_FILE, "r");
+    if (file) {
+        OutboxRecord rec;
+        for (int i = 0; i < OUTBOX_SLOTS; i++) {
+            if (file.read((uint8_t*)&rec, sizeof(rec)) != sizeof(rec)) break;
+            if (rec.magic != OUTBOX_MAGIC) continue;
+            if (crc32((const uint8_t*)&rec, offsetof(OutboxRecord, crc)) != rec.crc) {
+                corrupted++;
+                continue;
+            }
+            if (!found || (int32_t)(rec.seq - maxSeq) > 0) maxSeq = rec.seq;
+            found = true;
+        }
+        file.close();
+    }
+
+    tail = savedTail;
+    head = tail;
+    if (found && (int32_t)(maxSeq + 1 - tail) > 0) {
+        head = maxSeq + 1;
+        // Во флеше помещаются только последние OUTBOX_SLOTS сообщений
+        if (head - tail > OUTBOX_SLOTS) tail = head - OUTBOX_SLOTS;
+    }
+
+    ready = true;
+    if (head != tail) {
+        LOG_INFO("📮 Восстановлены неотправленные MQTT сообщения");
+        DPRINTF("📮   В очереди: %lu\n", (unsigned long)(head - tail));
+    }
+    return true;
+}
+
+// ==================== ЗАПИСЬ ====================
+bool MqttOutbox::push(const char* topic, const char* payload, bool retained) {
+    if (!ready) return false;
+
+    size_t topicLen = strlen(topic);
+    size_t payloadLen = strlen(payload);
+    if (topicLen >= OUTBOX_TOPIC_MAX || payloadLen >= OUTBOX_PAYLOAD_MAX) return false;
+
+    OutboxRecord rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.magic = OUTBOX_MAGIC;
+    rec.retained = retained ? 1 : 0;
+    rec.seq = head;
+    memcpy(rec.topic, topic, topicLen);
+    memcpy(rec.payload, payload, payloadLen);
+    rec.crc = crc32((const uint8_t*)&rec, offsetof(OutboxRecord, crc));
+
+    File file = SPIFFS.open(OUTBOX_FILE, "r+");
+    if (!file) return false;
+    file.seek((head % OUTBOX_SLOTS) * sizeof(OutboxRecord));
+    size_t written = file.write((const uint8_t*)&rec, sizeof(rec));
+    file.close();
+    if (written != sizeof(rec)) return false;
+
+    head++;
+    enqueued++;
+
+    // Очередь полна - самое старое сообщение только что перезаписано
+    if (head - tail > OUTBOX_SLOTS) {
+        tail = head - OUTBOX_SLOTS;
+        dropped++;
+    }
+    return true;
+}
+
+// ==================== ЧТЕНИЕ ====================
+bool MqttOutbox::readSlot(uint32_t seq, OutboxRecord& rec) {
+    File file = SPIFFS.open(OUTBOX_FILE, "r");
+    if (!file) return false;
+    file.seek((seq % OUTBOX_SLOTS) * sizeof(OutboxRecord));
+    size_t readBytes = file.read((uint8_t*)&rec, sizeof(rec));
+    file.close();
+
+    return readBytes == sizeof(rec) && rec.magic == OUTBOX_MAGIC && rec.seq == seq &&
+           crc32((const uint8_t*)&rec, offsetof(OutboxRecord, crc)) == rec.crc;
+}
+
+bool MqttOutbox::peek(OutboxRecord& rec) {
+    // Испорченные записи пропускаем, чтобы одна плохая запись не блокировала очередь
+    while (head != tail) {
+        if (readSlot(tail, rec)) return true;
+        corrupted++;
+        tail++;
+    }
+    return false;
+}
+
+void MqttOutbox::pop() {
+    if (head == tail) return;
+    tail++;
+    drained++;
+}
+
+void MqttOutbox::commit() {
+    if (!ready || tail == savedTail) return;
+    prefs.putUInt("acked", tail);
+    savedTail = tail;
+}
@@ -0,0 +1,97 @@
+// файл: MqttOutbox.h
+// Очередь исходящих MQTT сообщений во флеш-памяти
+// Переживает разрывы связи и перезагрузки, отправляется по порядку после подключения
+
+#ifndef MQTT_OUTBOX_H
+#define MQTT_OUTBOX_H
+
+#include "config.h"
+#include <SPIFFS.h>
+#include <Preferences.h>
+
+// ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
+#define OUTBOX_FILE "/outbox.bin"      // Файл очереди в SPIFFS
+#define OUTBOX_SLOTS 64                // Емкость очереди (сообщений)
+#define OUTBOX_TOPIC_MAX 64            // Максимальная длина топика (с нулем)
+#define OUTBOX_PAYLOAD_MAX 96          // Максимальная длина сообщения (с нулем)
+#define OUTBOX_BATCH 8                 // Сообщений за один проход отправки
+#define OUTBOX_MAGIC 0x4F42            // Признак записи ("OB")
+#define OUTBOX_PREFS "outbox"          // Пространство Preferences для номера подтвержденного сообщения
+
+/**
+ * Запись очереди фиксированного размера (один слот файла)
+ */
+struct OutboxRecord {
+    uint16_t magic;
+    uint8_t retained;
+    uint8_t reserved;
+    uint32_t seq;                        // Порядковый номер сообщения
+    char topic[OUTBOX_TOPIC_MAX];
+    char payload[OUTBOX_PAYLOAD_MAX];
+    uint32_t crc;                        // CRC32 всех полей выше
+};
+
+/**
+ * Кольцевая очередь во флеше
+ * - Файл из OUTBOX_SLOTS слотов фиксированного размера; сообщение с номером
+ *   seq всегда лежит в слоте seq % OUTBOX_SLOTS, поэтому запись идет по кругу
+ *   и каждый слот перезаписывается лишь раз за OUTBOX_SLOTS сообщений
+ * - Каждая запись защищена CRC32: оборванная при сбросе питания запись
+ *   при загрузке просто отбрасывается
+ * - Номер последнего отправленного сообщения хранится в Preferences и
+ *   сохраняется один раз на пачку отправленных, а не на каждое сообщение
+ * - При переполнении вытесняется самое старое сообщение
+ * - Используется только из сетевой задачи
+ */
+class MqttOutbox {
+private:
+    Preferences prefs;
+    bool ready;
+    uint32_t head;          // Номер следующего записываемого сообщения
+    uint32_t tail;          // Номер следующего отправляемого сообщения
+    uint32_t savedTail;     // Значение tail, сохраненное в Preferences
+
+    // Статистика
+    uint32_t enqueued;
+    uint32_t drained;
+    uint32_t dropped;       // Вытеснено при переполнении
+    uint32_t corrupted;     // Отброшено из-за неверной CRC
+
+    static uint32_t crc32(const uint8_t* data, size_t length);
+    bool readSlot(uint32_t seq, OutboxRecord& rec);
+
+public:
+    MqttOutbox();
+
+    /** Открыть файл очереди и восстановить неотправленные сообщения */
+    bool begin();
+
+    /**
+     * Поставить сообщение в очередь
+     * @return false - очередь недоступна или сообщение слишком длинное
+     */
+    bool push(const char* topic, const char* payload, bool retained);
+
+    /**
+     * Прочитать самое старое неотправленное сообщение
+     * @return false - очередь пуста
+     */
+    bool peek(OutboxRecord& rec);
+
+    /** Отметить прочитанное peek() сообщение как отправленное */
+    void pop();
+
+    /** Сохранить номер отправленного сообщения (после пачки) */
+    void commit();
+
+    // ==================== СТАТИСТИКА ====================
+    bool isReady() { return ready; }
+    bool isEmpty() { return head == tail; }
+    uint32_t getDepth() { return head - tail; }
+    uint32_t getEnqueued() { return enqueued; }
+    uint32_t getDrained() { return drained; }
+    uint32_t getDropped() { return dropped; }
+    uint32_t getCorrupted() { return corrupted; }
+};
+
+#endif
@@ -0,0 +1,161 @@
+// файл: MqttReconnect.h
+// Учет подключений к брокеру: когда пробовать снова, длительность попыток, причины неудач
+// Без Arduino и сети: время и случайное число передаются снаружи, поэтому тот же
+// учет работает в MQTTManager и в имитаторе парка (tools/fleet_sim.cpp)
+
+#ifndef MQTT_RECONNECT_H
+#define MQTT_RECONNECT_H
+
+#include <stdint.h>
+#include "Backoff.h"
+
+// ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
+#define MQTT_BACKOFF_MIN 1000          // Первая пауза перед повтором подключения (мс)
+#define MQTT_BACKOFF_MAX 60000         // Предел паузы между попытками (мс)
+#define MQTT_TCP_TIMEOUT 3000          // Таймаут TCP соединения с брокером (мс)
+#define MQTT_CONNACK_TIMEOUT 5         // Ожидание ответа на CONNECT (с)
+
+/**
+ * Состояние подключения
+ * Пока идет подключение, клиентом владеет задача подключения,
+ * в остальных состояниях - сетевая задача (loop())
+ */
+enum MqttConnState : uint8_t {
+    MQTT_CONN_DISCONNECTED,     // Ждем окончания паузы перед попыткой
+    MQTT_CONN_CONNECTING,       // Задача подключения выполняет DNS/TCP/CONNECT
+    MQTT_CONN_ESTABLISHED,      // Подключились, loop() еще не подписался
+    MQTT_CONN_CONNECTED         // Работаем
+};
+
+/**
+ * Причина последней неудачи подключения
+ */
+enum MqttFailReason : uint8_t {
+    MQTT_FAIL_NONE,
+    MQTT_FAIL_NO_CREDENTIALS,   // Не заданы логин/пароль
+    MQTT_FAIL_DNS,              // Не удалось разрешить имя брокера
+    MQTT_FAIL_TCP,              // TCP соединение отклонено или не установилось за таймаут
+    MQTT_FAIL_TIMEOUT,          // Брокер не ответил на CONNECT
+    MQTT_FAIL_REFUSED,          // Брокер отклонил CONNECT (код в getLastFailCode())
+    MQTT_FAIL_LOST,             // Соединение разорвалось во время работы
+    MQTT_FAIL_REASON_COUNT
+};
+
+inline const char* mqttConnStateName(MqttConnState state) {
+    switch (state) {
+        case MQTT_CONN_DISCONNECTED: return "disconnected";
+        case MQTT_CONN_CONNECTING: return "connecting";
+        case MQTT_CONN_ESTABLISHED: return "established";
+        case MQTT_CONN_CONNECTED: return "connected";
+    }
+    return "unknown";
+}
+
+inline const char* mqttFailReasonName(MqttFailReason reason) {
+    switch (reason) {
+        case MQTT_FAIL_NONE: return "none";
+        case MQTT_FAIL_NO_CREDENTIALS: return "no_credentials";
+        case MQTT_FAIL_DNS: return "dns";
+        case MQTT_FAIL_TCP: return "tcp";
+        case MQTT_FAIL_TIMEOUT: return "timeout";
+        case MQTT_FAIL_REFUSED: return "refused";
+        case MQTT_FAIL_LOST: return "lost";
+        case MQTT_FAIL_REASON_COUNT: break;
+    }
+    return "unknown";
+}
+
+/**
+ * Учет попыток подключения
+ * - После неудачи следующая попытка - через backoffDelay() от числа неудач подряд
+ * - Длительность попытки (DNS + TCP + CONNECT) - от beginAttempt() до attemptFinished()
+ * - Неудачи считаются по причинам: видно, отказывает брокер или не отвечает
+ * Попытку ведет задача подключения, а сетевая задача читает учет, только
+ * когда подключение не идет - общих данных в один момент у них нет
+ */
+class MqttReconnect {
+private:
+    uint32_t nextAttemptTime;          // Когда можно пробовать снова (millis, 32 бита как на ESP32)
+    uint32_t attemptStart;
+    unsigned long consecutiveFailures; // Неудач подряд (для экспоненциальной паузы)
+    unsigned long attempts;
+    unsigned long successes;
+    unsigned long lastLatency;         // Длительность последней попытки (мс)
+    unsigned long maxLatency;
+    MqttFailReason lastFailReason;
+    unsigned long failures[MQTT_FAIL_REASON_COUNT];
+
+public:
+    MqttReconnect()
+        : nextAttemptTime(0), attemptStart(0), consecutiveFailures(0), attempts(0),
+          successes(0), lastLatency(0), maxLatency(0), lastFailReason(MQTT_FAIL_NONE) {
+        for (int i = 0; i < MQTT_FAIL_REASON_COUNT; i++) failures[i] = 0;
+    }
+
+    // ==================== ПОПЫТКА ====================
+    bool isDue(uint32_t now) const { return (int32_t)(now - nextAttemptTime) >= 0; }
+
+    void beginAttempt(uint32_t now) {
+        attempts++;
+        attemptStart = now;
+    }
+
+    /** Попытка закончилась (успехом или нет): учесть ее длительность */
+    void attemptFinished(uint32_t now) {
+        lastLatency = (uint32_t)(now - attemptStart);
+        if (lastLatency > maxLatency) maxLatency = lastLatency;
+    }
+
+    void succeeded() {
+        successes++;
+        consecutiveFailures = 0;
+    }
+
+    /**
+     * Неудача попытки или разрыв работающего соединения
+     * @param randomValue - случайное 32-битное число (на устройстве - esp_random())
+     * @return пауза до следующей попытки (мс)
+     */
+    uint32_t failed(MqttFailReason reason, uint32_t now, uint32_t randomValue) {
+        lastFailReason = reason;
+        failures[reason]++;
+        consecutiveFailures++;
+
+        // Экспоненциальная пауза с пределом и случайной половиной (Backoff.h)
+        uint32_t delayMs = backoffDelay(consecutiveFailures, MQTT_BACKOFF_MIN, MQTT_BACKOFF_MAX, randomValue);
+        nextAttemptTime = now + delayMs;
+        return delayMs;
+    }
+
+    /** Подключаться нельзя (нет учетных данных): проверить снова через MQTT_BACKOFF_MAX */
+    void blocked(MqttFailReason reason, uint32_t now) {
+        lastFailReason = reason;
+        failures[reason]++;
+        postpone(now, MQTT_BACKOFF_MAX);
+    }
+
+    void postpone(uint32_t now, uint32_t delayMs) { nextAttemptTime = now + delayMs; }
+
+    /** Следующая попытка - сразу и с первой паузы после неудачи */
+    void retryNow(uint32_t now) {
+        consecutiveFailures = 0;
+        nextAttemptTime = now;
+    }
+
+    /** @return сколько осталось до следующей попытки (мс) */
+    unsigned long retryDelay(uint32_t now) const {
+        int32_t wait = (int32_t)(nextAttemptTime - now);
+        return wait > 0 ? wait : 0;
+    }
+
+    // ==================== СТАТИСТИКА ====================
+    unsigned long getAttempts() const { return attempts; }
+    unsigned long getSuccesses() const { return successes; }
+    unsigned long getConsecutiveFailures() const { return consecutiveFailures; }
+    unsigned long getLastLatency() const { return lastLatency; }
+    unsigned long getMaxLatency() const { return maxLatency; }
+    MqttFailReason getLastFailReason() const { return lastFailReason; }
+    unsigned long getFailures(MqttFailReason reason) const { return failures[reason]; }
+};
+
+#endif
@@ -0,0 +1,51 @@
+// файл: MqttTopics.h
+// Имя устройства, Client ID и топики MQTT
+// Чистые функции без Arduino: MAC и настройки передаются снаружи
+
+#ifndef MQTT_TOPICS_H
+#define MQTT_TOPICS_H
+
+#include "config.h"
+#include <stdio.h>
+
+// Имя устройства в топиках по умолчанию: /devices/pump/...
+#ifndef MQTT_DEVICE_NAME
+#define MQTT_DEVICE_NAME "pump"
+#endif
+
+#define MQTT_MAC_HEX_SIZE 13           // 12 шестнадцатеричных цифр и ноль
+
+/**
+ * MAC чипа строкой в порядке байтов, как его печатает WiFi.macAddress()
+ * @param efuseMac - ESP.getEfuseMac() (первый байт MAC - младший)
+ * @param out - буфер на MQTT_MAC_HEX_SIZE символов
+ */
+inline void mqttMacHex(uint64_t efuseMac, char* out) {
+    snprintf(out, MQTT_MAC_HEX_SIZE, "%02X%02X%02X%02X%02X%02X",
+             (unsigned)(uint8_t)efuseMac, (unsigned)(uint8_t)(efuseMac >> 8),
+             (unsigned)(uint8_t)(efuseMac >> 16), (unsigned)(uint8_t)(efuseMac >> 24),
+             (unsigned)(uint8_t)(efuseMac >> 32), (unsigned)(uint8_t)(efuseMac >> 40));
+}
+
+/**
+ * Имя с MAC через дефис (pump-A1B2C3D4E5F6) или без него
+ * Используется и для Client ID: у двух помп он не должен совпадать,
+ * иначе брокер отключает одну при подключении другой
+ * @param macHex - MAC строкой или nullptr (имя без MAC)
+ * @return false - имя не поместилось в буфер (обрезано)
+ */
+inline bool mqttDeviceName(char* out, size_t size, const char* name, const char* macHex) {
+    int len = macHex ? snprintf(out, size, "%s-%s", name, macHex) : snprintf(out, size, "%s", name);
+    return len >= 0 && (size_t)len < size;
+}
+
+/**
+ * Топик <корень>/<имя устройства>/<топик>
+ * @return false - топик не поместился в буфер (обрезан)
+ */
+inline bool mqttTopic(char* out, size_t size, const char* root, const char* device, const char* leaf) {
+    int len = snprintf(out, size, "%s/%s/%s", root, device, leaf);
+    return len >= 0 && (size_t)len < size;
+}
+
+#endif
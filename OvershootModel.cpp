@@ -0,0 +1,100 @@
+// файл: OvershootModel.cpp
+// Реализация модели перелива воды
+
+#include "OvershootModel.h"
+#include <EEPROM.h>
+#include "debug.h"
+
+// ==================== КОНСТРУКТОР ====================
+OvershootModel::OvershootModel() {
+    uncommittedFills = 0;
+    lastLearnTime = 0;
+    reset();
+}
+
+void OvershootModel::reset() {
+    memset(&params, 0, sizeof(params));
+    params.flag = OVERSHOOT_EEPROM_FLAG;
+}
+
+// ==================== ПРОГНОЗ ====================
+float OvershootModel::predict(float flowRate) {
+    if (!isTrained() || params.n <= 0) return WEIGHT_HYST;
+
+    float meanF = params.sumF / params.n;
+    float meanO = params.sumO / params.n;
+    float varF = params.sumFF / params.n - meanF * meanF;
+
+    // Если все наливы шли с одинаковой скоростью, наклон не определен -
+    // используем средний перелив
+    float slope = 0;
+    if (varF > 0.25f) {
+        slope = (params.sumFO / params.n - meanF * meanO) / varF;
+    }
+
+    float overshoot = meanO + slope * (flowRate - meanF);
+    if (overshoot < 0) overshoot = 0;
+    if (overshoot > OVERSHOOT_MAX) overshoot = OVERSHOOT_MAX;
+    return overshoot;
+}
+
+// ==================== ОБУЧЕНИЕ ====================
+void OvershootModel::learn(float flowRate, float overshoot, float finalError) {
+    params.n = params.n * OVERSHOOT_FORGET + 1;
+    params.sumF = params.sumF * OVERSHOOT_FORGET + flowRate;
+    params.sumO = params.sumO * OVERSHOOT_FORGET + overshoot;
+    params.sumFF = params.sumFF * OVERSHOOT_FORGET + flowRate * flowRate;
+    params.sumFO = params.sumFO * OVERSHOOT_FORGET + flowRate * overshoot;
+    params.fills++;
+    lastLearnTime = millis();
+
+    params.errCount++;
+    float delta = finalError - params.errMean;
+    params.errMean += delta / params.errCount;
+    params.errM2 += delta * (finalError - params.errMean);
+
+    DPRINTF("🎯 Перелив: %.1f г при %.1f г/с, ошибка налива %.1f г\n",
+            overshoot, flowRate, finalError);
+}
+
+float OvershootModel::getErrorStdDev() {
+    if (params.errCount < 2) return 0;
+    return sqrtf(params.errM2 / (params.errCount - 1));
+}
+
+// ==================== РАБОТА С EEPROM ====================
+void OvershootModel::saveToEEPROM(int addr) {
+    if (addr < 0 || addr + (int)sizeof(Params) > EEPROM_SIZE) return;
+
+    EEPROM.put(addr, params);
+    if (uncommittedFills < 255) uncommittedFills++;
+    if (uncommittedFills >= OVERSHOOT_COMMIT_FILLS) commitToEEPROM(addr, true);
+}
+
+bool OvershootModel::commitToEEPROM(int addr, bool force) {
+    if (uncommittedFills == 0) return false;
+    if (!force && millis() - lastLearnTime < OVERSHOOT_COMMIT_IDLE) return false;
+    if (addr < 0 || addr + (int)sizeof(Params) > EEPROM_SIZE) return false;
+
+    EEPROM.put(addr, params);
+    EEPROM.commit();
+    DPRINTF("🎯 Модель перелива сохранена в EEPROM (%u наливов)\n", uncommittedFills);
+    uncommittedFills = 0;
+    return true;
+}
+
+void OvershootModel::loadFromEEPROM(int addr) {
+    if (addr < 0 || addr + (int)sizeof(Params) > EEPROM_SIZE) return;
+
+    EEPROM.get(addr, params);
+
+    if (params.flag != OVERSHOOT_EEPROM_FLAG || isnan(params.n) || params.n < 0) {
+        reset();
+        LOG_INFO("🎯 Модель перелива не найдена, используется гистерезис по умолчанию");
+        return;
+    }
+
+    LOG_INFO("🎯 Модель перелива загружена из EEPROM");
+    DPRINTF("🎯   Наливов: %lu, ошибка %.1f ± %.1f г\n",
+            (unsigned long)params.fills, getErrorMean(), getErrorStdDev());
+}
@@ -0,0 +1,96 @@
+// файл: OvershootModel.h
+// Модель перелива воды после выключения помпы
+// Учится на каждом наливе и хранится в EEPROM
+
+#ifndef OVERSHOOT_MODEL_H
+#define OVERSHOOT_MODEL_H
+
+#include "config.h"
+
+// ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
+#define OVERSHOOT_MIN_FILLS 3          // Сколько наливов нужно до использования модели
+#define OVERSHOOT_MAX 150.0f           // Предел прогноза перелива (г)
+#define OVERSHOOT_FORGET 0.9f          // Коэффициент забывания старых наливов
+#define OVERSHOOT_SETTLE_MIN 2000      // Минимальное время успокоения после налива (мс)
+#define OVERSHOOT_SETTLE_TIMEOUT 10000 // Не успокоилось за это время - налив не учитываем (мс)
+#define OVERSHOOT_SETTLED_RATE 1.0f    // Скорость изменения веса, ниже которой вес успокоился (г/с)
+#define OVERSHOOT_EEPROM_FLAG 0xA5     // Флаг валидных данных модели в EEPROM
+#define OVERSHOOT_COMMIT_FILLS 10      // Запись во флеш не чаще, чем раз в столько наливов
+#define OVERSHOOT_COMMIT_IDLE 60000    // ...или после такой паузы без наливов (мс)
+
+/**
+ * Модель перелива: overshoot = a + b * flow
+ * - flow - скорость потока (г/с) в момент выключения помпы
+ * - overshoot - сколько воды пришло после выключения (вода в трубке + задержка фильтра)
+ * Коэффициенты считаются взвешенной регрессией по прошлым наливам
+ * с экспоненциальным забыванием, чтобы модель следила за износом помпы и трубки.
+ * Дополнительно ведется статистика итоговой ошибки налива (среднее и СКО).
+ */
+class OvershootModel {
+private:
+    // Данные, сохраняемые в EEPROM целиком
+    struct Params {
+        uint8_t flag;
+        uint8_t reserved[3];
+        uint32_t fills;        // Всего учтенных наливов
+        float n;               // Взвешенное количество наблюдений
+        float sumF, sumO;      // Взвешенные суммы скорости и перелива
+        float sumFF, sumFO;    // Взвешенные суммы для регрессии
+        uint32_t errCount;     // Статистика итоговой ошибки (алгоритм Уэлфорда)
+        float errMean;
+        float errM2;
+    };
+
+    Params params;
+    uint8_t uncommittedFills;      // Наливы, учтенные только в буфере EEPROM
+    unsigned long lastLearnTime;
+
+public:
+    // ==================== КОНСТРУКТОР ====================
+    OvershootModel();
+
+    // ==================== ПРОГНОЗ И ОБУЧЕНИЕ ====================
+    /**
+     * Прогноз перелива при заданной скорости потока
+     * @return граммы, на которые нужно выключить помпу раньше цели
+     *         (WEIGHT_HYST, пока модель не обучена)
+     */
+    float predict(float flowRate);
+
+    /**
+     * Учесть завершенный налив
+     * @param flowRate - скорость потока в момент выключения (г/с)
+     * @param overshoot - прирост веса после выключения (г)
+     * @param finalError - итоговый вес минус целевой (г)
+     */
+    void learn(float flowRate, float overshoot, float finalError);
+
+    void reset();
+
+    // ==================== РАБОТА С EEPROM ====================
+    /**
+     * Положить параметры в буфер EEPROM. Во флеш они записываются
+     * раз в OVERSHOOT_COMMIT_FILLS наливов: commit() стирает сектор
+     * и надолго занимает ядро, делать это после каждого налива незачем.
+     * При внезапной перезагрузке теряются только последние наливы -
+     * модель дообучится на следующих
+     */
+    void saveToEEPROM(int addr);
+
+    /**
+     * Записать во флеш наливы, оставшиеся в буфере, если после последнего
+     * прошло OVERSHOOT_COMMIT_IDLE мс (или сразу, если force)
+     * @return true, если была запись
+     */
+    bool commitToEEPROM(int addr, bool force = false);
+    void loadFromEEPROM(int addr);
+
+    // ==================== СТАТИСТИКА ====================
+    bool isTrained() { return params.fills >= OVERSHOOT_MIN_FILLS; }
+    unsigned long getFills() { return params.fills; }
+    float getErrorMean() { return params.errCount ? params.errMean : 0; }
+    float getErrorStdDev();
+    uint8_t getUncommittedFills() { return uncommittedFills; }
+};
+
+#endif
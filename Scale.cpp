@@ -13,12 +13,16 @@ Scale::Scale() :
     calibrationFactor(DEFAULT_FACTOR),
     lastReadWeight(0),
     lastStableReadTime(0),
-    readIndex(0),
     eepromAddr(0),
     isCalibrated(false),
-    factorCalibrated(false)
+    factorCalibrated(false),
+    samplingTask(nullptr),
+    sensorMutex(nullptr),
+    lastRawValue(0),
+    lastSampleTime(0),
+    samplesProcessed(0),
+    maxSampleLatency(0)
 {
-    for (int i = 0; i < STABLE_READINGS; i++) readings[i] = 0;
     DPRINTLN("⚖️ Весы: объект создан");
 }
 
@@ -30,14 +34,88 @@ bool Scale::begin() {
     LOG_INFO("⚖️ Весы инициализированы");
     DPRINTF("⚖️ Коэффициент по умолчанию: %f\n", calibrationFactor);
     
+    if (!startSampling()) {
+        LOG_WARN("⚖️ Задача опроса HX711 не запущена, чтение из основного цикла");
+    }
+    
     return true;
 }
 
 void Scale::tare() {
+    lockSensor();
     scale.tare();
+    unlockSensor();
+    filter.reset();
+    flow.reset();
     LOG_OK("⚖️ Тарирование выполнено");
 }
 
+// ==================== ЗАДАЧА ОПРОСА HX711 ====================
+bool Scale::startSampling() {
+    if (samplingTask) return true;
+    
+    if (!sensorMutex) {
+        sensorMutex = xSemaphoreCreateMutex();
+        if (!sensorMutex) return false;
+    }
+    
+    lastSampleTime.store(millis());
+    
+    BaseType_t created = xTaskCreatePinnedToCore(
+        samplingTaskEntry, "hx711", HX711_TASK_STACK, this,
+        HX711_TASK_PRIORITY, &samplingTask, HX711_TASK_CORE);
+    
+    if (created != pdPASS) {
+        samplingTask = nullptr;
+        return false;
+    }
+    
+    LOG_INFO("⚖️ Задача опроса HX711 запущена");
+    return true;
+}
+
+void Scale::samplingTaskEntry(void* arg) {
+    static_cast<Scale*>(arg)->samplingLoop();
+}
+
+void Scale::samplingLoop() {
+    // Единственный производитель для samples: читаем датчик, как только
+    // он готов, и не тратим время основного цикла на ожидание АЦП
+    for (;;) {
+        if (xSemaphoreTake(sensorMutex, portMAX_DELAY) == pdTRUE) {
+            if (scale.available()) {
+                ScaleSample sample;
+                sample.raw = scale.read();
+                sample.timeMs = millis();
+                xSemaphoreGive(sensorMutex);
+                
+                samples.push(sample);
+                lastRawValue.store(sample.raw);
+                lastSampleTime.store(sample.timeMs);
+            } else {
+                xSemaphoreGive(sensorMutex);
+            }
+        }
+        vTaskDelay(pdMS_TO_TICKS(HX711_POLL_INTERVAL));
+    }
+}
+
+void Scale::lockSensor() {
+    if (sensorMutex) xSemaphoreTake(sensorMutex, portMAX_DELAY);
+}
+
+void Scale::unlockSensor() {
+    if (sensorMutex) xSemaphoreGive(sensorMutex);
+}
+
+long Scale::getRawADC() {
+    // Пока работает задача опроса, датчик читает только она
+    if (samplingTask) return lastRawValue.load();
+    
+    if (scale.available()) return scale.read();
+    return 0;
+}
+
 // ==================== КАЛИБРОВКА КОЭФФИЦИЕНТА ====================
 bool Scale::calibrateFactorViaSerial() {
     Serial.println("\n=== РЕЖИМ КАЛИБРОВКИ ДАТЧИКА ===");
@@ -51,9 +129,7 @@ bool Scale::calibrateFactorViaSerial() {
         
         unsigned long startTime = millis();
         while (millis() - startTime < 5000) {
-            if (scale.available()) {
-                Serial.printf("\rСырое значение АЦП: %8ld", scale.read());
-            }
+            Serial.printf("\rСырое значение АЦП: %8ld", getRawADC());
             delay(100);
         }
         Serial.println("\n");
@@ -142,62 +218,99 @@ void Scale::setCalibrationFactor(float factor) {
 }
 
 // ==================== ВСПОМОГАТЕЛЬНЫЕ ====================
-long Scale::getStableRawValue(int samples) {
-    long sum = 0;
+long Scale::getStableRawValue(int sampleCount) {
+    long long sum = 0;
     int count = 0;
     
-    for (int i = 0; i < samples; i++) {
-        if (scale.available()) {
-            sum += scale.read();
+    // Ждем не дольше двойного времени поступления отсчетов плюс таймаут датчика
+    unsigned long start = millis();
+    unsigned long timeout = (unsigned long)sampleCount * 2000 / HX711_RATE + HX711_SAMPLE_TIMEOUT;
+    
+    while (count < sampleCount && millis() - start < timeout) {
+        ScaleSample sample;
+        bool got = false;
+        
+        if (samplingTask) {
+            // Задачу опроса не останавливаем: берем ее отсчеты из буфера,
+            // отсчеты, накопленные до вызова, в среднее не входят
+            got = samples.pop(sample);
+            if (got) {
+                processSample(sample);
+                got = (long)(sample.timeMs - start) >= 0;
+            }
+        } else if (scale.available()) {
+            sample.raw = scale.read();
+            got = true;
+        }
+        
+        if (got) {
+            sum += sample.raw;
             count++;
+        } else {
+            delay(HX711_POLL_INTERVAL);
         }
-        delay(50);
     }
     
-    if (count > 0) return sum / count;
+    if (count < sampleCount) {
+        DPRINTF("⚖️ Получено %d из %d отсчетов для усреднения\n", count, sampleCount);
+    }
+    if (count > 0) return (long)(sum / count);
     return 0;
 }
 
 // ==================== ОБНОВЛЕНИЕ И ФИЛЬТРАЦИЯ ====================
 bool Scale::update() {
+    if (samplingTask) {
+        // Забираем все накопленные отсчеты пачками
+        ScaleSample batch[HX711_BATCH_SIZE];
+        size_t count;
+        while ((count = samples.popBatch(batch, HX711_BATCH_SIZE)) > 0) {
+            for (size_t i = 0; i < count; i++) {
+                processSample(batch[i]);
+            }
+        }
+        
+        if ((long)(millis() - lastSampleTime.load()) > (long)HX711_SAMPLE_TIMEOUT) {
+            currentWeight = 0;
+            return false;
+        }
+        return true;
+    }
+    
     if (!scale.available()) {
         currentWeight = 0;
         return false;
     }
 
-    long rawValue = scale.read();
-    float newRaw = rawValue * calibrationFactor;
-    
-    if (newRaw < 0) newRaw = 0;
-    
-    if (currentWeight > 0 && fabs(newRaw - currentWeight) > MAX_WEIGHT_JUMP) {
-        DPRINTF("⚖️ Скачок веса: %.1f -> %.1f (игнорируется)\n", currentWeight, newRaw);
-        return true;
-    }
-
-    readings[readIndex] = newRaw;
-    readIndex = (readIndex + 1) % STABLE_READINGS;
+    ScaleSample sample;
+    sample.raw = scale.read();
+    sample.timeMs = millis();
+    processSample(sample);
+    return true;
+}
 
-    float sorted[STABLE_READINGS];
-    memcpy(sorted, readings, sizeof(readings));
+void Scale::processSample(const ScaleSample& sample) {
+    samplesProcessed++;
+    unsigned long latency = millis() - sample.timeMs;
+    if (latency > maxSampleLatency) maxSampleLatency = latency;
     
-    for (int i = 1; i < STABLE_READINGS; i++) {
-        float key = sorted[i];
-        int j = i - 1;
-        while (j >= 0 && sorted[j] > key) {
-            sorted[j + 1] = sorted[j];
-            j--;
-        }
-        sorted[j + 1] = key;
-    }
+    float grams = sample.raw * calibrationFactor;
     
-    currentWeight = sorted[STABLE_READINGS / 2];
+    if (!filter.apply(grams)) {
+        DPRINTF("⚖️ Отсчет отброшен фильтром: %.1f (текущий %.1f)\n", grams, currentWeight);
+        return;
+    }
 
-    return true;
+    currentWeight = grams;
+    flow.addSample(sample.timeMs, grams);
 }
 
 // ==================== ПРОВЕРКИ СОСТОЯНИЯ ====================
 bool Scale::isReady() {
+    if (samplingTask) {
+        return factorCalibrated && 
+               (long)(millis() - lastSampleTime.load()) <= (long)HX711_SAMPLE_TIMEOUT;
+    }
     return factorCalibrated && scale.available();
 }
 
@@ -6,6 +6,13 @@
 
 #include "config.h"
 #include <GyverHX711.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include "SpscRingBuffer.h"
+#include "WeightFilter.h"
+#include "FlowEstimator.h"
 
 // ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
 #define STABLE_WEIGHT_THRESHOLD 5.0f    // Порог стабильности веса (граммы)
@@ -13,6 +20,37 @@
 #define MAX_WEIGHT_JUMP 500.0f          // Максимальный скачок веса (защита от выбросов)
 #define EEPROM_FLAG_VALUE 0xAA           // Флаг валидных данных в EEPROM
 #define DEFAULT_FACTOR 0.00042f          // Коэффициент по умолчанию
+#define HX711_RATE 80                    // Частота отсчетов HX711 (SPS, вывод RATE = 1)
+#define SCALE_MEDIAN_WINDOW_MS 250       // Окно медианного фильтра по времени (мс)
+// Окно в отсчетах (нечетное): медиана подавляет выбросы короче половины окна
+// и задерживает вес на ту же половину окна
+#define SCALE_MEDIAN_WINDOW ((HX711_RATE * SCALE_MEDIAN_WINDOW_MS / 1000) | 1)
+
+// ==================== ЦЕПОЧКА ФИЛЬТРОВ ====================
+// Собирается на этапе компиляции (см. WeightFilter.h), для своего чайника
+// и датчика можно задать другую цепочку в config.h, например:
+//   #define SCALE_FILTER_CHAIN FilterChain<Clamp<>, HampelReject<9>, Median<15>, IIR<200>, Deadband<50>>
+#ifndef SCALE_FILTER_CHAIN
+#define SCALE_FILTER_CHAIN FilterChain<Clamp<>, JumpReject<(int)MAX_WEIGHT_JUMP, 8>, Median<SCALE_MEDIAN_WINDOW>>
+#endif
+typedef SCALE_FILTER_CHAIN WeightFilterChain;
+
+// ==================== ЗАДАЧА ОПРОСА HX711 ====================
+#define HX711_RING_SIZE 64               // Емкость буфера отсчетов (~0.8 с при 80 SPS)
+#define HX711_BATCH_SIZE 16              // Сколько отсчетов забирать за один проход
+#define HX711_POLL_INTERVAL 2            // Период опроса готовности HX711 (мс)
+#define HX711_SAMPLE_TIMEOUT 500         // Нет новых отсчетов дольше - датчик не отвечает (мс)
+#define HX711_TASK_STACK 2048            // Размер стека задачи опроса
+#define HX711_TASK_PRIORITY 5            // Приоритет выше loop(), чтобы не терять отсчеты
+#define HX711_TASK_CORE 1                // Ядро для задачи опроса
+
+/**
+ * Один отсчет HX711 с отметкой времени
+ */
+struct ScaleSample {
+    uint32_t timeMs;    // millis() в момент чтения
+    long raw;           // Сырое значение АЦП (с учетом тары)
+};
 
 class Scale {
   private:
@@ -27,14 +65,28 @@ class Scale {
     unsigned long lastStableReadTime;
     
     // ==================== ДЛЯ ФИЛЬТРАЦИИ ====================
-    static const int STABLE_READINGS = 5;
-    float readings[STABLE_READINGS];
-    int readIndex;
+    WeightFilterChain filter;
+    FlowEstimator flow;                     // Скорость потока по отфильтрованным отсчетам
     
     // ==================== ДЛЯ РАБОТЫ С EEPROM ====================
     bool isCalibrated;
     bool factorCalibrated;
     int eepromAddr;
+    
+    // ==================== ЗАДАЧА ОПРОСА HX711 ====================
+    SpscRingBuffer<ScaleSample, HX711_RING_SIZE> samples;
+    TaskHandle_t samplingTask;
+    SemaphoreHandle_t sensorMutex;          // Защищает прямой доступ к HX711 (тара)
+    std::atomic<long> lastRawValue;         // Последний отсчет (для отладочных команд)
+    std::atomic<uint32_t> lastSampleTime;   // Время последнего отсчета от задачи
+    unsigned long samplesProcessed;
+    unsigned long maxSampleLatency;         // Максимальная задержка отсчета до обработки (мс)
+    
+    static void samplingTaskEntry(void* arg);
+    void samplingLoop();
+    void processSample(const ScaleSample& sample);
+    void lockSensor();
+    void unlockSensor();
 
   public:
     // ==================== КОНСТРУКТОР ====================
@@ -63,15 +115,9 @@ class Scale {
     float getEmptyWeight() { return emptyWeight; }
     float getCurrentWeight() { return currentWeight; }
     float getCalibrationFactor() { return calibrationFactor; }
-    float getRawWeight() {
-        if (!scale.available()) return 0;
-        long rawValue = scale.read();
-        return rawValue * calibrationFactor;
-    }
-    long getRawADC() {
-        if (scale.available()) return scale.read();
-        return 0;
-    }
+    FlowEstimator& getFlow() { return flow; }
+    float getRawWeight() { return getRawADC() * calibrationFactor; }
+    long getRawADC();
 
     // ==================== ПРОВЕРКИ СОСТОЯНИЯ ====================
     bool update();
@@ -81,7 +127,28 @@ class Scale {
     bool isCalibrationDone() { return isCalibrated; }
     
     // ==================== ВСПОМОГАТЕЛЬНЫЕ ====================
-    long getStableRawValue(int samples = 10);
+    /**
+     * Среднее сырое значение АЦП по нескольким новым отсчетам
+     * - При работающей задаче опроса отсчеты берутся из кольцевого буфера,
+     *   датчик не блокируется, и все отсчеты проходят обычную обработку
+     * - Вызывать только из задачи, которая вызывает update() (единственный
+     *   потребитель буфера)
+     * @param sampleCount - количество отсчетов (20 отсчетов = 250 мс при 80 SPS)
+     * @return среднее значение, 0 - отсчетов не было
+     */
+    long getStableRawValue(int sampleCount = 10);
+    
+    // ==================== ЗАДАЧА ОПРОСА HX711 ====================
+    /**
+     * Запустить задачу, которая читает HX711 на полной частоте (80 SPS)
+     * и складывает отсчеты в кольцевой буфер. update() затем забирает их пачками.
+     * @return false - задачу создать не удалось, update() читает датчик напрямую
+     */
+    bool startSampling();
+    bool isSampling() { return samplingTask != nullptr; }
+    unsigned long getSamplesProcessed() { return samplesProcessed; }
+    unsigned long getSamplesDropped() { return samples.getDropped(); }
+    unsigned long getMaxSampleLatency() { return maxSampleLatency; }
 };
 
 #endif
\ No newline at end of file
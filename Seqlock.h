@@ -0,0 +1,63 @@
+// файл: Seqlock.h
+// Публикация структуры одним писателем для многих читателей без блокировок
+// Используется для снимка состояния системы (SystemSnapshot)
+
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+/**
+ * Seqlock (sequence lock)
+ * - Писатель один: перед записью делает счетчик нечетным, после - четным
+ * - Читатель копирует данные и повторяет чтение, если счетчик был нечетным
+ *   или изменился за время копирования - так копия всегда согласована
+ * - Читатель никогда не блокирует писателя; писатель не ждет читателей
+ * - T должен быть тривиально копируемым (копируется через memcpy)
+ */
+template <typename T>
+class Seqlock {
+private:
+    std::atomic<uint32_t> sequence;
+    T data;
+
+public:
+    Seqlock() : sequence(0) {
+        memset(&data, 0, sizeof(data));
+    }
+
+    /** Опубликовать новое значение (только из задачи-писателя) */
+    void write(const T& value) {
+        uint32_t seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&data, &value, sizeof(T));
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * Получить согласованную копию (из любой задачи)
+     * Повторяет чтение, пока запись не завершится - писатель пишет
+     * быстрее, чем за микросекунду, поэтому повторы редки
+     */
+    void read(T& out) const {
+        for (;;) {
+            uint32_t before = sequence.load(std::memory_order_acquire);
+            if (before & 1) continue;
+
+            memcpy(&out, &data, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (sequence.load(std::memory_order_relaxed) == before) return;
+        }
+    }
+
+    /** @return количество выполненных записей */
+    uint32_t getWrites() const {
+        return sequence.load(std::memory_order_acquire) / 2;
+    }
+};
+
+#endif
@@ -6,7 +6,8 @@
 
 SerialCommandHandler::SerialCommandHandler(Scale& s, PumpController& p, Display& d, 
                                            StateMachine* sm, WiFiManager& wm, MQTTManager* mqm)
-    : scale(s), pump(p), display(d), stateMachine(sm), wifiManager(wm), mqttManager(mqm) {
+    : scale(s), pump(p), display(d), stateMachine(sm), wifiManager(wm), mqttManager(mqm),
+      eventQueue(nullptr), networkQueue(nullptr), controlScheduler(nullptr), networkScheduler(nullptr) {
     DPRINTLN("📟 SerialCommandHandler: инициализирован");
 }
 
@@ -34,6 +35,7 @@ void SerialCommandHandler::printHelp() {
     Serial.println("  pump on/off               - Вкл/выкл помпу принудительно");
     Serial.println("  servo kettle/idle         - Переместить серво");
     Serial.println("  stats                     - Статистика и память");
+    Serial.println("  stats reset               - Сбросить статистику задач");
     Serial.println("  reset factor              - Сбросить коэффициент");
     Serial.println("  reset wifi                - Сбросить WiFi настройки");
     Serial.println("  reboot / перезагрузка     - Перезагрузить устройство");
@@ -112,10 +114,46 @@ void SerialCommandHandler::handleStatus() {
     Serial.printf("MQTT подключен: %s\n", mqttManager ? 
                  (mqttManager->isConnected() ? "ДА" : "НЕТ") : "Н/Д");
     if (mqttManager) {
+        Serial.printf("Client ID: %s, устройство: %s\n",
+                     mqttManager->getClientId(), mqttManager->getDeviceName());
         Serial.printf("Отправлено: %lu, Ошибок: %lu, Попыток: %lu\n", 
                      mqttManager->getMessagesSent(),
                      mqttManager->getMessagesFailed(),
                      mqttManager->getReconnectAttempts());
+        Serial.printf("Подключение: %s, успешных: %lu, последнее за %lu мс (макс. %lu мс)\n",
+                     MQTTManager::connStateName(mqttManager->getConnState()),
+                     mqttManager->getConnectSuccesses(),
+                     mqttManager->getLastConnectLatency(), mqttManager->getMaxConnectLatency());
+        Serial.printf("Неудачи: dns %lu, tcp %lu, timeout %lu, refused %lu, lost %lu\n",
+                     mqttManager->getConnectFailures(MQTT_FAIL_DNS),
+                     mqttManager->getConnectFailures(MQTT_FAIL_TCP),
+                     mqttManager->getConnectFailures(MQTT_FAIL_TIMEOUT),
+                     mqttManager->getConnectFailures(MQTT_FAIL_REFUSED),
+                     mqttManager->getConnectFailures(MQTT_FAIL_LOST));
+        Serial.printf("Принято: %lu, обработка %lu мкс (макс. %lu мкс), обращений к куче: %lu\n",
+                     mqttManager->getMessagesReceived(),
+                     (unsigned long)mqttManager->getLastReceiveTime(),
+                     (unsigned long)mqttManager->getMaxReceiveTime(),
+                     mqttManager->getReceiveHeapOps());
+        Serial.printf("Команды: повторов %lu, подтверждений отправлено %lu\n",
+                     mqttManager->getCommandsDuplicate(), mqttManager->getAcksSent());
+        Serial.printf("Уровень воды: публикаций %lu, подавлено колебаний %lu\n",
+                     mqttManager->getWaterStatePublishes(),
+                     (unsigned long)mqttManager->getWaterStateSuppressed());
+        Serial.printf("Телеметрия: отправлено %lu, последнее сообщение %u байт\n",
+                     mqttManager->getTelemetrySent(),
+                     (unsigned)mqttManager->getLastTelemetrySize());
+        MqttOutbox& outbox = mqttManager->getOutbox();
+        Serial.printf("Очередь во флеше: %lu (поставлено %lu, отправлено %lu, вытеснено %lu, CRC ошибок %lu)\n",
+                     (unsigned long)outbox.getDepth(), (unsigned long)outbox.getEnqueued(),
+                     (unsigned long)outbox.getDrained(), (unsigned long)outbox.getDropped(),
+                     (unsigned long)outbox.getCorrupted());
+        Serial.printf("Скорость отправки очереди: %.0f сообщений/с\n", mqttManager->getOutboxDrainRate());
+        if (mqttManager->getLastFailReason() != MQTT_FAIL_NONE) {
+            Serial.printf("Последняя ошибка: %s (код=%d), повтор через %lu мс\n",
+                         MQTTManager::failReasonName(mqttManager->getLastFailReason()),
+                         mqttManager->getLastFailCode(), mqttManager->getRetryDelay());
+        }
     }
     
     // Калибровка
@@ -127,21 +165,25 @@ void SerialCommandHandler::handleStatus() {
     Serial.printf("Чайник откалиброван: %s\n", 
                  scale.isCalibrationDone() ? "ДА" : "НЕТ");
     
-    // Текущие показания
-    Serial.println("\n--- Текущие показания ---");
-    Serial.printf("Чайник на месте: %s\n", 
-                 scale.isKettlePresent() ? "ДА" : "НЕТ");
-    Serial.printf("Текущий вес: %.1f г\n", scale.getCurrentWeight());
-    
-    float waterVolume = scale.getCurrentWeight() - scale.getEmptyWeight();
-    if (waterVolume < 0) waterVolume = 0;
-    Serial.printf("Объём воды: %.0f мл\n", waterVolume);
-    Serial.printf("Кружек: %d\n", (int)(waterVolume / CUP_VOLUME));
-    
-    // Состояние автомата
-    Serial.println("\n--- Состояние автомата ---");
+    // Текущие показания - из одного снимка, чтобы вес, объем и режим были согласованы
     if (stateMachine) {
-        switch (stateMachine->getCurrentStateEnum()) {
+        SystemSnapshot snap;
+        stateMachine->readSnapshot(snap);
+        
+        Serial.println("\n--- Текущие показания ---");
+        Serial.printf("Снимок: версия %lu, %lu мс назад\n",
+                     (unsigned long)snap.version, (unsigned long)(millis() - snap.timestamp));
+        Serial.printf("Чайник на месте: %s\n", 
+                     snap.kettlePresent ? "ДА" : "НЕТ");
+        Serial.printf("Текущий вес: %.1f г\n", snap.currentWeight);
+        Serial.printf("Объём воды: %.0f мл\n", snap.waterVolume);
+        Serial.printf("Кружек: %d\n", (int)(snap.waterVolume / CUP_VOLUME));
+        Serial.printf("Скорость потока: %.1f г/с (σ² = %.3f)\n", 
+                     snap.flowRate, snap.flowVariance);
+        
+        // Состояние автомата
+        Serial.println("\n--- Состояние автомата ---");
+        switch (snap.state) {
             case ST_IDLE: Serial.println("Режим: ОЖИДАНИЕ"); break;
             case ST_FILLING: Serial.println("Режим: НАЛИВ"); break;
             case ST_CALIBRATION: Serial.println("Режим: КАЛИБРОВКА"); break;
@@ -223,6 +265,54 @@ void SerialCommandHandler::handleStats() {
     Serial.printf("PSRAM размер: %d байт\n", ESP.getPsramSize());
     Serial.printf("Свободно PSRAM: %d байт\n", ESP.getFreePsram());
     #endif
+
+    Serial.println("\n=== ВЕСЫ (HX711) ===");
+    Serial.printf("Задача опроса: %s\n", scale.isSampling() ? "работает" : "не запущена");
+    Serial.printf("Обработано отсчетов: %lu\n", scale.getSamplesProcessed());
+    Serial.printf("Потеряно отсчетов: %lu\n", scale.getSamplesDropped());
+    Serial.printf("Макс. задержка отсчета: %lu мс\n", scale.getMaxSampleLatency());
+    
+    if (stateMachine) {
+        OvershootModel& overshoot = stateMachine->getOvershootModel();
+        Serial.println("\n=== ТОЧНОСТЬ НАЛИВА ===");
+        Serial.printf("Учтено наливов: %lu (модель %s, ждут записи во флеш: %u)\n", overshoot.getFills(),
+                     overshoot.isTrained() ? "обучена" : "обучается", overshoot.getUncommittedFills());
+        Serial.printf("Прогноз перелива при текущем потоке: %.1f г\n",
+                     overshoot.predict(scale.getFlow().getRate()));
+        Serial.printf("Ошибка итогового объема: %.1f ± %.1f г\n",
+                     overshoot.getErrorMean(), overshoot.getErrorStdDev());
+        
+        Serial.println("\n=== АВТОМАТ СОСТОЯНИЙ ===");
+        Serial.printf("Переходов: %lu\n", stateMachine->getTransitionCount());
+        Serial.printf("Команда -> помпа: %lu мс (макс. %lu мс)\n",
+                     stateMachine->getLastActuationLatency(), stateMachine->getMaxActuationLatency());
+    }
+    
+    if (eventQueue) {
+        Serial.println("\n=== ОЧЕРЕДЬ СОБЫТИЙ ===");
+        Serial.printf("Принято: %lu, потеряно: %lu, в очереди: %lu\n",
+                     (unsigned long)eventQueue->getPosted(), (unsigned long)eventQueue->getDropped(),
+                     (unsigned long)eventQueue->getPending());
+        Serial.printf("Макс. задержка обработки: %lu мкс\n", (unsigned long)eventQueue->getMaxLatency());
+    }
+    
+    TaskScheduler* schedulers[] = { controlScheduler, networkScheduler };
+    const char* titles[] = { "УПРАВЛЕНИЕ, ЯДРО 1", "СЕТЬ, ЯДРО 0" };
+    for (uint8_t k = 0; k < 2; k++) {
+        TaskScheduler* scheduler = schedulers[k];
+        if (!scheduler) continue;
+        
+        Serial.printf("\n=== ЗАДАЧИ: %s ===\n", titles[k]);
+        Serial.println("Задача    Период  Запусков  Сред.мкс  Макс.мкс  Jitter,мкс  Промахи");
+        for (uint8_t i = 0; i < scheduler->getTaskCount(); i++) {
+            const ScheduledTask& task = scheduler->getTask(i);
+            Serial.printf("%-9s %4lu мс %9lu %9lu %9lu %11lu %8lu\n", task.name,
+                         (unsigned long)(task.period / 1000), (unsigned long)task.runs,
+                         (unsigned long)scheduler->getAverageRunTime(i),
+                         (unsigned long)task.maxRunTime, (unsigned long)task.maxJitter,
+                         (unsigned long)task.misses);
+        }
+    }
 }
 
 void SerialCommandHandler::handleResetFactor() {
@@ -237,21 +327,35 @@ void SerialCommandHandler::handleResetFactor() {
 
 void SerialCommandHandler::handleResetWifi() {
     if (confirmAction("\n=== СБРОС WiFi НАСТРОЕК ===")) {
-        wifiManager.resetSettings();
+        postNetworkEvent(EVT_WIFI_RESET);
     } else {
         Serial.println("Сброс отменён");
     }
 }
 
 void SerialCommandHandler::handleTestMqtt(int mode) {
-    if (stateMachine) {
+    if (eventQueue) {
+        if (eventQueue->post(EVT_MQTT_COMMAND, mode)) {
+            Serial.printf("Тестовая MQTT команда %d отправлена\n", mode);
+        } else {
+            Serial.println("Очередь событий переполнена");
+        }
+    } else if (stateMachine) {
         stateMachine->handleMqttCommand(mode);
         Serial.printf("Тестовая MQTT команда %d отправлена\n", mode);
     }
 }
 
 void SerialCommandHandler::handleConfig() {
-    wifiManager.startConfigPortal();
+    postNetworkEvent(EVT_CONFIG_PORTAL);
+}
+
+void SerialCommandHandler::postNetworkEvent(EventType type) {
+    // Serial обрабатывается на ядре 1, а wifiManager.loop() крутится на ядре 0:
+    // настройки Wi-Fi меняет сетевая задача, получив событие
+    if (!networkQueue || !networkQueue->post(type)) {
+        Serial.println("Сетевая задача занята, повторите команду");
+    }
 }
 
 void SerialCommandHandler::handleReboot() {
@@ -313,6 +417,11 @@ void SerialCommandHandler::handle() {
     else if (lowerCommand == "stats") {
         handleStats();
     }
+    else if (lowerCommand == "stats reset") {
+        if (controlScheduler) controlScheduler->requestReset();
+        if (networkScheduler) networkScheduler->requestReset();
+        Serial.println("Статистика задач сброшена");
+    }
     else if (lowerCommand == "reset factor" || lowerCommand == "reset калибровка" || 
              lowerCommand == "сброс фактор") {
         handleResetFactor();
@@ -13,6 +13,8 @@
 #include "StateMachine.h"
 #include "WiFiManager.h"
 #include "MQTTManager.h"
+#include "EventQueue.h"
+#include "TaskScheduler.h"
 
 class SerialCommandHandler {
 private:
@@ -23,6 +25,10 @@ private:
     StateMachine* stateMachine;
     WiFiManager& wifiManager;
     MQTTManager* mqttManager;
+    EventQueue* eventQueue;
+    EventQueue* networkQueue;          // События сетевой задачи: Wi-Fi меняется только на ядре 0
+    TaskScheduler* controlScheduler;   // Ядро 1: управление, дисплей, Serial
+    TaskScheduler* networkScheduler;   // Ядро 0: сеть
     
     // Приватные методы обработки команд
     void handleCalibrate();
@@ -46,6 +52,7 @@ private:
     
     // Вспомогательные методы
     bool confirmAction(const String& prompt);
+    void postNetworkEvent(EventType type);
     void printWelcome();
     void printSeparator();
 
@@ -54,6 +61,18 @@ public:
     SerialCommandHandler(Scale& s, PumpController& p, Display& d, 
                          StateMachine* sm, WiFiManager& wm, MQTTManager* mqm);
     
+    // Очередь событий: тестовые команды идут тем же путем, что и MQTT
+    void setEventQueue(EventQueue* q) { eventQueue = q; }
+    
+    // Очередь сетевой задачи: сброс Wi-Fi и портал настройки
+    void setNetworkQueue(EventQueue* q) { networkQueue = q; }
+    
+    // Планировщики задач обоих ядер (статистика в stats)
+    void setSchedulers(TaskScheduler* control, TaskScheduler* network) {
+        controlScheduler = control;
+        networkScheduler = network;
+    }
+    
     // Основной метод обработки команд
     void handle();
     
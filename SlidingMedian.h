@@ -0,0 +1,97 @@
+// файл: SlidingMedian.h
+// Медиана по скользящему окну с инкрементальным обновлением
+// Заменяет копирование и сортировку всего окна на каждом отсчете
+
+#ifndef SLIDING_MEDIAN_H
+#define SLIDING_MEDIAN_H
+
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * Скользящая медиана по последним N значениям
+ * - window хранит значения в порядке поступления (кольцо)
+ * - sorted хранит те же значения по возрастанию
+ * - На новом отсчете самое старое значение находится двоичным поиском
+ *   и заменяется новым одним сдвигом memmove, без полной сортировки
+ * - Пока окно не заполнено, медиана считается по имеющимся значениям
+ */
+template <typename T, size_t N>
+class SlidingMedian {
+    static_assert(N > 0, "Размер окна SlidingMedian должен быть больше нуля");
+
+private:
+    T window[N];      // Значения в порядке поступления
+    T sorted[N];      // Те же значения, отсортированные по возрастанию
+    size_t head;      // Позиция самого старого значения в window
+    size_t count;     // Сколько значений уже в окне
+
+    // Первая позиция в sorted[0..n), где значение не меньше value
+    size_t lowerBound(T value, size_t n) const {
+        size_t lo = 0, hi = n;
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            if (sorted[mid] < value) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+    }
+
+public:
+    SlidingMedian() : head(0), count(0) {}
+
+    /**
+     * Добавить значение в окно (самое старое вытесняется)
+     * @return текущая медиана окна
+     */
+    T push(T value) {
+        if (count < N) {
+            size_t pos = lowerBound(value, count);
+            memmove(&sorted[pos + 1], &sorted[pos], (count - pos) * sizeof(T));
+            sorted[pos] = value;
+            window[(head + count) % N] = value;
+            count++;
+            return median();
+        }
+
+        T oldest = window[head];
+        window[head] = value;
+        head = (head + 1) % N;
+
+        // Удаляем старое значение и вставляем новое одним сдвигом
+        // участка между их позициями
+        size_t from = lowerBound(oldest, N);
+        if (value > oldest) {
+            size_t to = lowerBound(value, N) - 1;
+            memmove(&sorted[from], &sorted[from + 1], (to - from) * sizeof(T));
+            sorted[to] = value;
+        } else {
+            size_t to = lowerBound(value, from);
+            memmove(&sorted[to + 1], &sorted[to], (from - to) * sizeof(T));
+            sorted[to] = value;
+        }
+        return median();
+    }
+
+    /** @return медиана текущего окна (0, если окно пустое) */
+    T median() const {
+        if (count == 0) return T();
+        return sorted[count / 2];
+    }
+
+    /** @return минимальное и максимальное значение окна */
+    T minimum() const { return count ? sorted[0] : T(); }
+    T maximum() const { return count ? sorted[count - 1] : T(); }
+
+    /** @return отсортированные значения окна (size() штук) */
+    const T* sortedValues() const { return sorted; }
+
+    /** Сбросить окно */
+    void reset() { head = 0; count = 0; }
+
+    size_t size() const { return count; }
+    bool isFull() const { return count == N; }
+    static constexpr size_t windowSize() { return N; }
+};
+
+#endif
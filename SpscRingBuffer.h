@@ -0,0 +1,83 @@
+// файл: SpscRingBuffer.h
+// Кольцевой буфер без блокировок для одного производителя и одного потребителя
+// Используется для передачи отсчетов HX711 из задачи опроса в основной цикл
+
+#ifndef SPSC_RING_BUFFER_H
+#define SPSC_RING_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * Кольцевой буфер SPSC (single-producer / single-consumer)
+ * - Производитель вызывает только push(), потребитель - только pop()/popBatch()
+ * - Никаких мьютексов и выделений памяти: индексы - атомарные счетчики
+ * - Емкость N должна быть степенью двойки (индекс берется по маске)
+ * - При переполнении новый элемент отбрасывается и учитывается в getDropped()
+ */
+template <typename T, size_t N>
+class SpscRingBuffer {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "Емкость SpscRingBuffer должна быть степенью двойки");
+
+private:
+    T items[N];
+    std::atomic<uint32_t> head;     // Следующая позиция записи (меняет только производитель)
+    std::atomic<uint32_t> tail;     // Следующая позиция чтения (меняет только потребитель)
+    std::atomic<uint32_t> dropped;  // Сколько элементов потеряно из-за переполнения
+
+public:
+    SpscRingBuffer() : head(0), tail(0), dropped(0) {}
+
+    /**
+     * Добавить элемент (только из задачи-производителя)
+     * @return false - буфер полон, элемент отброшен
+     */
+    bool push(const T& item) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= N) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        items[h & (N - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Извлечь один элемент (только из задачи-потребителя)
+     * @return false - буфер пуст
+     */
+    bool pop(T& item) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return false;
+        item = items[t & (N - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Извлечь до maxCount элементов за один вызов
+     * @return количество извлеченных элементов
+     */
+    size_t popBatch(T* out, size_t maxCount) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t available = head.load(std::memory_order_acquire) - t;
+        size_t count = available < maxCount ? available : maxCount;
+        for (size_t i = 0; i < count; i++) {
+            out[i] = items[(t + i) & (N - 1)];
+        }
+        tail.store(t + count, std::memory_order_release);
+        return count;
+    }
+
+    // ==================== СТАТИСТИКА ====================
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+    bool isEmpty() const { return size() == 0; }
+    static constexpr size_t capacity() { return N; }
+    uint32_t getDropped() const { return dropped.load(std::memory_order_relaxed); }
+};
+
+#endif
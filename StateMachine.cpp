@@ -3,6 +3,7 @@
 // Версия с неблокирующим зуммером и защитой от переполнения millis()
 
 #include "StateMachine.h"
+#include "StateStorage.h"
 #include "debug.h"
 #include <Arduino.h>
 
@@ -21,7 +22,7 @@ static bool checkScaleError(StateMachine* sm, const char* stateName) {
 }
 
 // ==================== IDLE STATE ====================
-IdleState::IdleState() {
+IdleState::IdleState() : State(ST_IDLE) {
     lastPowerCheckTime = 0;
     pressedHandled = false;
     DPRINTLN("🏁 IdleState: создан");
@@ -149,7 +150,7 @@ void IdleState::handleButton(StateMachine* sm, Button& button) {
 }
 
 // ==================== FILLING STATE ====================
-FillingState::FillingState(float target) {
+FillingState::FillingState(float target) : State(ST_FILLING) {
     targetWeight = target;
     startWeight = 0;
     startTime = 0;
@@ -174,6 +175,7 @@ void FillingState::enter(StateMachine* sm) {
     
     startTime = millis();
     startWeight = sm->getScale().getCurrentWeight();
+    sm->setFillStart(startWeight);
     fillingInit = true;
     emergencyStopFlag = false;
     
@@ -231,6 +233,10 @@ void FillingState::update(StateMachine* sm) {
     float remaining = targetWeight - currentWeight;
     DVALF("Осталось налить", remaining);
     
+    FlowEstimator& flow = sm->getScale().getFlow();
+    DVALF("Скорость потока (г/с)", flow.getRate());
+    DVALF("До цели (с)", flow.getTimeToTarget(targetWeight));
+    
     if (emergencyStopFlag) {
         LOG_WARN("💧 Экстренная остановка налива (кнопка/MQTT)");
         sm->toIdle();
@@ -258,24 +264,53 @@ void FillingState::update(StateMachine* sm) {
         return;
     }
     
-    if ((long)elapsed > (long)NO_FLOW_TIMEOUT) {
-        if (sm->getScale().isWeightStable() && 
-            fabs(currentWeight - startWeight) < 10.0f) {
+    // Детектор по скорости потока срабатывает через 2-3 с после включения помпы
+    if (sm->getPump().isPumpOn()) {
+        FlowCheck check = flowMonitor.update(flow);
+        
+        if (check == FLOW_CHECK_NO_FLOW) {
             LOG_ERROR("💧 Нет потока воды - вес не меняется");
+            DPRINTF("💧 Обнаружено через %lu мс после включения помпы\n", flowMonitor.getArmedTime());
             sm->toError(ERR_NO_FLOW);
             DEXIT("FillingState::update (no flow)");
             return;
         }
+        
+        if (check == FLOW_CHECK_DRY) {
+            LOG_ERROR("💧 Поток пропал во время налива - бак пуст");
+            DPRINTF("💧 Пиковый поток %.1f г/с, сейчас %.1f г/с\n", flowMonitor.getPeakRate(), flow.getRate());
+            sm->toError(ERR_RESERVOIR_EMPTY);
+            DEXIT("FillingState::update (reservoir empty)");
+            return;
+        }
+    }
+    
+    // Страховка на случай, если детектор так и не включился (например, серво не доехало)
+    if ((long)elapsed > (long)NO_FLOW_TIMEOUT && fabs(currentWeight - startWeight) < 10.0f &&
+        !flowMonitor.isArmed()) {
+        LOG_ERROR("💧 Нет потока воды - вес не меняется");
+        sm->toError(ERR_NO_FLOW);
+        DEXIT("FillingState::update (no flow)");
+        return;
     }
     
     if (sm->getPump().isServoInPosition() && !sm->getPump().isPumpOn()) {
         sm->getPump().pumpOn();
+        sm->notePumpStarted();
+        flowMonitor.arm();
         LOG_OK("💧 Помпа включена");
     }
     
-    if (currentWeight >= targetWeight - WEIGHT_HYST) {
+    // Выключаем помпу заранее: вода в трубке и задержка фильтра
+    // добавят еще столько, сколько предсказывает модель перелива
+    float flowRate = flow.getRate();
+    float cutoffWeight = targetWeight - sm->getOvershootModel().predict(flowRate);
+    
+    if (currentWeight >= cutoffWeight) {
         LOG_OK("💧 Целевой вес достигнут");
-        DPRINTF("💧 Итоговый вес: %.1f г\n", currentWeight);
+        DPRINTF("💧 Вес при выключении: %.1f г (порог %.1f г)\n", currentWeight, cutoffWeight);
+        sm->getPump().pumpOff();
+        sm->beginOvershootObservation(currentWeight, flowRate, targetWeight);
         sm->getPump().beepShortNonBlocking(2);
         sm->toIdle();
         DEXIT("FillingState::update (target reached)");
@@ -299,7 +334,7 @@ void FillingState::handleButton(StateMachine* sm, Button& button) {
 }
 
 // ==================== CALIBRATION STATE ====================
-CalibrationState::CalibrationState() {
+CalibrationState::CalibrationState() : State(ST_CALIBRATION) {
     step = CALIB_WAIT_REMOVE;
     pressedHandled = false;
 }
@@ -372,7 +407,7 @@ void CalibrationState::setStep(CalibrationStep newStep) {
 }
 
 // ==================== ERROR STATE ====================
-ErrorState::ErrorState(ErrorType err) {
+ErrorState::ErrorState(ErrorType err) : State(ST_ERROR) {
     error = err;
     lastBeepTime = 0;
 }
@@ -408,120 +443,128 @@ StateMachine::StateMachine(Scale& s, PumpController& p, Display& disp)
     nextState = nullptr;
     stateTransitionPending = false;
     stateEnterTime = 0;
+    currentError = ERR_NONE;
+    fillTarget = 0;
+    fillStart = 0;
+    overshootPending = false;
+    cutoffWeight = 0;
+    cutoffFlow = 0;
+    cutoffTarget = 0;
+    cutoffTime = 0;
+    transitionCount = 0;
+    commandTime = 0;
+    lastActuationLatency = 0;
+    maxActuationLatency = 0;
+    activeCommandTag = 0;
+    fillStopped = false;
+    memset(&lastSnapshot, 0, sizeof(lastSnapshot));
+}
+
+// ==================== ОБУЧЕНИЕ МОДЕЛИ ПЕРЕЛИВА ====================
+void StateMachine::beginOvershootObservation(float weight, float flow, float target) {
+    overshootPending = true;
+    cutoffWeight = weight;
+    cutoffFlow = flow;
+    cutoffTarget = target;
+    cutoffTime = millis();
+}
+
+void StateMachine::updateOvershootObservation() {
+    if (!overshootPending) {
+        // Накопленные наливы пишем во флеш, когда помпа давно стоит
+        if (getCurrentStateEnum() == ST_IDLE) overshootModel.commitToEEPROM(EEPROM_OVERSHOOT_ADDR);
+        return;
+    }
+    
+    // Налив прервали, сняли чайник или начали новый - наблюдение недостоверно
+    if (getCurrentStateEnum() != ST_IDLE || !scale.isKettlePresent()) {
+        overshootPending = false;
+        return;
+    }
+    
+    unsigned long elapsed = millis() - cutoffTime;
+    if ((long)elapsed < (long)OVERSHOOT_SETTLE_MIN) return;
+    
+    if ((long)elapsed > (long)OVERSHOOT_SETTLE_TIMEOUT) {
+        LOG_WARN("🎯 Вес не успокоился после налива, перелив не учтен");
+        overshootPending = false;
+        return;
+    }
+    
+    FlowEstimator& flow = scale.getFlow();
+    if (!flow.isValid() || fabs(flow.getRate()) > OVERSHOOT_SETTLED_RATE) return;
+    
+    float settledWeight = scale.getCurrentWeight();
+    float overshoot = settledWeight - cutoffWeight;
+    overshootPending = false;
+    
+    if (overshoot < -WEIGHT_HYST || overshoot > OVERSHOOT_MAX * 2) {
+        LOG_WARN("🎯 Неправдоподобный перелив, налив не учтен");
+        return;
+    }
+    
+    overshootModel.learn(cutoffFlow, overshoot, settledWeight - cutoffTarget);
+    overshootModel.saveToEEPROM(EEPROM_OVERSHOOT_ADDR);
+    DPRINTF("🎯 Ошибка налива: среднее %.1f ± %.1f г\n",
+            overshootModel.getErrorMean(), overshootModel.getErrorStdDev());
 }
 
 void StateMachine::emergencyStopFilling() {
-    if (currentState && strcmp(currentState->getName(), "FILLING") == 0) {
+    // Налив, запущенный после последнего такта, отменяется так же
+    if (getScheduledStateEnum() == ST_FILLING) {
         pump.emergencyStop();
         pump.beepShortNonBlocking(3);
+        fillStopped = true;
         toIdle();
         Serial.println("Emergency stop from MQTT");
     }
 }
 
-void StateMachine::handleMqttCommand(int mode) {
+bool StateMachine::handleMqttCommand(int mode) {
     // ===== ВАЛИДАЦИЯ 1: Проверка допустимости mode =====
     if (mode < 1 || mode > 8) {
         pump.beepShortNonBlocking(2);  // Два сигнала - ошибка
-        return;
+        return false;
     }
-    if (!currentState) return;
+    if (!currentState) return false;
     
     Serial.printf("MQTT command mode: %d\n", mode);
     
     // ===== ВАЛИДАЦИЯ 2: Команда СТОП (8) - работает всегда =====
     if (mode == CMD_STOP) {
         Serial.println("MQTT: STOP command");
-        if (strcmp(currentState->getName(), "FILLING") == 0) {
+        if (getScheduledStateEnum() == ST_FILLING) {
             emergencyStopFilling();
-        } else {
-            pump.beepShortNonBlocking(2);
+            return true;
         }
-        return;
-    }
-    
-    // ===== ВАЛИДАЦИЯ 3: Остальные команды только в IDLE =====
-    if (strcmp(currentState->getName(), "IDLE") != 0) {
-        Serial.println("MQTT: Not in IDLE state, ignoring command");
         pump.beepShortNonBlocking(2);
-        return;
+        return false;
     }
     
-    // ===== ВАЛИДАЦИЯ 4: Проверка наличия чайника =====
-    if (!scale.isReady() || !scale.isKettlePresent()) {
-        Serial.println("MQTT: Kettle not present");
+    // ===== ВАЛИДАЦИЯ 3: Цель налива для команды =====
+    float targetWeight = commandFillTarget(mode, scale.getCurrentWeight(), scale.getEmptyWeight());
+    if (targetWeight < 0) {
+        Serial.printf("MQTT: Unknown command mode %d\n", mode);
         pump.beepShortNonBlocking(2);
-        return;
-    }
-    
-    float currentWater = scale.getCurrentWeight() - scale.getEmptyWeight();
-    if (currentWater < 0) currentWater = 0;
-    
-    float targetWeight = scale.getEmptyWeight();
-    float maxWeight = scale.getEmptyWeight() + FULL_WATER_LEVEL;
-    
-    // ===== ВАЛИДАЦИЯ 5: Обработка конкретной команды =====
-    switch (mode) {
-        case CMD_ONE_CUP:
-            Serial.println("MQTT: One cup / minimum mode");
-            if (currentWater < MIN_WATER_LEVEL) {
-                targetWeight = scale.getEmptyWeight() + MIN_WATER_LEVEL;
-            } else {
-                targetWeight = scale.getCurrentWeight() + CUP_VOLUME;
-            }
-            break;
-            
-        case CMD_TWO_CUPS:
-            Serial.println("MQTT: Two cups (500 ml)");
-            targetWeight = scale.getEmptyWeight() + 500.0f;
-            break;
-            
-        case CMD_THREE_CUPS:
-            Serial.println("MQTT: Three cups (750 ml)");
-            targetWeight = scale.getEmptyWeight() + 750.0f;
-            break;
-            
-        case CMD_FOUR_CUPS:
-            Serial.println("MQTT: Four cups (1000 ml)");
-            targetWeight = scale.getEmptyWeight() + 1000.0f;
-            break;
-            
-        case CMD_FIVE_CUPS:
-            Serial.println("MQTT: Five cups (1250 ml)");
-            targetWeight = scale.getEmptyWeight() + 1250.0f;
-            break;
-            
-        case CMD_SIX_CUPS:
-            Serial.println("MQTT: Six cups (1500 ml)");
-            targetWeight = scale.getEmptyWeight() + 1500.0f;
-            break;
-            
-        case CMD_FULL:
-            Serial.println("MQTT: Full kettle (1700 ml)");
-            targetWeight = scale.getEmptyWeight() + FULL_WATER_LEVEL;
-            break;
-            
-        default:
-            Serial.printf("MQTT: Unknown command mode %d\n", mode);
-            pump.beepShortNonBlocking(2);
-            return;
-    }
-    
-    // ===== ВАЛИДАЦИЯ 6: Ограничение максимальным объемом =====
-    if (targetWeight > maxWeight) {
-        targetWeight = maxWeight;
+        return false;
     }
     
-    // ===== ВАЛИДАЦИЯ 7: Проверка, есть ли смысл наливать =====
-    if (targetWeight <= scale.getCurrentWeight() + 10) {
-        Serial.println("MQTT: Target already reached or exceeded");
+    // ===== ВАЛИДАЦИЯ 4: Состояние, чайник, ограничение объема =====
+    FillCheck check = checkFill(getFillCheckStateEnum(), scale.isReady() && scale.isKettlePresent(),
+                                scale.getCurrentWeight(), scale.getEmptyWeight(), targetWeight);
+    if (check != FILL_CHECK_OK) {
+        if (check == FILL_CHECK_BUSY) Serial.println("MQTT: Not in IDLE state, ignoring command");
+        else if (check == FILL_CHECK_NO_KETTLE) Serial.println("MQTT: Kettle not present");
+        else Serial.println("MQTT: Target already reached or exceeded");
         pump.beepShortNonBlocking(2);
-        return;
+        return false;
     }
     
     // ===== ВСЕ ПРОВЕРКИ ПРОЙДЕНЫ - ЗАПУСКАЕМ НАЛИВ =====
+    Serial.printf("MQTT: Fill to %.0f g\n", targetWeight);
     toFilling(targetWeight);
     pump.beepShortNonBlocking(1); // Один сигнал - команда принята
+    return true;
 }
 
 void StateMachine::transitionTo(State* newState) {
@@ -534,13 +577,37 @@ void StateMachine::transitionTo(State* newState) {
     stateTransitionPending = true;
 }
 
+void StateMachine::resetState(State* state) {
+    if (state == &idleState) rebuildState(idleState);
+    else if (state == &fillingState) rebuildState(fillingState, fillTarget);
+    else if (state == &calibrationState) rebuildState(calibrationState);
+    else if (state == &errorState) rebuildState(errorState, currentError);
+}
+
 void StateMachine::update() {
     if (stateTransitionPending && nextState != nullptr) {
         if (currentState != nullptr) {
             currentState->exit(this);
-            delete currentState;
         }
         
+        // Состояние пересоздается только после exit(): переход в то же
+        // состояние (ERROR -> ERROR) не портит объект, который еще работает
+        resetState(nextState);
+        transitionCount++;
+        
+        // Задержку команды меряем только для налива, запущенного событием
+        if (nextState != &fillingState) commandTime = 0;
+        
+        // Налив по команде MQTT закончился - сообщаем результат
+        if (activeCommandTag != 0 && nextState != &fillingState) {
+            CommandOutcome outcome = CMD_RESULT_COMPLETED;
+            if (nextState == &errorState) outcome = CMD_RESULT_FAILED;
+            else if (fillStopped) outcome = CMD_RESULT_STOPPED;
+            pushCommandResult(activeCommandTag, outcome);
+            activeCommandTag = 0;
+        }
+        if (nextState != &fillingState) fillStopped = false;
+        
         currentState = nextState;
         nextState = nullptr;
         stateTransitionPending = false;
@@ -554,88 +621,196 @@ void StateMachine::update() {
     if (currentState != nullptr) {
         currentState->update(this);
     }
+    
+    updateOvershootObservation();
+    publishSnapshot();
 }
 
-void StateMachine::handleButton(Button& button) {
-    if (currentState != nullptr) {
-        currentState->handleButton(this, button);
+// ==================== СНИМОК СОСТОЯНИЯ ====================
+void StateMachine::publishSnapshot() {
+    SystemSnapshot s;
+    memset(&s, 0, sizeof(s));
+    
+    s.state = getCurrentStateEnum();
+    s.error = currentError;
+    if (s.state == ST_FILLING) {
+        s.fillTarget = fillTarget;
+        s.fillStart = fillStart;
     }
-}
-
-bool StateMachine::canTransitionTo(State* newState) {
-    // Если нет текущего состояния - любой переход разрешен (начальное состояние)
-    if (currentState == nullptr) return true;
     
-    // Получаем имена текущего и целевого состояний
-    const char* currentName = currentState->getName();
-    const char* newName = newState->getName();
+    s.scaleReady = scale.isReady();
+    s.kettlePresent = scale.isKettlePresent();
+    s.calibrationDone = scale.isCalibrationDone();
+    s.factorCalibrated = scale.isFactorCalibrated();
+    s.currentWeight = scale.getCurrentWeight();
+    s.emptyWeight = scale.getEmptyWeight();
+    s.waterVolume = s.currentWeight - s.emptyWeight;
+    if (s.waterVolume < 0) s.waterVolume = 0;
+    s.calibrationFactor = scale.getCalibrationFactor();
     
-    // ==================== МАТРИЦА РАЗРЕШЕННЫХ ПЕРЕХОДОВ ====================
-    // IDLE -> любые состояния разрешены
-    if (strcmp(currentName, "IDLE") == 0) {
-        // Из IDLE можно перейти в любое состояние
-        return true;
-    }
+    FlowEstimator& flow = scale.getFlow();
+    s.flowVariance = flow.getRateVariance();
+    s.flowRate = snapshotFlowRate(flow.getRate(), s.flowVariance);
+    s.timeToTarget = s.state == ST_FILLING ? flow.getTimeToTarget(fillTarget) : -1;
+    
+    s.pumpOn = pump.isPumpOn();
+    s.powerRelayOn = pump.isPowerRelayOn();
+    
+    s.fillsLearned = overshootModel.getFills();
+    s.fillErrorMean = overshootModel.getErrorMean();
+    s.fillErrorStd = overshootModel.getErrorStdDev();
+    s.stateTransitions = transitionCount;
+    s.commandLatency = lastActuationLatency;
+    s.commandLatencyMax = maxActuationLatency;
     
-    // FILLING -> только в IDLE или ERROR
-    if (strcmp(currentName, "FILLING") == 0) {
-        if (strcmp(newName, "IDLE") == 0 || strcmp(newName, "ERROR") == 0) {
-            return true;  // Разрешено: завершение налива или ошибка
+    // Версия меняется только вместе с содержимым (с точностью до шагов SNAPSHOT_*)
+    s.timestamp = millis();
+    snapshotAssignVersion(s, lastSnapshot);
+    
+    snapshot.write(s);
+}
+
+// ==================== ОБРАБОТКА СОБЫТИЙ ====================
+void StateMachine::handleEvent(const SystemEvent& evt) {
+    switch (evt.type) {
+        case EVT_MQTT_COMMAND: {
+            uint16_t tag = MQTT_COMMAND_TAG(evt.arg);
+            bool accepted = handleMqttCommand(MQTT_COMMAND_MODE(evt.arg));
+            if (tag == 0) break;
+            
+            pushCommandResult(tag, accepted ? CMD_RESULT_ACCEPTED : CMD_RESULT_REJECTED);
+            // Налив подтверждается по окончании, остальные команды (СТОП) - сразу
+            if (accepted && stateTransitionPending && nextState == &fillingState) {
+                activeCommandTag = tag;
+            } else if (accepted) {
+                pushCommandResult(tag, CMD_RESULT_COMPLETED);
+            }
+            break;
         }
-        Serial.printf("Transition denied: Cannot go from FILLING to %s\n", newName);
-        return false;
+            
+        case EVT_FILL: {
+            // Веб проверил команду по снимку; здесь повторяем проверку на текущих данных
+            float targetWeight = (float)evt.arg;
+            FillCheck check = checkFill(getFillCheckStateEnum(), scale.isReady() && scale.isKettlePresent(),
+                                        scale.getCurrentWeight(), scale.getEmptyWeight(), targetWeight);
+            if (check == FILL_CHECK_OK) {
+                toFilling(targetWeight);
+                pump.beepShortNonBlocking(1);
+            } else {
+                pump.beepShortNonBlocking(2);
+            }
+            break;
+        }
+            
+        case EVT_STOP:
+            emergencyStopFilling();
+            break;
+            
+        case EVT_CALIBRATE:
+            toCalibration();
+            break;
+            
+        case EVT_OTA_START:
+            if (getScheduledStateEnum() == ST_FILLING) fillStopped = true;
+            pump.pumpOff();
+            overshootModel.commitToEEPROM(EEPROM_OVERSHOOT_ADDR, true);
+            toIdle();
+            break;
+            
+        default:
+            return;
     }
     
-    // CALIBRATION -> только в IDLE (через таймер) или ERROR
-    if (strcmp(currentName, "CALIBRATION") == 0) {
-        if (strcmp(newName, "IDLE") == 0 || strcmp(newName, "ERROR") == 0) {
-            return true;  // Разрешено: завершение калибровки или ошибка
-        }
-        Serial.printf("Transition denied: Cannot go from CALIBRATION to %s\n", newName);
-        return false;
+    // Налив запущен событием - засекаем задержку до включения помпы
+    // (до такта могут прийти и другие события - время берем от первого)
+    if (stateTransitionPending && nextState == &fillingState && commandTime == 0) {
+        commandTime = evt.timestamp;
     }
+}
+
+void StateMachine::pushCommandResult(uint16_t tag, CommandOutcome outcome) {
+    CommandResult result;
+    result.tag = tag;
+    result.outcome = outcome;
+    result.timestamp = millis();
+    result.volume = scale.getCurrentWeight() - scale.getEmptyWeight();
+    if (result.volume < 0) result.volume = 0;
     
-    // ERROR -> только в ERROR (никаких переходов, только перезагрузка)
-    if (strcmp(currentName, "ERROR") == 0) {
-        if (strcmp(newName, "ERROR") == 0) {
-            return true;  // Остаемся в ошибке
-        }
-        Serial.printf("Transition denied: Cannot exit ERROR state without reboot\n");
-        return false;
+    // Очередь полна - результат теряется, подтверждения по нему не будет
+    commandResults.push(result);
+}
+
+void StateMachine::notePumpStarted() {
+    if (commandTime == 0) return;
+    
+    lastActuationLatency = ((uint32_t)micros() - commandTime) / 1000;
+    if (lastActuationLatency > maxActuationLatency) maxActuationLatency = lastActuationLatency;
+    commandTime = 0;
+    DPRINTF("⏱ Команда -> помпа: %lu мс\n", lastActuationLatency);
+}
+
+void StateMachine::handleButton(Button& button) {
+    if (currentState != nullptr) {
+        currentState->handleButton(this, button);
     }
+}
+
+bool StateMachine::canTransitionTo(State* newState) {
+    if (newState == nullptr) return false;
+    
+    // Если нет текущего состояния - автомат в INIT (начальный переход);
+    // уже запланированный переход считается выполненным
+    SystemState from = currentState ? getScheduledStateEnum() : ST_INIT;
+    if (isTransitionAllowed(from, newState->getId())) return true;
     
-    // По умолчанию запрещаем неизвестные переходы
-    Serial.printf("Transition denied: Unknown state combination %s -> %s\n", 
-                  currentName, newName);
+    Serial.printf("Transition denied: %s -> %s\n",
+                  currentState ? currentState->getName() : "INIT", newState->getName());
     return false;
 }
 
+// Параметры перехода (цель налива, код ошибки) хранятся в автомате
+// и применяются к объекту состояния в update() при самом переходе
 void StateMachine::toIdle() {
-    transitionTo(new IdleState());
+    transitionTo(&idleState);
 }
 
 void StateMachine::toFilling(float targetWeight) {
+    // Налив по команде был запланирован и отменен до такта (СТОП между
+    // тактами): его результат сообщаем до того, как номер перезапишется
+    if (activeCommandTag != 0 && getScheduledStateEnum() != ST_FILLING) {
+        pushCommandResult(activeCommandTag, fillStopped ? CMD_RESULT_STOPPED : CMD_RESULT_COMPLETED);
+        activeCommandTag = 0;
+    }
     fillTarget = targetWeight;
-    transitionTo(new FillingState(targetWeight));
+    fillStopped = false;
+    transitionTo(&fillingState);
 }
 
 void StateMachine::toCalibration() {
-    transitionTo(new CalibrationState());
+    transitionTo(&calibrationState);
 }
 
 void StateMachine::toError(ErrorType error) {
     currentError = error;
-    transitionTo(new ErrorState(error));
+    transitionTo(&errorState);
 }
 
 SystemState StateMachine::getCurrentStateEnum() {
     if (currentState == nullptr) return ST_IDLE;
-    
-    const char* name = currentState->getName();
-    if (strcmp(name, "IDLE") == 0) return ST_IDLE;
-    if (strcmp(name, "FILLING") == 0) return ST_FILLING;
-    if (strcmp(name, "CALIBRATION") == 0) return ST_CALIBRATION;
-    if (strcmp(name, "ERROR") == 0) return ST_ERROR;
-    
-    return ST_IDLE;
-}
\ No newline at end of file
+    return currentState->getId();
+}
+
+SystemState StateMachine::getScheduledStateEnum() {
+    if (stateTransitionPending && nextState != nullptr) return nextState->getId();
+    return getCurrentStateEnum();
+}
+
+SystemState StateMachine::getFillCheckStateEnum() {
+    // Налив A закончился или остановлен, но переход FILLING -> IDLE выполнит
+    // только ближайший такт. Налив B, принятый до него, перезаписал бы цель,
+    // флаг остановки и номер команды A: A осталась бы без подтверждения
+    // completed/stopped, а ее перелив - без наблюдения
+    SystemState current = getCurrentStateEnum();
+    if (current != ST_IDLE) return current;
+    return getScheduledStateEnum();
+}
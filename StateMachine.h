@@ -10,19 +10,34 @@
 #include "Scale.h"        // Подключаем класс для работы с весами
 #include "PumpController.h" // Подключаем класс управления помпой
 #include "Display.h"      // Подключаем класс управления дисплеем
+#include "OvershootModel.h" // Подключаем модель перелива для раннего выключения помпы
+#include "FlowMonitor.h"  // Подключаем детектор отсутствия потока
+#include "EventQueue.h"   // Подключаем типы событий для handleEvent()
+#include "SystemSnapshot.h" // Подключаем снимок состояния для читателей
+#include "Seqlock.h"      // Подключаем публикацию снимка без блокировок
+#include "SpscRingBuffer.h" // Подключаем передачу результатов команд в сетевую задачу
+#include "StateTransitions.h" // Подключаем матрицу разрешенных переходов
+#include "FillCommand.h" // Подключаем коды команд и проверку налива
 
-// ==================== КОДЫ MQTT КОМАНД ====================
-// Эти числовые коды приходят из MQTT топика /devices/pump/filling
-// Каждое число соответствует определенной команде от Алисы
+#define COMMAND_RESULTS_SIZE 8  // Результатов команд, ожидающих подтверждения в MQTT
 
-#define CMD_ONE_CUP 1      // Команда 1: одна кружка / налить до минимума (500 мл)
-#define CMD_TWO_CUPS 2      // Команда 2: две кружки (500 мл)
-#define CMD_THREE_CUPS 3    // Команда 3: три кружки (750 мл)
-#define CMD_FOUR_CUPS 4     // Команда 4: четыре кружки (1000 мл)
-#define CMD_FIVE_CUPS 5     // Команда 5: пять кружек (1250 мл)
-#define CMD_SIX_CUPS 6      // Команда 6: шесть кружек (1500 мл)
-#define CMD_FULL 7          // Команда 7: полный чайник (1700 мл)
-#define CMD_STOP 8          // Команда 8: экстренная остановка налива
+/**
+ * Результат команды MQTT для подтверждения
+ */
+enum CommandOutcome : uint8_t {
+    CMD_RESULT_ACCEPTED,    // Команда принята (налив начат)
+    CMD_RESULT_REJECTED,    // Команда отклонена (не IDLE, нет чайника, цель уже достигнута)
+    CMD_RESULT_COMPLETED,   // Команда выполнена (налив дошел до цели, СТОП остановил налив)
+    CMD_RESULT_FAILED,      // Налив закончился ошибкой
+    CMD_RESULT_STOPPED      // Налив прерван командой СТОП до цели
+};
+
+struct CommandResult {
+    uint16_t tag;           // Номер команды из MQTT_COMMAND_ARG
+    CommandOutcome outcome;
+    uint32_t timestamp;     // millis() момента результата
+    float volume;           // Объем воды в чайнике (мл)
+};
 
 // Предварительное объявление класса StateMachine
 // Это нужно, потому что класс State ссылается на StateMachine,
@@ -36,7 +51,19 @@ class StateMachine;
  * Паттерн State позволяет объекту изменять свое поведение в зависимости от состояния
  */
 class State {
+private:
+    // Идентификатор состояния: по нему автомат сравнивает состояния
+    // и проверяет переходы целыми числами, без strcmp по именам
+    const SystemState id;
+
+protected:
+    // Идентификатор задается потомком и не меняется
+    explicit State(SystemState stateId) : id(stateId) {}
+
 public:
+    /** @return идентификатор состояния (невиртуальный, O(1)) */
+    SystemState getId() const { return id; }
+    
     // Виртуальный деструктор для корректного удаления производных классов
     // Если у класса есть виртуальные функции, нужен виртуальный деструктор
     virtual ~State() {}
@@ -106,10 +133,11 @@ private:
     bool fillingInit;          // Флаг успешной инициализации налива
     bool emergencyStopFlag;    // Флаг экстренной остановки (по кнопке или MQTT)
     ServoState requiredServoState; // Требуемое положение сервопривода (всегда OVER_KETTLE)
+    FlowMonitor flowMonitor;   // Детектор отсутствия потока и опустевшего бака
 
 public:
     // Конструктор принимает целевой вес налива
-    FillingState(float target);
+    FillingState(float target = 0);
     
     // Переопределяем виртуальные методы
     void enter(StateMachine* sm) override;
@@ -168,7 +196,7 @@ private:
 
 public:
     // Конструктор принимает тип ошибки
-    ErrorState(ErrorType err);
+    ErrorState(ErrorType err = ERR_NONE);
     
     // Переопределяем виртуальные методы
     void enter(StateMachine* sm) override;
@@ -196,6 +224,38 @@ private:
     State* currentState;  // Указатель на текущее активное состояние
     State* nextState;      // Указатель на следующее состояние (при переходе)
     
+    // Объекты состояний живут внутри автомата все время работы.
+    // При переходе целевой объект пересоздается на месте (placement new),
+    // поэтому смена состояния не трогает кучу и не фрагментирует ее.
+    IdleState idleState;
+    FillingState fillingState;
+    CalibrationState calibrationState;
+    ErrorState errorState;
+    
+    // Статистика переходов
+    unsigned long transitionCount;     // Выполнено переходов
+    
+    // Пересоздать объект состояния с параметрами текущего перехода
+    void resetState(State* state);
+    
+    // Задержка от команды до включения помпы
+    uint32_t commandTime;              // micros() события, запустившего налив (0 - нет)
+    unsigned long lastActuationLatency; // Последняя задержка команда -> помпа (мс)
+    unsigned long maxActuationLatency;  // Максимальная задержка команда -> помпа (мс)
+    
+    // Результаты команд MQTT: пишет задача управления, читает сетевая
+    SpscRingBuffer<CommandResult, COMMAND_RESULTS_SIZE> commandResults;
+    uint16_t activeCommandTag;         // Номер команды, запустившей текущий налив (0 - нет)
+    bool fillStopped;                  // Текущий налив прерван СТОП или началом OTA
+    void pushCommandResult(uint16_t tag, CommandOutcome outcome);
+    
+    // Снимок состояния для веба, MQTT, дисплея и Serial
+    Seqlock<SystemSnapshot> snapshot;  // Опубликованный снимок
+    SystemSnapshot lastSnapshot;       // Последний снимок, получивший версию (для сравнения)
+    
+    // Собрать и опубликовать снимок (в конце каждого update())
+    void publishSnapshot();
+    
     // Ссылки на компоненты системы (внедрение зависимостей через конструктор)
     Scale& scale;          // Ссылка на объект весов
     PumpController& pump;  // Ссылка на объект управления помпой
@@ -211,6 +271,25 @@ private:
     // Цели налива (хранятся отдельно для доступа извне без dynamic_cast)
     float fillTarget;  // Текущая цель налива (вес)
     float fillStart;   // Начальный вес при наливе
+    
+    // Модель перелива и наблюдение за весом после выключения помпы
+    OvershootModel overshootModel;
+    bool overshootPending;         // Ждем, пока вес успокоится после налива
+    float cutoffWeight;            // Вес в момент выключения помпы
+    float cutoffFlow;              // Скорость потока в момент выключения
+    float cutoffTarget;            // Целевой вес налива
+    unsigned long cutoffTime;      // Время выключения помпы
+    
+    // Завершить наблюдение и обучить модель, когда вес успокоится
+    void updateOvershootObservation();
+    
+    // Состояние с учетом перехода, который выполнит ближайший такт:
+    // по нему проверяются события, пришедшие между тактами
+    SystemState getScheduledStateEnum();
+    
+    // Состояние для проверки нового налива: занято, пока не выполнен
+    // переход из текущего состояния (завершение налива еще не подтверждено)
+    SystemState getFillCheckStateEnum();
 
 public:
     /**
@@ -225,7 +304,7 @@ public:
     
     /**
      * Инициирует переход в новое состояние
-     * @param newState - указатель на объект нового состояния
+     * @param newState - указатель на объект состояния из пула автомата
      */
     void transitionTo(State* newState);
     
@@ -241,6 +320,38 @@ public:
      */
     void handleButton(Button& button);
     
+    /**
+     * Обрабатывает событие из очереди (MQTT, веб, кнопка)
+     * Команда проверяется и подтверждается сразу, а переход выполняет
+     * ближайший такт управления (update() - один раз за такт)
+     * @param evt - событие
+     */
+    void handleEvent(const SystemEvent& evt);
+    
+    /**
+     * Отметить включение помпы (вызывается FillingState)
+     * Если налив запущен событием - фиксирует задержку команда -> помпа
+     */
+    void notePumpStarted();
+    
+    /**
+     * Получить согласованный снимок состояния (из любой задачи и любого ядра)
+     * @param out - сюда копируется снимок
+     */
+    void readSnapshot(SystemSnapshot& out) const { snapshot.read(out); }
+    
+    /**
+     * Забрать результат команды MQTT (только из сетевой задачи)
+     * @return false - новых результатов нет
+     */
+    bool popCommandResult(CommandResult& out) { return commandResults.pop(out); }
+    
+    /** @return последняя задержка от команды до включения помпы (мс) */
+    unsigned long getLastActuationLatency() { return lastActuationLatency; }
+    
+    /** @return максимальная задержка от команды до включения помпы (мс) */
+    unsigned long getMaxActuationLatency() { return maxActuationLatency; }
+    
     // ========== Геттеры для компонентов ==========
     
     /** @return ссылка на объект весов */
@@ -260,6 +371,9 @@ public:
     /** @return указатель на текущее состояние */
     State* getCurrentState() { return currentState; }
     
+    /** @return количество выполненных переходов */
+    unsigned long getTransitionCount() { return transitionCount; }
+    
     // ========== Методы для получения информации о состоянии ==========
     
     /** @return текущее состояние системы в виде перечисления SystemState */
@@ -285,6 +399,20 @@ public:
     /** @param start - установить начальный вес налива */
     void setFillStart(float start) { fillStart = start; }
     
+    // ========== Предиктивное выключение помпы ==========
+    
+    /** @return модель перелива (для прогноза и статистики) */
+    OvershootModel& getOvershootModel() { return overshootModel; }
+    
+    /**
+     * Запомнить момент выключения помпы, чтобы после успокоения веса
+     * измерить фактический перелив и дообучить модель
+     * @param weight - вес в момент выключения
+     * @param flow - скорость потока в момент выключения (г/с)
+     * @param target - целевой вес налива
+     */
+    void beginOvershootObservation(float weight, float flow, float target);
+    
     // ========== Методы для создания переходов (фабрика) ==========
     
     /** Перейти в состояние IDLE */
@@ -319,8 +447,9 @@ public:
     /**
      * Обрабатывает команду из MQTT
      * @param mode - код команды (1-8)
+     * @return true если команда принята
      */
-    void handleMqttCommand(int mode);
+    bool handleMqttCommand(int mode);
     
     /** Экстренно останавливает налив по MQTT команде */
     void emergencyStopFilling();
@@ -331,14 +460,6 @@ public:
    */
   void updateDisplayWaiting() { display.updateWaiting(this); }
 
-    // Деструктор
-    ~StateMachine() {
-        if (currentState) {
-            delete currentState;
-            currentState = nullptr;
-        }
-    }
-
 };
 
 #endif // Конец защиты от множественного включения
\ No newline at end of file
@@ -0,0 +1,23 @@
+// файл: StateStorage.h
+// Пересоздание объекта состояния на месте: автомат держит состояния в своих полях
+// и при переходе не обращается к куче
+
+#ifndef STATE_STORAGE_H
+#define STATE_STORAGE_H
+
+#include <new>
+
+/**
+ * Пересоздать объект на месте: деструктор + placement new
+ * - Память объекта остается той же, новая не выделяется
+ * - Указатели на объект (currentState, nextState) остаются верными
+ * @param state - объект, который пересоздается
+ * @param args - параметры конструктора (цель налива, код ошибки)
+ */
+template <typename T, typename... Args>
+inline void rebuildState(T& state, Args... args) {
+    state.~T();
+    new (&state) T(args...);
+}
+
+#endif
@@ -0,0 +1,49 @@
+// файл: StateTransitions.h
+// Матрица разрешенных переходов конечного автомата
+// Без классов состояний и оборудования: проверяется и при сборке, и хост-тестом
+
+#ifndef STATE_TRANSITIONS_H
+#define STATE_TRANSITIONS_H
+
+#include "config.h"
+
+// Количество состояний в SystemState (ST_ERROR - последнее)
+constexpr int STATE_COUNT = ST_ERROR + 1;
+
+// Строка - текущее состояние, столбец - целевое (порядок как в SystemState)
+// INIT - автомат еще не вошел ни в одно состояние
+constexpr bool STATE_TRANSITIONS[STATE_COUNT][STATE_COUNT] = {
+    //                 INIT   IDLE   FILLING CALIB  ERROR
+    /* INIT        */ { false, true,  true,  true,  true  },
+    /* IDLE        */ { false, true,  true,  true,  true  },  // Из IDLE - куда угодно
+    /* FILLING     */ { false, true,  false, false, true  },  // Завершение налива или ошибка
+    /* CALIBRATION */ { false, true,  false, false, true  },  // Завершение калибровки или ошибка
+    /* ERROR       */ { false, false, false, false, true  },  // Выход только перезагрузкой
+};
+
+/**
+ * Проверка перехода по таблице (вычисляется и во время компиляции)
+ * @return true если переход from -> to разрешен
+ */
+constexpr bool isTransitionAllowed(SystemState from, SystemState to) {
+    return from >= ST_INIT && from < STATE_COUNT &&
+           to >= ST_INIT && to < STATE_COUNT &&
+           STATE_TRANSITIONS[from][to];
+}
+
+// ==================== ПРОВЕРКА МАТРИЦЫ ПЕРЕХОДОВ ====================
+// Ошибка в таблице ломает сборку, а не налив
+static_assert(isTransitionAllowed(ST_INIT, ST_IDLE), "Старт должен приводить в IDLE");
+static_assert(isTransitionAllowed(ST_IDLE, ST_FILLING), "IDLE -> FILLING");
+static_assert(isTransitionAllowed(ST_IDLE, ST_CALIBRATION), "IDLE -> CALIBRATION");
+static_assert(isTransitionAllowed(ST_FILLING, ST_IDLE), "Налив должен завершаться в IDLE");
+static_assert(isTransitionAllowed(ST_CALIBRATION, ST_IDLE), "Калибровка должна завершаться в IDLE");
+static_assert(!isTransitionAllowed(ST_FILLING, ST_CALIBRATION), "Калибровка во время налива запрещена");
+static_assert(!isTransitionAllowed(ST_FILLING, ST_FILLING), "Повторный налив поверх текущего запрещен");
+static_assert(!isTransitionAllowed(ST_CALIBRATION, ST_FILLING), "Налив во время калибровки запрещен");
+static_assert(!isTransitionAllowed(ST_ERROR, ST_IDLE), "Из ERROR выходят только перезагрузкой");
+static_assert(!isTransitionAllowed(ST_ERROR, ST_FILLING), "Из ERROR выходят только перезагрузкой");
+static_assert(!isTransitionAllowed(ST_IDLE, ST_INIT), "В INIT вернуться нельзя");
+static_assert(!isTransitionAllowed((SystemState)STATE_COUNT, ST_IDLE), "Неизвестное состояние");
+
+#endif
@@ -0,0 +1,89 @@
+// файл: StatusETag.h
+// ETag документа /api/status по содержимому: хеш отрисованных полей дашборда
+// Без Arduino: текст полей пишет JsonWriter, сюда приходит только его хеш
+
+#ifndef STATUS_ETAG_H
+#define STATUS_ETAG_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+// ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
+#define STATUS_HASH_SEED 2166136261u   // Начальное значение FNV-1a
+#define STATUS_HASH_WINDOW 64          // Окно JsonWriter при подсчете хеша (байт, на стеке)
+#define STATUS_ETAG_SIZE 32            // W/"<загрузка>-<хеш>-<поколение>" с нулем
+
+/** FNV-1a: продолжить хеш следующим куском текста */
+inline uint32_t statusHash(uint32_t hash, const char* data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (uint8_t)data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Функция сброса JsonWriter: вместо отправки накапливает хеш
+ * @param context - uint32_t с текущим хешем
+ */
+inline void statusHashChunk(void* context, const char* data, size_t length) {
+    uint32_t* hash = (uint32_t*)context;
+    *hash = statusHash(*hash, data, length);
+}
+
+/**
+ * ETag /api/status
+ * - Меняется, когда меняется текст отрисованных полей (их хеш), а не
+ *   версия снимка или счетчики диагностики: опрос при неподвижном
+ *   чайнике получает 304
+ * - Слабый (W/): диагностика в теле может быть новее, чем при выдаче ETag
+ * - Живет не дольше maxAge: uptime и куча на опрашивающем дашборде
+ *   все же обновляются
+ * - Случайное число загрузки: после перезагрузки старый ETag не совпадет
+ */
+class StatusETag {
+private:
+    uint32_t bootId;
+    uint32_t hash;
+    uint32_t generation;       // Номер выдачи (0 - ETag еще не выдан)
+    unsigned long issuedAt;
+    char text[STATUS_ETAG_SIZE];
+
+public:
+    StatusETag() : bootId(0), hash(0), generation(0), issuedAt(0) { text[0] = '\0'; }
+
+    void begin(uint32_t boot) {
+        bootId = boot;
+        generation = 0;
+        text[0] = '\0';
+    }
+
+    /**
+     * Сверить хеш текущих полей с выданным ETag
+     * @param contentHash - хеш отрисованных полей
+     * @param now - millis()
+     * @param maxAge - предельный возраст ETag (мс)
+     * @return true если ETag сменился (кэш документа нужно пересобрать)
+     */
+    bool update(uint32_t contentHash, unsigned long now, unsigned long maxAge) {
+        if (generation != 0 && contentHash == hash && now - issuedAt < maxAge) return false;
+
+        hash = contentHash;
+        generation++;
+        issuedAt = now;
+        snprintf(text, sizeof(text), "W/\"%08lx-%08lx-%lx\"", (unsigned long)bootId,
+                 (unsigned long)hash, (unsigned long)generation);
+        return true;
+    }
+
+    /** Совпадает ли If-None-Match клиента с текущим ETag */
+    bool matches(const char* ifNoneMatch) const {
+        return generation != 0 && ifNoneMatch && strcmp(ifNoneMatch, text) == 0;
+    }
+
+    const char* c_str() const { return text; }
+};
+
+#endif
@@ -0,0 +1,138 @@
+// файл: SystemSnapshot.h
+// Согласованный снимок состояния системы
+// Публикуется задачей управления раз в такт, читается вебом, MQTT, дисплеем и Serial
+
+#ifndef SYSTEM_SNAPSHOT_H
+#define SYSTEM_SNAPSHOT_H
+
+#include "config.h"
+
+// ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
+// Изменения меньше шага - шум датчика, версию снимка не меняют
+#define SNAPSHOT_WEIGHT_STEP 1.0f      // Вес и объем (г)
+#define SNAPSHOT_FLOW_STEP 0.1f        // Скорость потока (г/с)
+#define SNAPSHOT_ETA_STEP 1.0f         // Время до цели (с)
+#define SNAPSHOT_FLOW_CONFIDENCE 5.0f  // Поток меньше стольких СКО оценки - ноль
+
+/**
+ * Снимок состояния системы
+ * - Все поля сняты в один момент в задаче управления, поэтому согласованы
+ *   между собой (вес, состояние и цель налива из одного такта)
+ * - version растет только при значимом изменении содержимого (см.
+ *   snapshotContentEquals): читатели могут пропускать работу, если
+ *   версия не изменилась
+ */
+struct SystemSnapshot {
+    uint32_t version;              // Версия содержимого (0 - снимка еще не было)
+    uint32_t timestamp;            // millis() момента публикации
+
+    // ===== Автомат =====
+    SystemState state;
+    ErrorType error;
+    float fillTarget;              // Цель налива (г), 0 - не наливаем
+    float fillStart;               // Вес в начале налива (г)
+
+    // ===== Весы =====
+    bool scaleReady;
+    bool kettlePresent;
+    bool calibrationDone;
+    bool factorCalibrated;
+    float currentWeight;           // Отфильтрованный вес (г)
+    float emptyWeight;             // Вес пустого чайника (г)
+    float waterVolume;             // Объем воды (мл), не меньше 0
+    float calibrationFactor;
+
+    // ===== Поток =====
+    float flowRate;                // г/с
+    float flowVariance;            // В версию не входит: меняется каждый отсчет
+    float timeToTarget;            // с, -1 - не наливаем или нет потока
+
+    // ===== Помпа =====
+    bool pumpOn;
+    bool powerRelayOn;
+
+    // ===== Статистика налива и автомата =====
+    uint32_t fillsLearned;
+    float fillErrorMean;
+    float fillErrorStd;
+    uint32_t stateTransitions;
+    uint32_t commandLatency;       // Последняя задержка команда -> помпа (мс)
+    uint32_t commandLatencyMax;
+};
+
+/**
+ * Код ошибки для MQTT и веба
+ * @return короткое имя ("none", "no_flow", "reservoir_empty", ...)
+ */
+inline const char* errorName(ErrorType error) {
+    switch (error) {
+        case ERR_NONE:            return "none";
+        case ERR_HX711_TIMEOUT:   return "hx711_timeout";
+        case ERR_NO_FLOW:         return "no_flow";
+        case ERR_FILL_TIMEOUT:    return "fill_timeout";
+        case ERR_RESERVOIR_EMPTY: return "reservoir_empty";
+    }
+    return "unknown";
+}
+
+/**
+ * Скорость потока для снимка: неотличимая от нуля (в пределах
+ * SNAPSHOT_FLOW_CONFIDENCE СКО оценки) публикуется как 0, чтобы шум весов
+ * в покое не менял версию снимка и не дрожал на экране. Порог выше, чем
+ * у детектора потока: оценка проверяется каждый такт, и при 3 СКО шум
+ * проходил бы несколько раз в минуту
+ */
+inline float snapshotFlowRate(float rate, float variance) {
+    return fabsf(rate) < SNAPSHOT_FLOW_CONFIDENCE * sqrtf(variance) ? 0.0f : rate;
+}
+
+/**
+ * Сравнить содержимое снимков без учета версии и времени
+ * - Вес, объем, поток и время до цели сравниваются с точностью до шага
+ *   (SNAPSHOT_*_STEP): дрожание в последних знаках не считается изменением
+ * - Дисперсия потока не сравнивается
+ * - Остальные поля меняются редко и сравниваются точно
+ * @return true если содержимое совпадает
+ */
+inline bool snapshotContentEquals(const SystemSnapshot& a, const SystemSnapshot& b) {
+    return a.state == b.state &&
+           a.error == b.error &&
+           a.fillTarget == b.fillTarget &&
+           a.fillStart == b.fillStart &&
+           a.scaleReady == b.scaleReady &&
+           a.kettlePresent == b.kettlePresent &&
+           a.calibrationDone == b.calibrationDone &&
+           a.factorCalibrated == b.factorCalibrated &&
+           fabsf(a.currentWeight - b.currentWeight) < SNAPSHOT_WEIGHT_STEP &&
+           a.emptyWeight == b.emptyWeight &&
+           fabsf(a.waterVolume - b.waterVolume) < SNAPSHOT_WEIGHT_STEP &&
+           a.calibrationFactor == b.calibrationFactor &&
+           fabsf(a.flowRate - b.flowRate) < SNAPSHOT_FLOW_STEP &&
+           fabsf(a.timeToTarget - b.timeToTarget) < SNAPSHOT_ETA_STEP &&
+           a.pumpOn == b.pumpOn &&
+           a.powerRelayOn == b.powerRelayOn &&
+           a.fillsLearned == b.fillsLearned &&
+           a.fillErrorMean == b.fillErrorMean &&
+           a.fillErrorStd == b.fillErrorStd &&
+           a.stateTransitions == b.stateTransitions &&
+           a.commandLatency == b.commandLatency &&
+           a.commandLatencyMax == b.commandLatencyMax;
+}
+
+/**
+ * Назначить версию новому снимку
+ * Сравнение идет с последним снимком, получившим версию, а не с предыдущим:
+ * медленный дрейф (меньше шага за такт) меняет версию раз в шаг, шум - никогда
+ * @param s - новый снимок
+ * @param versioned - последний снимок, получивший версию (обновляется при смене версии)
+ * @return true если версия изменилась
+ */
+inline bool snapshotAssignVersion(SystemSnapshot& s, SystemSnapshot& versioned) {
+    s.version = versioned.version;
+    if (s.version != 0 && snapshotContentEquals(s, versioned)) return false;
+    s.version++;
+    versioned = s;
+    return true;
+}
+
+#endif
@@ -0,0 +1,82 @@
+// файл: TaskScheduler.cpp
+// Реализация кооперативного планировщика
+
+#include "TaskScheduler.h"
+
+TaskScheduler::TaskScheduler() {
+    taskCount = 0;
+    memset(tasks, 0, sizeof(tasks));
+    resetPending.store(false);
+}
+
+int TaskScheduler::addTask(const char* name, TaskFunction fn, uint32_t periodMs, uint32_t deadlineMs) {
+    if (taskCount >= SCHED_MAX_TASKS || fn == nullptr || periodMs == 0) return -1;
+
+    ScheduledTask& task = tasks[taskCount];
+    memset(&task, 0, sizeof(task));
+    task.name = name;
+    task.fn = fn;
+    task.period = periodMs * 1000UL;
+    task.deadline = (deadlineMs ? deadlineMs : periodMs) * 1000UL;
+    task.nextRun = micros();
+
+    return taskCount++;
+}
+
+uint32_t TaskScheduler::run() {
+    if (resetPending.exchange(false)) resetStats();
+
+    for (uint8_t i = 0; i < taskCount; i++) {
+        ScheduledTask& task = tasks[i];
+
+        uint32_t start = micros();
+        if ((int32_t)(start - task.nextRun) < 0) continue;
+
+        uint32_t jitter = start - task.nextRun;
+        task.fn();
+        uint32_t end = micros();
+
+        uint32_t runTime = end - start;
+        task.runs++;
+        task.lastRunTime = runTime;
+        task.totalRunTime += runTime;
+        if (runTime > task.maxRunTime) task.maxRunTime = runTime;
+        if (jitter > task.maxJitter) task.maxJitter = jitter;
+        if (end - task.nextRun > task.deadline) task.misses++;
+
+        // Следующий запуск по сетке периода; если отстали больше чем
+        // на период - пропущенные запуски не догоняем, а начинаем сетку
+        // заново от фактического запуска (без второго запуска подряд)
+        task.nextRun += task.period;
+        if ((int32_t)(end - task.nextRun) >= (int32_t)task.period) {
+            task.nextRun = start + task.period;
+        }
+    }
+
+    // Сколько осталось до ближайшего запуска
+    uint32_t now = micros();
+    uint32_t idle = SCHED_MAX_IDLE * 1000UL;
+    for (uint8_t i = 0; i < taskCount; i++) {
+        int32_t wait = (int32_t)(tasks[i].nextRun - now);
+        if (wait <= 0) return 0;
+        if ((uint32_t)wait < idle) idle = wait;
+    }
+    return idle / 1000;
+}
+
+void TaskScheduler::resetStats() {
+    for (uint8_t i = 0; i < taskCount; i++) {
+        ScheduledTask& task = tasks[i];
+        task.runs = 0;
+        task.lastRunTime = 0;
+        task.maxRunTime = 0;
+        task.totalRunTime = 0;
+        task.maxJitter = 0;
+        task.misses = 0;
+    }
+}
+
+uint32_t TaskScheduler::getAverageRunTime(uint8_t index) {
+    if (index >= taskCount || tasks[index].runs == 0) return 0;
+    return (uint32_t)(tasks[index].totalRunTime / tasks[index].runs);
+}
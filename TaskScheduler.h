@@ -0,0 +1,88 @@
+// файл: TaskScheduler.h
+// Кооперативный планировщик периодических задач основного цикла
+// Каждая подсистема работает со своим периодом, планировщик ведет статистику
+
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include "config.h"
+#include <atomic>
+
+// ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
+#define SCHED_MAX_TASKS 8              // Максимум задач
+#define SCHED_MAX_IDLE 100             // Максимальное время сна между проходами (мс)
+
+// Функция задачи
+typedef void (*TaskFunction)();
+
+/**
+ * Периодическая задача и ее статистика
+ * Все времена - в микросекундах
+ */
+struct ScheduledTask {
+    const char* name;
+    TaskFunction fn;
+    uint32_t period;
+    uint32_t deadline;      // Допустимое время от планового запуска до завершения
+    uint32_t nextRun;       // Плановое время следующего запуска (micros)
+
+    uint32_t runs;          // Выполнено запусков
+    uint32_t lastRunTime;   // Длительность последнего запуска
+    uint32_t maxRunTime;    // Максимальная длительность запуска
+    uint64_t totalRunTime;  // Суммарное время работы (для среднего)
+    uint32_t maxJitter;     // Максимальное опоздание запуска относительно плана
+    uint32_t misses;        // Запусков, завершившихся позже дедлайна
+};
+
+/**
+ * Кооперативный планировщик
+ * - Задачи регистрируются один раз с периодом и дедлайном
+ * - run() выполняет все задачи, время которых пришло, и сообщает,
+ *   сколько можно спать до следующей
+ * - Задачи не вытесняют друг друга: долгая задача задерживает остальные,
+ *   и это видно по jitter и промахам дедлайна
+ * - План запусков привязан к сетке периода, поэтому задержки не накапливаются
+ */
+class TaskScheduler {
+private:
+    ScheduledTask tasks[SCHED_MAX_TASKS];
+    uint8_t taskCount;
+    std::atomic<bool> resetPending;    // Сброс статистики, запрошенный из другой задачи
+
+public:
+    TaskScheduler();
+
+    /**
+     * Зарегистрировать задачу
+     * @param name - имя для статистики (строка должна жить все время работы)
+     * @param fn - функция задачи
+     * @param periodMs - период запуска (мс)
+     * @param deadlineMs - дедлайн от планового запуска (мс), 0 - равен периоду
+     * @return индекс задачи или -1, если места нет
+     */
+    int addTask(const char* name, TaskFunction fn, uint32_t periodMs, uint32_t deadlineMs = 0);
+
+    /**
+     * Выполнить задачи, время которых пришло
+     * @return сколько можно ждать до следующего запуска (мс)
+     */
+    uint32_t run();
+
+    /** Сбросить статистику всех задач (только из задачи, которая вызывает run()) */
+    void resetStats();
+
+    /**
+     * Запросить сброс статистики из любой задачи или ядра:
+     * его выполнит сам run() в начале следующего прохода
+     */
+    void requestReset() { resetPending.store(true); }
+
+    // ==================== СТАТИСТИКА ====================
+    uint8_t getTaskCount() { return taskCount; }
+    const ScheduledTask& getTask(uint8_t index) { return tasks[index]; }
+
+    /** @return средняя длительность запуска задачи (мкс) */
+    uint32_t getAverageRunTime(uint8_t index);
+};
+
+#endif
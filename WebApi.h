@@ -0,0 +1,119 @@
+// файл: WebApi.h
+// Проверка команд HTTP API по снимку: разбор параметров, налив, остановка, калибровка
+// Без WebServer и Arduino: обработчик передает строки параметров и постановку
+// события в очередь, а сам только отправляет готовый ответ
+
+#ifndef WEB_API_H
+#define WEB_API_H
+
+#include "config.h"
+#include "SystemSnapshot.h"
+#include "FillCommand.h"
+#include <errno.h>
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+
+#define WEB_FILL_MIN_ML 50             // Минимальный объем для /api/fill?ml= (мл)
+
+/**
+ * Ответ команды API: {"success":..., "action":..., "error":..., "message":...}
+ */
+struct ApiResult {
+    int code;                  // Код HTTP
+    const char* error;         // Код ошибки (nullptr - успех)
+    const char* message;
+    float target;              // Цель налива (г), меньше 0 - не выводить
+};
+
+inline ApiResult apiResult(int code, const char* error, const char* message, float target = -1.0f) {
+    ApiResult result = { code, error, message, target };
+    return result;
+}
+
+/**
+ * Разобрать целое число из параметра запроса целиком
+ * В отличие от toInt(): "2abc", "1.5" и пустая строка - ошибка, а не 2, 1 и 0
+ * @return false - нет параметра, пусто, не число, лишние символы или переполнение
+ */
+inline bool parseIntArg(const char* text, int& value) {
+    if (!text) return false;
+    char* end = nullptr;
+    errno = 0;
+    long parsed = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || errno == ERANGE) return false;
+    if (parsed < INT_MIN || parsed > INT_MAX) return false;
+    value = (int)parsed;
+    return true;
+}
+
+/**
+ * /api/fill: ?cups=1-6 и ?full=1 - как команды MQTT 1-7, ?ml= - уровень воды в чайнике
+ * @param cups, full, ml - значения параметров (nullptr - параметра нет)
+ * @param post - bool(float target): поставить EVT_FILL в очередь
+ */
+template <typename Post>
+ApiResult apiFill(const char* cups, const char* full, const char* ml,
+                  const SystemSnapshot& snap, Post post) {
+    // Значение с лишними символами ("2abc") - 400, а не команда по его началу
+    float target = -1.0f;
+    int value = 0;
+    if (cups) {
+        if (parseIntArg(cups, value) && value >= CMD_ONE_CUP && value <= CMD_SIX_CUPS) {
+            target = commandFillTarget(value, snap.currentWeight, snap.emptyWeight);
+        }
+    } else if (full) {
+        if (parseIntArg(full, value) && value == 1) {
+            target = commandFillTarget(CMD_FULL, snap.currentWeight, snap.emptyWeight);
+        }
+    } else if (ml) {
+        if (parseIntArg(ml, value) && value >= WEB_FILL_MIN_ML && value <= (int)FULL_WATER_LEVEL) {
+            target = snap.emptyWeight + value;
+        }
+    }
+    if (target < 0) {
+        return apiResult(400, "bad_request", "Укажите cups=1-6, full=1 или ml=50-1700");
+    }
+
+    bool kettleReady = snap.scaleReady && snap.kettlePresent;
+    switch (checkFill(snap.state, kettleReady, snap.currentWeight, snap.emptyWeight, target)) {
+        case FILL_CHECK_BUSY:
+            return apiResult(409, "busy", "Помпа занята: дождитесь окончания налива или калибровки");
+        case FILL_CHECK_NO_KETTLE:
+            return apiResult(409, "no_kettle", "Чайник не обнаружен");
+        case FILL_CHECK_REACHED:
+            return apiResult(409, "target_reached", "Воды уже достаточно", target);
+        case FILL_CHECK_OK:
+            break;
+    }
+
+    if (!post(target)) return apiResult(503, "queue_full", "Система занята, повторите команду");
+    return apiResult(202, nullptr, "Налив запущен", target);
+}
+
+/**
+ * /api/stop: как команда MQTT 8, останавливать можно только идущий налив
+ * @param post - bool(): поставить EVT_STOP в очередь
+ */
+template <typename Post>
+ApiResult apiStop(const SystemSnapshot& snap, Post post) {
+    if (snap.state != ST_FILLING) return apiResult(409, "not_filling", "Налив не идет");
+    if (!post()) return apiResult(503, "queue_full", "Система занята, повторите команду");
+    return apiResult(202, nullptr, "Налив остановлен");
+}
+
+/**
+ * /api/calibrate: как и налив, начинается только из IDLE на готовых весах
+ * @param post - bool(): поставить EVT_CALIBRATE в очередь
+ */
+template <typename Post>
+ApiResult apiCalibrate(const SystemSnapshot& snap, Post post) {
+    if (snap.state != ST_IDLE) {
+        return apiResult(409, "busy", "Помпа занята: дождитесь окончания налива или калибровки");
+    }
+    if (!snap.scaleReady) return apiResult(409, "scale_not_ready", "Весы не готовы");
+    if (!post()) return apiResult(503, "queue_full", "Система занята, повторите команду");
+    return apiResult(202, nullptr, "Калибровка запущена");
+}
+
+#endif
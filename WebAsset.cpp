@@ -0,0 +1,47 @@
+// файл: WebAsset.cpp
+// Реализация отдачи встроенных веб-ресурсов
+
+#include "WebAsset.h"
+#include "WebAssets.h"
+#include <string.h>
+
+static WebAssetStats stats = {};
+
+const WebAsset* findWebAsset(const char* path) {
+    for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+        if (strcmp(WEB_ASSETS[i].path, path) == 0) return &WEB_ASSETS[i];
+    }
+    return nullptr;
+}
+
+size_t getWebAssetCount() {
+    return WEB_ASSET_COUNT;
+}
+
+const WebAsset& getWebAsset(size_t index) {
+    return WEB_ASSETS[index];
+}
+
+void sendWebAsset(WebServer& server, const WebAsset& asset) {
+    uint32_t start = micros();
+    stats.requests++;
+
+    server.sendHeader("ETag", asset.etag);
+    server.sendHeader("Cache-Control", asset.immutable ? "public, max-age=31536000, immutable" : "no-cache");
+
+    if (server.header("If-None-Match") == asset.etag) {
+        stats.notModified++;
+        server.send(304);
+    } else {
+        server.sendHeader("Content-Encoding", "gzip");
+        server.send_P(200, asset.contentType, (const char*)asset.data, asset.length);
+        stats.bytesSent += asset.length;
+    }
+
+    stats.lastSendUs = micros() - start;
+    if (stats.lastSendUs > stats.maxSendUs) stats.maxSendUs = stats.lastSendUs;
+}
+
+const WebAssetStats& getWebAssetStats() {
+    return stats;
+}
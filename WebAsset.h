@@ -0,0 +1,57 @@
+// файл: WebAsset.h
+// Отдача встроенных в прошивку веб-ресурсов (см. WebAssets.h)
+// Файлы уже сжаты gzip при сборке: отправляются из флеша как есть, без SPIFFS
+
+#ifndef WEB_ASSET_H
+#define WEB_ASSET_H
+
+#include <WebServer.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * Встроенный ресурс
+ * - data - содержимое, сжатое gzip (лежит во флеше)
+ * - etag - хеш минифицированного содержимого в кавычках; он же
+ *   подставляется в ссылки страниц как ?v=, поэтому версионные ресурсы
+ *   можно кэшировать навсегда
+ */
+struct WebAsset {
+    const char* path;           // URL без версии ("/style.css")
+    const char* contentType;
+    const uint8_t* data;
+    size_t length;              // Байт gzip
+    size_t originalLength;      // Байт исходного файла в data/
+    const char* etag;
+    bool immutable;             // true - CSS/JS с версией в URL, false - страницы
+};
+
+/**
+ * Статистика отдачи ресурсов
+ */
+struct WebAssetStats {
+    uint32_t requests;
+    uint32_t notModified;       // Ответов 304
+    uint32_t bytesSent;         // Байт gzip отправлено
+    uint32_t lastSendUs;        // Время отправки последнего ответа (мкс)
+    uint32_t maxSendUs;
+};
+
+/** Найти ресурс по пути запроса, nullptr - нет такого */
+const WebAsset* findWebAsset(const char* path);
+
+/** Количество ресурсов и доступ по номеру (для регистрации маршрутов) */
+size_t getWebAssetCount();
+const WebAsset& getWebAsset(size_t index);
+
+/**
+ * Отправить ресурс: Content-Encoding gzip, ETag, Cache-Control
+ * - Совпавший If-None-Match - ответ 304 без тела (сервер должен
+ *   собирать этот заголовок через collectHeaders)
+ * - Версионные ресурсы: max-age год + immutable, страницы: no-cache
+ */
+void sendWebAsset(WebServer& server, const WebAsset& asset);
+
+const WebAssetStats& getWebAssetStats();
+
+#endif
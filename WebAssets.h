@@ -0,0 +1,697 @@
+// файл: WebAssets.h
+// Веб-ресурсы из data/, сжатые gzip и встроенные в прошивку
+// Сгенерировано tools/embed_web_assets.py - не редактировать вручную
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include "WebAsset.h"
+
+// config.html: 6677 -> 5049 (мин.) -> 1910 (gzip) байт
+static constexpr uint8_t ASSET_CONFIG_HTML[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x58, 0xe9, 0x8e, 0x1b, 0x45,
+    0x10, 0xfe, 0xef, 0xa7, 0x68, 0x1c, 0xc0, 0x5e, 0x11, 0x8f, 0xaf, 0xdd, 0x65, 0xe3, 0x8b, 0x23,
+    0x64, 0x05, 0x12, 0xa7, 0x58, 0x84, 0xf8, 0x05, 0xed, 0x99, 0xb6, 0xdd, 0xec, 0x78, 0x7a, 0xd2,
+    0xd3, 0xde, 0x83, 0xd5, 0x4a, 0x10, 0x4e, 0x29, 0x08, 0xa4, 0xc0, 0x0f, 0xfe, 0x40, 0xc4, 0x1b,
+    0x6c, 0x20, 0x0b, 0x1b, 0x96, 0x90, 0x57, 0x98, 0x79, 0x05, 0x9e, 0x80, 0x47, 0xa0, 0xaa, 0xbb,
+    0xc7, 0x9e, 0xf1, 0xb1, 0x21, 0x41, 0x56, 0xd6, 0xe3, 0x9e, 0xae, 0xaa, 0xaf, 0xaa, 0xbe, 0xaa,
+    0xae, 0x4e, 0xe7, 0x89, 0x97, 0xde, 0xb8, 0xba, 0xf3, 0xde, 0x9b, 0xd7, 0xc8, 0x48, 0x8d, 0xfd,
+    0x5e, 0xa1, 0x93, 0x7e, 0x31, 0xea, 0xc1, 0xd7, 0x98, 0x29, 0x4a, 0x02, 0x3a, 0x66, 0xdd, 0xe2,
+    0x1e, 0x67, 0xfb, 0xa1, 0x90, 0xaa, 0x48, 0x5c, 0x11, 0x28, 0x16, 0xa8, 0x6e, 0x71, 0x9f, 0x7b,
+    0x6a, 0xd4, 0xf5, 0xd8, 0x1e, 0x77, 0x59, 0x45, 0xff, 0xb8, 0x4c, 0x78, 0xc0, 0x15, 0xa7, 0x7e,
+    0x25, 0x72, 0xa9, 0xcf, 0xba, 0xf5, 0x62, 0xaa, 0xc4, 0x1d, 0x51, 0x19, 0x31, 0x10, 0x7a, 0x67,
+    0x67, 0xbb, 0xb2, 0x85, 0xcb, 0x8a, 0x2b, 0x9f, 0xf5, 0xe2, 0x1f, 0xe3, 0x93, 0xe4, 0x93, 0xe4,
+    0x46, 0xf2, 0x71, 0xfc, 0x57, 0x7c, 0x2f, 0xfe, 0x23, 0x3e, 0x21, 0xf1, 0x03, 0x78, 0xbc, 0x0b,
+    0x8f, 0xe7, 0xc9, 0x37, 0xc9, 0x97, 0xf1, 0x69, 0x7c, 0x3f, 0x3e, 0x4b, 0xbe, 0x35, 0xcb, 0x7f,
+    0xc6, 0x0f, 0x92, 0x9b, 0x9d, 0xaa, 0x91, 0x2d, 0x74, 0x22, 0x75, 0x88, 0xdf, 0x7d, 0xe1, 0x1d,
+    0x92, 0x23, 0x32, 0x00, 0x60, 0x95, 0x01, 0x1d, 0x73, 0xff, 0xb0, 0x45, 0x5e, 0x90, 0x00, 0xa3,
+    0x4d, 0x14, 0x3b, 0x50, 0x15, 0xea, 0xf3, 0x61, 0xd0, 0x22, 0x2e, 0xa0, 0x66, 0xb2, 0x4d, 0xc6,
+    0x54, 0x0e, 0x79, 0x50, 0x51, 0x22, 0x6c, 0x91, 0x8d, 0x5a, 0x78, 0xd0, 0x26, 0x7d, 0xea, 0xee,
+    0x0e, 0xa5, 0x98, 0x04, 0x5e, 0x8b, 0x5c, 0x1a, 0xd4, 0xf0, 0xd3, 0x26, 0xc7, 0x05, 0x07, 0x5d,
+    0xa5, 0x3c, 0x60, 0x12, 0xb4, 0x8f, 0xe9, 0x81, 0x71, 0xb2, 0x45, 0xd6, 0x6b, 0x5a, 0xca, 0xe8,
+    0x69, 0x91, 0x1a, 0xa1, 0x13, 0x25, 0xf2, 0x5a, 0xf6, 0x47, 0x5c, 0xb1, 0x36, 0x09, 0xa9, 0xe7,
+    0xf1, 0x60, 0xd8, 0x22, 0x4d, 0x63, 0x47, 0x48, 0x8f, 0xc9, 0x8a, 0xa4, 0x1e, 0x9f, 0x44, 0x2d,
+    0x52, 0xb7, 0x8b, 0x07, 0x95, 0x68, 0x44, 0x3d, 0xb1, 0x8f, 0xaa, 0x1a, 0xe1, 0x81, 0x5e, 0x27,
+    0x72, 0xd8, 0xa7, 0xe5, 0xda, 0x65, 0xfd, 0x71, 0xea, 0x6b, 0x88, 0x67, 0x54, 0x07, 0x1c, 0xae,
+    0xf0, 0x85, 0x04, 0x98, 0xcd, 0x66, 0xb3, 0x6d, 0x5c, 0x8e, 0xf8, 0x47, 0xac, 0x45, 0x1a, 0xeb,
+    0xa8, 0x0c, 0x36, 0x35, 0x32, 0x9b, 0x36, 0x37, 0x37, 0x73, 0x9b, 0xea, 0x5b, 0x33, 0xe0, 0x26,
+    0x00, 0x8d, 0x9a, 0x11, 0xf3, 0x69, 0x9f, 0xf9, 0x20, 0xe9, 0xf1, 0x28, 0xf4, 0x29, 0x04, 0xb0,
+    0xef, 0x0b, 0x77, 0x77, 0xe6, 0x24, 0xee, 0x03, 0x78, 0x1b, 0xb8, 0x3b, 0x1b, 0x54, 0x9f, 0x0d,
+    0x54, 0x3b, 0x6f, 0xef, 0xb8, 0x10, 0x31, 0x9f, 0xb9, 0x0a, 0xd9, 0x10, 0x4e, 0x14, 0x28, 0xb5,
+    0x71, 0xab, 0xd7, 0x6a, 0x4f, 0x65, 0x62, 0x52, 0x6f, 0x64, 0xc0, 0xf4, 0x85, 0x52, 0x62, 0x9c,
+    0xe2, 0x31, 0x81, 0x82, 0x2d, 0x60, 0x34, 0x12, 0x3e, 0xf7, 0xc8, 0x25, 0xcf, 0xf3, 0x16, 0x02,
+    0xb8, 0x31, 0x8d, 0x1f, 0xff, 0x48, 0xab, 0xb4, 0xef, 0x61, 0x29, 0xef, 0xf6, 0xa6, 0x71, 0xb2,
+    0x3f, 0x01, 0x23, 0x01, 0x00, 0xca, 0x25, 0x7c, 0xfd, 0xea, 0x0b, 0xdb, 0x1b, 0xb5, 0xa9, 0x13,
+    0x36, 0x75, 0x29, 0x84, 0x40, 0x04, 0xd9, 0x44, 0xd6, 0xb5, 0xcd, 0x85, 0x90, 0x2e, 0x03, 0xe6,
+    0x4e, 0x64, 0x84, 0x0a, 0x43, 0xc1, 0x0d, 0xf1, 0x72, 0x61, 0x48, 0xd1, 0xb4, 0x46, 0x62, 0x4f,
+    0x13, 0x2c, 0x8f, 0x69, 0x83, 0xd6, 0xd6, 0xaf, 0x68, 0x12, 0x42, 0x29, 0x41, 0x78, 0xd4, 0x02,
+    0xec, 0x46, 0xfd, 0xca, 0xe6, 0x76, 0x73, 0x45, 0x00, 0x33, 0x72, 0xcb, 0x0d, 0xd4, 0xfa, 0xcf,
+    0x7a, 0x1e, 0x35, 0x1b, 0x21, 0x57, 0x7c, 0x31, 0x2c, 0x83, 0x2b, 0xf8, 0x59, 0x70, 0x7d, 0x99,
+    0xa7, 0xab, 0x20, 0xf0, 0x60, 0x20, 0xe6, 0xd9, 0x98, 0x12, 0x4a, 0x93, 0xbc, 0x96, 0x0f, 0xa5,
+    0xa5, 0xf0, 0xa5, 0x48, 0x51, 0x35, 0x89, 0x74, 0xd1, 0xcd, 0x33, 0x75, 0x86, 0xa6, 0xb6, 0x0a,
+    0xcd, 0x94, 0xc2, 0x26, 0x75, 0x80, 0xc3, 0x17, 0x14, 0x85, 0xb2, 0xf4, 0xe6, 0x81, 0x0f, 0x85,
+    0x5d, 0xb1, 0x2c, 0xb7, 0x99, 0x31, 0x26, 0x46, 0x8c, 0x0f, 0x47, 0x6a, 0x9e, 0x8a, 0xcd, 0x19,
+    0x15, 0x07, 0x4d, 0xfc, 0x4c, 0x8d, 0x6b, 0x74, 0x99, 0xd7, 0xcd, 0xf5, 0x2b, 0x5b, 0x5e, 0x7f,
+    0x11, 0x1b, 0x66, 0x9d, 0x06, 0x7c, 0x4c, 0x31, 0xda, 0x2d, 0x12, 0x85, 0x3c, 0x20, 0xf5, 0x88,
+    0x20, 0x0e, 0x2a, 0x01, 0xd0, 0x00, 0x9b, 0xa7, 0x06, 0xfc, 0xfc, 0x2e, 0x3b, 0x1c, 0x48, 0xe8,
+    0xbb, 0x91, 0xd9, 0x75, 0x44, 0x6a, 0x4f, 0xc1, 0x1f, 0x25, 0x69, 0x10, 0x0d, 0x84, 0x84, 0x10,
+    0x4b, 0x01, 0x21, 0x62, 0xe5, 0x9a, 0xc7, 0x86, 0xd8, 0x1a, 0x34, 0xa7, 0x96, 0xee, 0x68, 0x6e,
+    0x4e, 0xf7, 0x40, 0x20, 0x02, 0xa1, 0x58, 0x26, 0x21, 0x5b, 0x5b, 0x5b, 0xf9, 0x04, 0x34, 0x96,
+    0x97, 0x77, 0x36, 0x0d, 0x95, 0xfa, 0x45, 0x29, 0xef, 0x54, 0x6d, 0x4f, 0xee, 0x44, 0xae, 0xe4,
+    0xa1, 0xea, 0x15, 0x06, 0x93, 0xc0, 0xd0, 0x0b, 0xf9, 0xf8, 0x3a, 0x53, 0xfb, 0x42, 0xee, 0x46,
+    0xe5, 0x35, 0x72, 0x54, 0xf0, 0x84, 0x3b, 0x19, 0x43, 0x4f, 0x76, 0x86, 0x4c, 0x5d, 0xf3, 0x19,
+    0x3e, 0xbe, 0x78, 0xf8, 0x8a, 0x57, 0x2e, 0x99, 0xf4, 0x97, 0xd6, 0x1c, 0xad, 0xcb, 0xb1, 0x39,
+    0x23, 0x5d, 0x52, 0xd2, 0xe9, 0x2a, 0xb5, 0xff, 0x83, 0x28, 0x0f, 0xa0, 0x6d, 0xbf, 0xbc, 0xf3,
+    0xda, 0xab, 0x28, 0xd6, 0xf1, 0xf8, 0x1e, 0x71, 0x7d, 0x1a, 0x45, 0xdd, 0xa2, 0xe5, 0x42, 0xb1,
+    0xd7, 0xa9, 0xc2, 0x6a, 0x8f, 0xc4, 0x3f, 0xe3, 0xa9, 0xa3, 0x0f, 0x19, 0x3c, 0x83, 0x7e, 0x31,
+    0xcf, 0xf1, 0x29, 0x79, 0x97, 0x57, 0xb6, 0x39, 0x49, 0x3e, 0x89, 0x4f, 0x93, 0x1b, 0x70, 0x0a,
+    0xdd, 0x73, 0x1c, 0x07, 0x2c, 0x0f, 0x98, 0x72, 0x47, 0xe5, 0x52, 0x15, 0xbd, 0x29, 0xad, 0x15,
+    0x1c, 0x35, 0x62, 0x41, 0x59, 0xb2, 0x28, 0x14, 0x41, 0xc4, 0x48, 0xb7, 0x47, 0xd2, 0x67, 0xe7,
+    0xc3, 0x48, 0x04, 0xe5, 0xb5, 0x74, 0x8b, 0x47, 0xe1, 0x14, 0x84, 0xd7, 0x47, 0x05, 0x9f, 0x29,
+    0x62, 0x1a, 0x24, 0x40, 0x5b, 0xed, 0x48, 0xc4, 0xbd, 0xd2, 0x5a, 0xdb, 0xb6, 0xd2, 0x39, 0x77,
+    0x44, 0xa8, 0x23, 0xba, 0x47, 0xfd, 0x09, 0x1c, 0xcd, 0xc5, 0x5e, 0xa5, 0x42, 0xe2, 0x5b, 0xc9,
+    0xcd, 0xf8, 0x0e, 0x60, 0xfd, 0x18, 0x1c, 0xb9, 0x31, 0x07, 0x3f, 0xf9, 0x9a, 0x54, 0x2a, 0x9d,
+    0xaa, 0x11, 0xeb, 0x81, 0x17, 0x7c, 0x40, 0x34, 0x22, 0x27, 0xb0, 0x09, 0x21, 0x4f, 0x3f, 0x4d,
+    0x72, 0x0b, 0x8e, 0xcf, 0x82, 0xa1, 0x1a, 0x91, 0x1e, 0xa9, 0xe9, 0x5c, 0xe5, 0xde, 0x01, 0xc3,
+    0xae, 0x51, 0x08, 0x83, 0x5d, 0x98, 0xf9, 0x65, 0x81, 0x65, 0xfc, 0x72, 0x25, 0x03, 0x1a, 0x5a,
+    0xd7, 0xca, 0x25, 0xb3, 0x01, 0x1d, 0x33, 0x4f, 0x8e, 0xf6, 0x01, 0x04, 0xac, 0x2a, 0x07, 0xfd,
+    0x6e, 0x9b, 0x18, 0x01, 0x01, 0xa9, 0x8f, 0xfe, 0xfe, 0x73, 0xfb, 0xbb, 0xdf, 0x2c, 0xe8, 0x74,
+    0x9b, 0x84, 0x7d, 0x80, 0xad, 0xb2, 0x01, 0xe8, 0xf2, 0x1b, 0xd3, 0x7f, 0x20, 0xc0, 0x7c, 0x48,
+    0xc9, 0x32, 0xa9, 0x67, 0x97, 0x4a, 0x95, 0x8c, 0x5d, 0x16, 0xb8, 0xf2, 0x30, 0x54, 0xcc, 0xcb,
+    0xa0, 0xb2, 0x6b, 0xe8, 0xdb, 0x73, 0x28, 0xf0, 0xfd, 0xad, 0x12, 0x69, 0xe9, 0x87, 0xef, 0x4a,
+    0x53, 0x57, 0xb0, 0x6e, 0x40, 0xe6, 0x83, 0x27, 0x8f, 0x8c, 0xee, 0x63, 0xf2, 0xe4, 0x51, 0xd6,
+    0x2d, 0xfc, 0x3d, 0x55, 0x7e, 0xfc, 0xc1, 0x34, 0xb7, 0x34, 0x0c, 0x59, 0xe0, 0x5d, 0x1d, 0x71,
+    0xdf, 0x2b, 0x1b, 0x55, 0x10, 0x9e, 0xe3, 0xb5, 0xf6, 0xe3, 0x14, 0x08, 0xb6, 0x3c, 0x40, 0x74,
+    0x4c, 0xb4, 0xef, 0x47, 0x8f, 0x5a, 0x28, 0x50, 0x0c, 0xc8, 0xf6, 0x33, 0x02, 0x35, 0x70, 0x8a,
+    0x7f, 0x4e, 0x60, 0x28, 0xbb, 0x8b, 0x33, 0x58, 0x72, 0xd3, 0x21, 0xf1, 0x6d, 0x28, 0x90, 0x07,
+    0xba, 0x4c, 0xee, 0x24, 0x9f, 0xc6, 0xf7, 0x34, 0xcf, 0x80, 0x61, 0xf7, 0x4d, 0xdd, 0x60, 0x79,
+    0x1c, 0x03, 0x70, 0x98, 0x9b, 0x28, 0x16, 0x09, 0x93, 0x52, 0x48, 0xc3, 0x8d, 0x47, 0x85, 0xf1,
+    0x53, 0xf2, 0x15, 0xd4, 0xe0, 0x1d, 0x3d, 0x0f, 0x82, 0x81, 0x25, 0x05, 0x0a, 0x13, 0xe1, 0xac,
+    0x34, 0x21, 0x15, 0xe4, 0x19, 0xa2, 0xed, 0x99, 0xc8, 0x1d, 0xcf, 0xda, 0x0e, 0x10, 0x8c, 0x03,
+    0x7b, 0xd9, 0x36, 0x74, 0x45, 0xdd, 0x76, 0x34, 0xb7, 0x20, 0x1d, 0x0f, 0xaf, 0x3e, 0x43, 0x4e,
+    0xc3, 0x8a, 0x7d, 0x3e, 0xe0, 0x6f, 0x42, 0x03, 0xb9, 0x48, 0x0a, 0xf7, 0xbc, 0x1f, 0xc2, 0x26,
+    0x48, 0xf9, 0x9c, 0xf8, 0xf8, 0xba, 0x52, 0xef, 0x44, 0x70, 0x0c, 0x5f, 0x20, 0x8e, 0x7b, 0xde,
+    0x9f, 0xc0, 0x26, 0x9c, 0xb8, 0x17, 0xc5, 0x1f, 0x66, 0x5d, 0x8b, 0x2f, 0x5a, 0x47, 0xfe, 0x3f,
+    0x81, 0xfe, 0xa0, 0xef, 0x30, 0x94, 0x4b, 0xa8, 0x42, 0x9d, 0xc8, 0xdf, 0x20, 0x90, 0xe7, 0x3a,
+    0x8d, 0x30, 0x7f, 0xc7, 0x27, 0x97, 0x49, 0xfc, 0xcb, 0x85, 0x2d, 0x04, 0x8b, 0x56, 0x32, 0x35,
+    0x91, 0x01, 0x19, 0x50, 0x60, 0x17, 0x46, 0x59, 0x2b, 0x4f, 0x43, 0xf3, 0x1f, 0x0c, 0xc0, 0xe7,
+    0x14, 0xf8, 0x64, 0xd4, 0xc3, 0x44, 0x7f, 0xa2, 0x53, 0x7a, 0x0e, 0xfd, 0x49, 0xdb, 0x5a, 0x69,
+    0x22, 0x0d, 0xdf, 0x23, 0x9b, 0x38, 0x8b, 0xff, 0x4c, 0xef, 0x0e, 0x60, 0x25, 0xfe, 0xdd, 0x10,
+    0x48, 0xb3, 0xe6, 0x1c, 0x5e, 0xbc, 0xf6, 0xd6, 0xce, 0x0e, 0x29, 0xc7, 0xe7, 0xb0, 0xfc, 0x2b,
+    0xec, 0xbd, 0x4f, 0x5e, 0x62, 0xd4, 0x1f, 0x02, 0x5b, 0xd6, 0x2e, 0x84, 0xf2, 0xbf, 0xbd, 0xb5,
+    0x76, 0xb3, 0x4b, 0x17, 0x5a, 0xb6, 0xbf, 0x95, 0x9c, 0xe8, 0x9f, 0xfb, 0x3c, 0x80, 0xeb, 0x82,
+    0x23, 0x02, 0x3c, 0xcc, 0x80, 0x13, 0x29, 0xd9, 0x35, 0xbf, 0xf3, 0xe7, 0x2c, 0x6c, 0x6f, 0xe3,
+    0xa9, 0x6c, 0x4f, 0xe3, 0x4e, 0xd5, 0x5e, 0xed, 0xf0, 0xce, 0x04, 0x5f, 0x99, 0x83, 0x71, 0x7a,
+    0xd9, 0xc1, 0xdb, 0xd9, 0xa8, 0xfe, 0x98, 0x57, 0x33, 0x10, 0x2c, 0x74, 0xc2, 0x54, 0x27, 0x0e,
+    0x80, 0xc5, 0x39, 0x4d, 0x19, 0x6a, 0x41, 0xa3, 0xd1, 0x91, 0x58, 0xa6, 0x17, 0x43, 0xf6, 0xc7,
+    0x34, 0x2a, 0x9d, 0x6a, 0x88, 0xa0, 0xcd, 0xfc, 0x6e, 0x95, 0xa7, 0x03, 0x6e, 0x91, 0x88, 0xc0,
+    0xf5, 0xb9, 0xbb, 0x6b, 0x96, 0x66, 0xbe, 0x17, 0x7b, 0xd0, 0xa0, 0x3f, 0x5b, 0x72, 0xc2, 0xeb,
+    0x13, 0x31, 0x77, 0xbe, 0x9f, 0x75, 0xaa, 0x46, 0x39, 0x58, 0xc1, 0xf9, 0x89, 0x50, 0x1d, 0xd0,
+    0x6e, 0xb1, 0x1a, 0xd1, 0x3d, 0x56, 0x24, 0x70, 0x89, 0x1d, 0x09, 0xaf, 0x5b, 0x0c, 0x45, 0xa4,
+    0xd0, 0x5e, 0x34, 0xe9, 0x8f, 0x39, 0x5c, 0x67, 0x6d, 0x62, 0xf2, 0x4d, 0xa6, 0x98, 0x0f, 0xac,
+    0x9d, 0xaf, 0x75, 0x58, 0x1b, 0x8b, 0x61, 0x3d, 0x33, 0x48, 0x20, 0x74, 0x0d, 0xd8, 0x61, 0xee,
+    0x61, 0x00, 0x01, 0xe4, 0xa0, 0x68, 0x21, 0x78, 0x17, 0x1f, 0xec, 0xad, 0x4e, 0x55, 0x8b, 0xe0,
+    0xc4, 0x65, 0x86, 0x0a, 0xee, 0x59, 0x51, 0x7b, 0x73, 0x37, 0xcf, 0x92, 0x5d, 0x9f, 0x70, 0xc9,
+    0x30, 0xf5, 0xcb, 0xa6, 0x87, 0x55, 0x43, 0xd0, 0xac, 0xc7, 0x66, 0x27, 0x08, 0x24, 0x94, 0x36,
+    0x96, 0x07, 0x9c, 0xeb, 0x7f, 0x80, 0xfc, 0xf6, 0x7c, 0x7d, 0x67, 0xc0, 0x9a, 0xab, 0xa1, 0x3a,
+    0x0c, 0x01, 0xc2, 0x54, 0x44, 0x63, 0xcf, 0x6b, 0xb1, 0x4e, 0xcc, 0x2d, 0xc2, 0x71, 0xe7, 0xb2,
+    0x91, 0xf0, 0x61, 0xbe, 0xee, 0x16, 0xe3, 0x5b, 0x0f, 0x69, 0x2b, 0x39, 0xef, 0xf5, 0xd4, 0xf7,
+    0x68, 0xf9, 0x31, 0xd5, 0x3a, 0x2d, 0x50, 0x9b, 0xa9, 0x29, 0xc9, 0x71, 0xa8, 0xc6, 0x3c, 0xe5,
+    0x51, 0xdc, 0xd5, 0x31, 0x84, 0x73, 0xd3, 0xb4, 0xa1, 0xdf, 0x89, 0x39, 0x39, 0x93, 0xcf, 0xe0,
+    0x07, 0xb6, 0x9e, 0x4e, 0xa4, 0xa4, 0x08, 0x86, 0x3d, 0xcf, 0xaa, 0x75, 0xe4, 0x04, 0x87, 0x67,
+    0xbd, 0x46, 0xfe, 0xfe, 0xe2, 0x16, 0x81, 0xdd, 0x27, 0xd0, 0xb0, 0xf0, 0xf4, 0x3d, 0x37, 0x10,
+    0xde, 0x66, 0x12, 0x6e, 0x72, 0xa6, 0x14, 0x32, 0x61, 0xcf, 0x9d, 0x1b, 0x00, 0xe4, 0x87, 0x87,
+    0xf7, 0xbc, 0x15, 0x89, 0xc0, 0x09, 0xc6, 0x24, 0x21, 0xaf, 0xd3, 0x26, 0x61, 0x6e, 0x71, 0x3e,
+    0x09, 0x27, 0xc9, 0x57, 0x24, 0xd3, 0x4a, 0x4d, 0x65, 0xff, 0x95, 0xdc, 0x98, 0x16, 0x71, 0x2e,
+    0x0f, 0xf3, 0x0e, 0xac, 0xe0, 0xcd, 0x05, 0x68, 0xf3, 0xb4, 0xc9, 0x2b, 0xc9, 0x22, 0x5e, 0x4d,
+    0x1b, 0x8d, 0x78, 0xa1, 0x2f, 0xaf, 0xc6, 0x6c, 0xb9, 0x63, 0xdb, 0x90, 0x41, 0x61, 0x3a, 0x01,
+    0xa0, 0xfe, 0x19, 0xe4, 0x3e, 0xd7, 0x49, 0xc3, 0x32, 0xc2, 0x0e, 0x83, 0x73, 0x54, 0xbe, 0xb3,
+    0xe9, 0x75, 0x60, 0xd7, 0xb7, 0x99, 0x76, 0x53, 0xc5, 0x7e, 0x63, 0x19, 0xa9, 0x6b, 0x57, 0x8f,
+    0x44, 0xe9, 0xfd, 0x64, 0x6a, 0xb4, 0x6a, 0x3b, 0x76, 0x55, 0xff, 0x17, 0xdd, 0xbf, 0xec, 0xff,
+    0x6b, 0x6e, 0xb9, 0x13, 0x00, 0x00,
+};
+
+// dashboard.html: 5523 -> 3913 (мин.) -> 1250 (gzip) байт
+static constexpr uint8_t ASSET_DASHBOARD_HTML[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x57, 0xdd, 0x6e, 0x1b, 0x45,
+    0x14, 0xbe, 0xcf, 0x53, 0x0c, 0x2b, 0x21, 0x25, 0x12, 0x8e, 0x63, 0xc7, 0x09, 0x25, 0xd8, 0x46,
+    0x22, 0xad, 0xef, 0x2a, 0x52, 0x35, 0x50, 0x71, 0x39, 0xde, 0x9d, 0xd8, 0x43, 0x66, 0x7f, 0x98,
+    0x19, 0xdb, 0xf8, 0x2e, 0x7f, 0x14, 0xa1, 0x82, 0x82, 0x10, 0x57, 0x91, 0x4a, 0x08, 0xbd, 0xe0,
+    0xd6, 0xb8, 0x4d, 0xe5, 0x34, 0x89, 0xf3, 0x0a, 0xb3, 0xaf, 0xc0, 0x0b, 0xc0, 0x23, 0x70, 0x66,
+    0x76, 0xfd, 0xbf, 0x76, 0x9d, 0x36, 0x17, 0xd6, 0x7a, 0xce, 0xee, 0xf9, 0xce, 0x99, 0x6f, 0xce,
+    0x9c, 0x9f, 0xfc, 0x07, 0xf7, 0xbf, 0xd8, 0xdc, 0xfe, 0x7a, 0xeb, 0x01, 0xaa, 0x4a, 0x97, 0x15,
+    0x17, 0xf2, 0xfa, 0x81, 0x18, 0xf6, 0x2a, 0x05, 0x8b, 0xd7, 0x2c, 0x2d, 0x20, 0xd8, 0x81, 0x87,
+    0x4b, 0x24, 0x46, 0x76, 0x15, 0x73, 0x41, 0x64, 0xc1, 0xfa, 0x72, 0xbb, 0x94, 0xba, 0x67, 0xf5,
+    0xc4, 0x1e, 0x76, 0x49, 0xc1, 0xaa, 0x53, 0xd2, 0x08, 0x7c, 0x2e, 0x2d, 0x64, 0xfb, 0x9e, 0x24,
+    0x1e, 0x7c, 0xd6, 0xa0, 0x8e, 0xac, 0x16, 0x1c, 0x52, 0xa7, 0x36, 0x49, 0x99, 0xc5, 0x47, 0x88,
+    0x7a, 0x54, 0x52, 0xcc, 0x52, 0xc2, 0xc6, 0x8c, 0x14, 0x32, 0x1a, 0x44, 0x52, 0xc9, 0x48, 0x51,
+    0xbd, 0x50, 0x57, 0xea, 0x5a, 0xb5, 0xc2, 0x63, 0xa4, 0x6e, 0x54, 0x17, 0x16, 0x37, 0xaa, 0x85,
+    0x52, 0x7a, 0xd1, 0x02, 0xf9, 0xb9, 0xba, 0x0c, 0x7f, 0x42, 0xe1, 0xa1, 0xba, 0x09, 0xf7, 0x40,
+    0xd0, 0x56, 0x97, 0x20, 0xba, 0x56, 0x9d, 0xf0, 0x38, 0x9f, 0x8e, 0x00, 0x16, 0xf2, 0x8c, 0x7a,
+    0xbb, 0x88, 0x13, 0x56, 0xb0, 0x84, 0x6c, 0x32, 0x22, 0xaa, 0x84, 0x80, 0x3b, 0x55, 0x4e, 0x76,
+    0x0a, 0x56, 0xda, 0x88, 0x96, 0x6d, 0x21, 0x3e, 0xab, 0x17, 0x3e, 0xc9, 0xd9, 0xf7, 0xd6, 0x56,
+    0x57, 0x70, 0x6e, 0x4d, 0xdb, 0x4f, 0xc7, 0x7b, 0x2c, 0xfb, 0x4e, 0x13, 0x1e, 0x0e, 0xad, 0x23,
+    0x9b, 0x61, 0x21, 0x0a, 0x96, 0xde, 0x09, 0xa6, 0x1e, 0xe1, 0xd6, 0xa8, 0x5c, 0x2b, 0x44, 0xc2,
+    0x6a, 0xa6, 0xf8, 0xdf, 0xe9, 0x49, 0x0b, 0x25, 0x7a, 0x0f, 0xc8, 0x99, 0x24, 0xc5, 0x54, 0xb9,
+    0x26, 0xa5, 0xef, 0x09, 0x0d, 0x10, 0xfd, 0x45, 0xbe, 0x67, 0x33, 0x6a, 0xef, 0x82, 0xe7, 0x55,
+    0xbf, 0xb1, 0x59, 0x85, 0x03, 0x20, 0x5b, 0xa0, 0xd1, 0xf0, 0xb9, 0x73, 0x1f, 0xe8, 0xf2, 0x2b,
+    0x8b, 0x4b, 0x56, 0x0f, 0xa4, 0x2c, 0x3d, 0x04, 0xbf, 0x94, 0x20, 0xe0, 0x9f, 0x83, 0x79, 0xd3,
+    0x02, 0x1f, 0x7e, 0xfb, 0x05, 0xa9, 0x33, 0x30, 0x1b, 0x91, 0x72, 0x00, 0x5c, 0x69, 0x0f, 0x80,
+    0xab, 0xae, 0x26, 0x2e, 0x9f, 0x8e, 0xec, 0x80, 0x41, 0xdc, 0x23, 0x04, 0x40, 0xfd, 0x9a, 0x9c,
+    0x40, 0x75, 0xb4, 0x6d, 0xd8, 0x9b, 0xfa, 0x35, 0x7c, 0xa6, 0x2e, 0xc2, 0x03, 0xd5, 0xc9, 0xa7,
+    0xb1, 0x66, 0x09, 0xb6, 0x31, 0x78, 0x0c, 0x93, 0x84, 0xb9, 0x63, 0xa8, 0xc8, 0x16, 0xd5, 0x9f,
+    0x60, 0xff, 0x4d, 0x78, 0x18, 0xfe, 0x08, 0xcf, 0x73, 0x14, 0xee, 0xab, 0x6e, 0xb8, 0x0f, 0x10,
+    0xdd, 0xf0, 0x58, 0xbb, 0xa5, 0xce, 0x81, 0x91, 0xec, 0xa8, 0x36, 0xf5, 0x76, 0xfc, 0x54, 0x85,
+    0x53, 0xc7, 0x4a, 0x90, 0x53, 0x49, 0x5c, 0x2d, 0x17, 0x01, 0xf6, 0x46, 0x5e, 0x30, 0x5c, 0x26,
+    0x4c, 0xfb, 0xa8, 0xce, 0xc3, 0x7d, 0x14, 0xfe, 0x00, 0x11, 0x71, 0x61, 0x2c, 0xbc, 0xd1, 0xac,
+    0xeb, 0xcf, 0x93, 0xb4, 0xea, 0x98, 0xd5, 0x88, 0x85, 0xa8, 0x03, 0x4e, 0xd7, 0x38, 0x87, 0x18,
+    0x7d, 0x42, 0x68, 0xa5, 0x2a, 0xad, 0x62, 0x0a, 0xe2, 0xec, 0x65, 0x5f, 0x71, 0x72, 0x8f, 0xb7,
+    0xf1, 0x06, 0x22, 0xf4, 0x30, 0xda, 0xb5, 0x7a, 0xa9, 0xba, 0x73, 0x79, 0x43, 0xdc, 0x40, 0x36,
+    0xef, 0xda, 0x97, 0xae, 0x7a, 0x35, 0x27, 0x19, 0x0d, 0x2c, 0x09, 0xff, 0xca, 0x67, 0x35, 0x97,
+    0x44, 0xe6, 0xaf, 0xd4, 0xe5, 0x7b, 0x3b, 0x70, 0x12, 0xee, 0xc1, 0x6d, 0x7d, 0xad, 0x03, 0x62,
+    0xce, 0x13, 0x09, 0x84, 0xb6, 0x3e, 0x6e, 0x78, 0xae, 0xb8, 0x7b, 0x61, 0x02, 0xbd, 0xad, 0xa3,
+    0x5f, 0x47, 0x7e, 0x5b, 0x6f, 0x3e, 0x7c, 0x36, 0x19, 0x6d, 0x01, 0xf7, 0x2b, 0x9c, 0x08, 0x91,
+    0x9a, 0x76, 0xb3, 0xfb, 0x1f, 0x94, 0x31, 0x8f, 0xfc, 0xea, 0x49, 0x3e, 0xd7, 0x02, 0x93, 0x44,
+    0xe2, 0xc4, 0xb6, 0x81, 0x56, 0x3e, 0xb4, 0x8a, 0xd3, 0xfd, 0xeb, 0x43, 0x19, 0x46, 0x44, 0x8f,
+    0xac, 0xe2, 0xca, 0x28, 0xbf, 0x86, 0x13, 0x6d, 0xc8, 0xc5, 0xdf, 0xf5, 0xce, 0x20, 0xf3, 0xf1,
+    0xca, 0x4a, 0xe2, 0x29, 0xcc, 0x66, 0xe1, 0x6c, 0xfc, 0xba, 0xe9, 0x1b, 0xd8, 0x31, 0xa2, 0x73,
+    0x75, 0x95, 0xc4, 0x87, 0x90, 0x58, 0xd6, 0x44, 0xd2, 0xfd, 0x8b, 0xdf, 0x24, 0x1d, 0x73, 0xfc,
+    0xaa, 0x77, 0xd0, 0x7f, 0x00, 0xf8, 0x6b, 0xb0, 0x76, 0xb5, 0x91, 0x78, 0xce, 0xf1, 0xd7, 0x43,
+    0x27, 0x2d, 0x9a, 0x02, 0x50, 0x1f, 0x83, 0x9c, 0x24, 0x1d, 0xf8, 0x3b, 0x39, 0xf1, 0xd7, 0x20,
+    0x03, 0xcc, 0xeb, 0xc6, 0x2e, 0x91, 0x50, 0x36, 0xb6, 0xe0, 0x88, 0x20, 0x11, 0xdc, 0x95, 0x23,
+    0x4f, 0x68, 0x89, 0xce, 0xeb, 0x40, 0x83, 0xee, 0xd0, 0xc7, 0x46, 0x7a, 0x57, 0xd6, 0x1f, 0x3e,
+    0xda, 0xde, 0x9e, 0xd7, 0xba, 0xfb, 0xad, 0x94, 0xd3, 0xad, 0xcf, 0x15, 0x6f, 0xcf, 0x81, 0xf4,
+    0x4b, 0xa0, 0xbc, 0x3d, 0xe3, 0xc6, 0x45, 0x75, 0xa7, 0x1f, 0x61, 0x71, 0xb9, 0x1b, 0xab, 0x39,
+    0x01, 0xa7, 0xae, 0xae, 0x63, 0x83, 0x32, 0xb8, 0x43, 0x19, 0xdb, 0x84, 0x8c, 0xb0, 0x98, 0x59,
+    0x82, 0xeb, 0x80, 0xa0, 0xa8, 0x44, 0xd9, 0xc4, 0xe4, 0xf7, 0x7e, 0x2d, 0xbb, 0x35, 0x5a, 0x16,
+    0xd0, 0xb2, 0xc3, 0x68, 0x9d, 0xf7, 0x41, 0x5b, 0x05, 0xb4, 0xd5, 0x3b, 0x43, 0xcb, 0x01, 0x5a,
+    0xee, 0xce, 0xd0, 0xd6, 0x00, 0x6d, 0x6d, 0x80, 0x66, 0xb2, 0xf0, 0xbb, 0xa3, 0xad, 0x03, 0xda,
+    0xfa, 0xed, 0xd0, 0x44, 0xcd, 0xb6, 0x21, 0xfb, 0x8d, 0xa1, 0x95, 0x6a, 0x8c, 0x41, 0x2b, 0x53,
+    0x54, 0xa7, 0xba, 0x31, 0x81, 0x6c, 0x0d, 0x3d, 0xc6, 0x48, 0xfd, 0x7e, 0x2b, 0x6e, 0xdc, 0x9f,
+    0x0c, 0x75, 0x4c, 0xd2, 0x0f, 0x4a, 0x34, 0x82, 0xfd, 0xe7, 0xf8, 0xe2, 0xdf, 0x0e, 0xb4, 0x60,
+    0x67, 0xa6, 0xfc, 0xde, 0x0c, 0x81, 0xcd, 0x15, 0xd0, 0x27, 0x71, 0x40, 0xff, 0x1d, 0x97, 0x13,
+    0x13, 0x6d, 0xe3, 0x11, 0x0d, 0x8d, 0x2b, 0x2d, 0x73, 0x2c, 0x29, 0x84, 0xb5, 0x2e, 0x62, 0x5a,
+    0x39, 0xd0, 0xba, 0xdd, 0xf0, 0xe7, 0xf0, 0x28, 0x3c, 0x82, 0x8c, 0xfb, 0x54, 0x27, 0x5f, 0xd8,
+    0xdc, 0xc1, 0x06, 0x1a, 0xe4, 0xf7, 0x21, 0xbd, 0x12, 0xb6, 0xa5, 0xcf, 0x87, 0xee, 0x5d, 0x3e,
+    0x1d, 0x44, 0x28, 0xda, 0xf1, 0x16, 0xb4, 0x6f, 0xd0, 0x41, 0x4c, 0xd1, 0x9d, 0xb8, 0xb3, 0x91,
+    0x6e, 0xbc, 0xb1, 0x64, 0xce, 0x1a, 0x98, 0x7b, 0xd4, 0xab, 0x8c, 0x90, 0x86, 0xb9, 0xdc, 0x1c,
+    0xa0, 0x6a, 0xf2, 0xa0, 0x89, 0x3c, 0x42, 0x49, 0x1c, 0x8c, 0xb5, 0x34, 0x13, 0xfd, 0xd6, 0x0c,
+    0x92, 0x4d, 0x05, 0x8d, 0x1b, 0xd9, 0x87, 0xbe, 0x83, 0x59, 0xbf, 0xdf, 0x74, 0xa3, 0x55, 0x5c,
+    0x51, 0x1d, 0x2a, 0x02, 0x86, 0x9b, 0x1b, 0x9e, 0xef, 0x91, 0x4f, 0xc7, 0x4a, 0x91, 0xf9, 0x32,
+    0x15, 0x4f, 0x15, 0xe6, 0xa8, 0x56, 0x8b, 0xfd, 0x5e, 0xb7, 0x35, 0xdc, 0xe7, 0xc2, 0x2c, 0x00,
+    0xef, 0x16, 0xf2, 0xd4, 0x0b, 0x6a, 0x12, 0xc9, 0x66, 0x40, 0x06, 0xd6, 0xa3, 0xac, 0xe7, 0x33,
+    0x67, 0xab, 0x2f, 0x00, 0x8b, 0x36, 0xa9, 0x82, 0x88, 0xf0, 0x82, 0x15, 0x53, 0xbf, 0x67, 0x22,
+    0x72, 0xb8, 0x77, 0xb6, 0x66, 0x02, 0x7a, 0xa4, 0x31, 0x0d, 0xf0, 0xb9, 0xe6, 0x6f, 0x02, 0x0e,
+    0x2d, 0x82, 0xe7, 0x1d, 0x75, 0xbd, 0x8c, 0x72, 0xa6, 0x3c, 0xc3, 0xaa, 0x6d, 0xee, 0x42, 0x6b,
+    0x69, 0xb6, 0x25, 0x20, 0x60, 0x87, 0x72, 0x77, 0x9a, 0xb5, 0x53, 0x93, 0x81, 0x0f, 0x74, 0x13,
+    0x04, 0xa6, 0x5e, 0xe9, 0x21, 0x00, 0x1a, 0x80, 0xf1, 0x8d, 0x4c, 0xd0, 0x3a, 0x63, 0x14, 0xb1,
+    0x47, 0xc6, 0x90, 0x84, 0x01, 0xa4, 0x97, 0x30, 0xa2, 0xce, 0xe3, 0x7b, 0x33, 0x98, 0xc5, 0xd3,
+    0xc7, 0xe4, 0x35, 0x1e, 0xc0, 0x32, 0x5f, 0x10, 0x13, 0x0b, 0xb3, 0x67, 0x1a, 0xf5, 0x3b, 0xec,
+    0x20, 0x3e, 0xe4, 0xc9, 0x18, 0x1b, 0x0f, 0xae, 0x07, 0x9c, 0xc3, 0x8d, 0xea, 0xc1, 0x91, 0x68,
+    0x95, 0x1c, 0x5c, 0xc9, 0x35, 0x4e, 0xd8, 0x9c, 0x06, 0x12, 0x09, 0x6e, 0xeb, 0x61, 0xd1, 0x2c,
+    0x96, 0xbf, 0xd1, 0xc3, 0xa2, 0xbd, 0x5a, 0xce, 0x66, 0x73, 0xeb, 0x99, 0xcc, 0x9a, 0x56, 0x8d,
+    0xde, 0x68, 0xb5, 0x78, 0x5c, 0x4c, 0x9b, 0xc9, 0xf9, 0x7f, 0xfa, 0x50, 0xa1, 0x49, 0x49, 0x0f,
+    0x00, 0x00,
+};
+
+// error.html: 1269 -> 1153 (мин.) -> 680 (gzip) байт
+static constexpr uint8_t ASSET_ERROR_HTML[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x54, 0xcd, 0x6e, 0xd3, 0x40,
+    0x10, 0xbe, 0xe7, 0x29, 0x06, 0x73, 0x28, 0x48, 0x75, 0x1c, 0x37, 0x69, 0x28, 0x8e, 0x13, 0x09,
+    0x01, 0xbd, 0xc2, 0xa1, 0x1c, 0x38, 0x6e, 0xec, 0x4d, 0xbc, 0xaa, 0xe3, 0xb5, 0xd6, 0x9b, 0x9f,
+    0x82, 0x2a, 0xd1, 0xf6, 0x82, 0xd4, 0x4a, 0x91, 0xb8, 0x70, 0x41, 0xf0, 0x0a, 0x69, 0xd5, 0x40,
+    0x4a, 0x09, 0x7d, 0x85, 0xf5, 0x2b, 0xf0, 0x24, 0xcc, 0x7a, 0x93, 0x92, 0x14, 0x24, 0x64, 0x59,
+    0x13, 0xcf, 0xce, 0x7c, 0xf3, 0xcd, 0x37, 0xb3, 0xf1, 0xef, 0x3d, 0x7b, 0xf1, 0x74, 0xef, 0xf5,
+    0xcb, 0xe7, 0x10, 0xc9, 0x5e, 0xdc, 0x2a, 0xf9, 0x4b, 0x43, 0x49, 0x88, 0xa6, 0x47, 0x25, 0x81,
+    0x84, 0xf4, 0x68, 0xd3, 0x1a, 0x30, 0x3a, 0x4c, 0xb9, 0x90, 0x16, 0x04, 0x3c, 0x91, 0x34, 0x91,
+    0x4d, 0x6b, 0xc8, 0x42, 0x19, 0x35, 0x43, 0x3a, 0x60, 0x01, 0xb5, 0x8b, 0x8f, 0x4d, 0x60, 0x09,
+    0x93, 0x8c, 0xc4, 0x76, 0x16, 0x90, 0x98, 0x36, 0x5d, 0x6b, 0x09, 0x12, 0x44, 0x44, 0x64, 0x14,
+    0x93, 0x5e, 0xed, 0xed, 0xda, 0x3b, 0xda, 0x2d, 0x99, 0x8c, 0x69, 0x4b, 0x7d, 0xce, 0xdf, 0xab,
+    0x99, 0x3a, 0x57, 0xdf, 0xd5, 0x04, 0xd4, 0x5c, 0x4d, 0xf2, 0xa3, 0xfc, 0x38, 0x7f, 0xa7, 0x7e,
+    0xaa, 0x2b, 0x74, 0xcd, 0x40, 0xdd, 0xe0, 0xcf, 0x1f, 0xea, 0x26, 0x3f, 0xf5, 0x1d, 0x93, 0x51,
+    0xf2, 0x33, 0x79, 0xa0, 0x6d, 0x9b, 0x87, 0x07, 0xf0, 0x16, 0x3a, 0x48, 0xc7, 0xee, 0x90, 0x1e,
+    0x8b, 0x0f, 0x3c, 0x78, 0x22, 0xb0, 0x78, 0x03, 0x24, 0x1d, 0x49, 0x9b, 0xc4, 0xac, 0x9b, 0x78,
+    0x10, 0x20, 0x57, 0x2a, 0x1a, 0xd0, 0x23, 0xa2, 0xcb, 0x12, 0x5b, 0xf2, 0xd4, 0x83, 0xed, 0x4a,
+    0x3a, 0x6a, 0x40, 0x9b, 0x04, 0xfb, 0x5d, 0xc1, 0xfb, 0x49, 0xe8, 0xc1, 0xfd, 0x4e, 0x45, 0x3f,
+    0x0d, 0x38, 0x2c, 0x95, 0x75, 0x83, 0x84, 0x25, 0x54, 0x20, 0x7a, 0x8f, 0x8c, 0x4c, 0x6b, 0x1e,
+    0xd4, 0x2a, 0x45, 0x96, 0xc1, 0xf1, 0xa0, 0x02, 0xa4, 0x2f, 0xf9, 0x3a, 0xca, 0x30, 0x62, 0x92,
+    0x36, 0x20, 0x25, 0x61, 0xc8, 0x92, 0xae, 0x07, 0x55, 0x53, 0x87, 0x8b, 0x90, 0x0a, 0x5b, 0x90,
+    0x90, 0xf5, 0x33, 0x0f, 0xdc, 0x85, 0x73, 0x64, 0x67, 0x11, 0x09, 0xf9, 0x50, 0x43, 0x6d, 0xa5,
+    0xa3, 0xc2, 0x0f, 0xa2, 0xdb, 0x26, 0x0f, 0x2a, 0x9b, 0xc5, 0x53, 0x76, 0x1f, 0x6a, 0x3e, 0x91,
+    0x8b, 0x3c, 0x02, 0x1e, 0x73, 0xa1, 0x69, 0xd6, 0x6a, 0xd5, 0x6a, 0xbd, 0x61, 0xba, 0xce, 0xd8,
+    0x1b, 0xea, 0xc1, 0x56, 0x4d, 0xe3, 0x21, 0x6f, 0x2a, 0x04, 0x17, 0x36, 0x43, 0xfa, 0x4b, 0x59,
+    0x4c, 0x40, 0x6d, 0x67, 0x95, 0xf7, 0x96, 0x2e, 0x83, 0x8d, 0xde, 0x45, 0x44, 0x00, 0x96, 0x74,
+    0xf8, 0x4a, 0xad, 0x7a, 0xbd, 0xfe, 0x77, 0xda, 0x61, 0xa9, 0xdd, 0x97, 0xb2, 0x28, 0xb1, 0xa6,
+    0xdf, 0x96, 0xfb, 0xb8, 0xbe, 0x5b, 0xbd, 0x85, 0x5d, 0x28, 0x61, 0x5a, 0xf7, 0x20, 0xe1, 0xc9,
+    0xaa, 0x2e, 0xee, 0x36, 0x82, 0x19, 0x71, 0x56, 0x78, 0xba, 0x3b, 0xff, 0x50, 0x6b, 0x5b, 0xfb,
+    0x82, 0xbe, 0xc8, 0x34, 0x6a, 0xca, 0x99, 0x19, 0xe6, 0x92, 0x85, 0x17, 0xf1, 0x41, 0x31, 0xa7,
+    0x35, 0x2e, 0x95, 0xf6, 0xa3, 0x30, 0x24, 0x3a, 0xca, 0x77, 0x16, 0xcb, 0xe2, 0x3b, 0x8b, 0x95,
+    0xd6, 0x5b, 0x83, 0x26, 0x64, 0x03, 0x08, 0x62, 0x92, 0x65, 0x4d, 0xeb, 0x76, 0xdc, 0xd6, 0xba,
+    0xff, 0x8f, 0x9c, 0x56, 0xeb, 0xd7, 0xa7, 0x8f, 0xbe, 0x83, 0x67, 0xfa, 0x6a, 0xb8, 0xff, 0x5b,
+    0x5a, 0xac, 0xe5, 0x62, 0x60, 0xba, 0x04, 0xd2, 0xb2, 0x5a, 0x2d, 0xf5, 0x21, 0x3f, 0x52, 0x53,
+    0xb3, 0xd0, 0xd7, 0xf9, 0x18, 0xd0, 0x9c, 0xe7, 0x63, 0xf5, 0x0d, 0xb3, 0x8f, 0xd5, 0x14, 0x5d,
+    0x67, 0x6a, 0x9e, 0x9f, 0x82, 0xba, 0x34, 0xa7, 0xe8, 0x37, 0xa1, 0x88, 0x3f, 0xc5, 0x77, 0x96,
+    0x8f, 0xef, 0xf9, 0x6d, 0xd1, 0x52, 0x5f, 0xd0, 0xf9, 0x15, 0x0f, 0xaf, 0xf3, 0x13, 0x75, 0xa5,
+    0x0b, 0xab, 0xc9, 0xe6, 0x7a, 0xf8, 0x4c, 0x03, 0x82, 0xba, 0xb8, 0x53, 0x6f, 0x71, 0x99, 0x6e,
+    0x0a, 0xa2, 0xe7, 0x45, 0xb6, 0x8e, 0xc3, 0xa8, 0x39, 0x3a, 0x2e, 0xd4, 0xa4, 0xec, 0x3b, 0xa9,
+    0x56, 0xc8, 0xcc, 0x97, 0x27, 0x41, 0xcc, 0x82, 0x7d, 0x7d, 0xcd, 0x13, 0xdc, 0xd2, 0x72, 0xcc,
+    0x03, 0x22, 0x19, 0x4f, 0xca, 0x91, 0xa0, 0x9d, 0xe6, 0x86, 0x83, 0xba, 0x74, 0x58, 0x77, 0x43,
+    0x37, 0xa6, 0xa6, 0x88, 0x39, 0xcf, 0x4f, 0x50, 0x84, 0x33, 0x64, 0x34, 0x2e, 0x34, 0x29, 0x28,
+    0x5d, 0xfa, 0x8e, 0x81, 0xd3, 0x13, 0x30, 0xfa, 0x39, 0x8b, 0x09, 0x38, 0xc5, 0x5f, 0xcd, 0x6f,
+    0x22, 0x42, 0xe9, 0x89, 0x81, 0x04, 0x00, 0x00,
+};
+
+// index.html: 1073 -> 973 (мин.) -> 577 (gzip) байт
+static constexpr uint8_t ASSET_INDEX_HTML[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x53, 0xcd, 0x6e, 0xd3, 0x40,
+    0x10, 0xbe, 0xe7, 0x29, 0x06, 0x23, 0x24, 0x90, 0xea, 0xda, 0xce, 0x9f, 0x8a, 0xed, 0x44, 0xaa,
+    0x0a, 0xb9, 0xc2, 0xa1, 0x08, 0x71, 0xdc, 0xd8, 0x9b, 0x78, 0x85, 0xbd, 0x6b, 0xad, 0x37, 0x7f,
+    0xa0, 0x4a, 0xa5, 0x3d, 0x82, 0xc4, 0x13, 0xf0, 0x0e, 0x11, 0xa2, 0x28, 0x94, 0x42, 0x5e, 0x61,
+    0xfd, 0x46, 0xcc, 0xda, 0x0e, 0x4d, 0x24, 0x2e, 0x68, 0x0f, 0xe3, 0x99, 0x9d, 0xf9, 0xe6, 0x9b,
+    0x6f, 0xd6, 0xe1, 0x83, 0x67, 0x2f, 0xce, 0xce, 0xdf, 0xbc, 0x7c, 0x0e, 0x89, 0xca, 0xd2, 0x61,
+    0x2b, 0xdc, 0x19, 0x4a, 0x62, 0x34, 0x19, 0x55, 0x04, 0x38, 0xc9, 0xe8, 0xc0, 0x9a, 0x33, 0xba,
+    0xc8, 0x85, 0x54, 0x16, 0x44, 0x82, 0x2b, 0xca, 0xd5, 0xc0, 0x5a, 0xb0, 0x58, 0x25, 0x83, 0x98,
+    0xce, 0x59, 0x44, 0xed, 0xca, 0x39, 0x02, 0xc6, 0x99, 0x62, 0x24, 0xb5, 0x8b, 0x88, 0xa4, 0x74,
+    0xe0, 0x59, 0x3b, 0x90, 0x28, 0x21, 0xb2, 0xa0, 0x58, 0xf4, 0xea, 0x7c, 0x64, 0x9f, 0x98, 0xb0,
+    0x62, 0x2a, 0xa5, 0x43, 0xfd, 0x45, 0xaf, 0xcb, 0x0f, 0xe5, 0x55, 0x79, 0xa9, 0x7f, 0xeb, 0x1f,
+    0xfa, 0x56, 0xaf, 0xa1, 0xbc, 0xd6, 0x77, 0xfa, 0x97, 0x71, 0x41, 0x6f, 0xd1, 0xdc, 0xe9, 0x6d,
+    0xf9, 0x31, 0x74, 0xea, 0xfc, 0x56, 0x58, 0xa8, 0x95, 0xb1, 0x63, 0x11, 0xaf, 0xe0, 0x3d, 0x4c,
+    0x90, 0x8c, 0x3d, 0x21, 0x19, 0x4b, 0x57, 0x3e, 0x9c, 0x4a, 0x6c, 0x1d, 0x80, 0xa2, 0x4b, 0x65,
+    0x93, 0x94, 0x4d, 0xb9, 0x0f, 0x11, 0x32, 0xa5, 0x32, 0x80, 0x8c, 0xc8, 0x29, 0xe3, 0xb6, 0x12,
+    0xb9, 0x0f, 0x3d, 0x37, 0x5f, 0x06, 0x30, 0x26, 0xd1, 0xdb, 0xa9, 0x14, 0x33, 0x1e, 0xfb, 0xf0,
+    0x70, 0xe2, 0x9a, 0x13, 0xc0, 0x45, 0xeb, 0xd8, 0x8c, 0x47, 0x18, 0xa7, 0x12, 0xd1, 0x33, 0xb2,
+    0xac, 0x07, 0xf3, 0xa1, 0xeb, 0x56, 0x55, 0x35, 0x8e, 0x0f, 0x2e, 0x90, 0x99, 0x12, 0x87, 0x28,
+    0x8b, 0x84, 0x29, 0x1a, 0x40, 0x4e, 0xe2, 0x98, 0xf1, 0xa9, 0x0f, 0x9d, 0xba, 0x8f, 0x90, 0x31,
+    0x95, 0xb6, 0x24, 0x31, 0x9b, 0x15, 0x3e, 0x78, 0x4d, 0x70, 0x69, 0x17, 0x09, 0x89, 0xc5, 0xc2,
+    0x40, 0xb5, 0xf3, 0x65, 0x15, 0x07, 0x39, 0x1d, 0x93, 0xc7, 0xee, 0x51, 0x75, 0x8e, 0xbd, 0x27,
+    0x86, 0x4f, 0xe2, 0x21, 0x8f, 0x48, 0xa4, 0x42, 0x22, 0xcd, 0x4e, 0xa7, 0x13, 0xd4, 0x23, 0x17,
+    0xec, 0x1d, 0xf5, 0xa1, 0xdd, 0x35, 0x60, 0x17, 0xad, 0xf1, 0x4c, 0x29, 0xc1, 0x31, 0xf1, 0x60,
+    0xa8, 0xee, 0xd9, 0xe9, 0xa8, 0x87, 0x43, 0x35, 0xd5, 0x0d, 0xbd, 0x9a, 0x8f, 0x0f, 0x5c, 0xf0,
+    0x7d, 0xb2, 0x5e, 0x0f, 0xfb, 0xd7, 0x8c, 0xf7, 0x1a, 0x78, 0x27, 0xff, 0x18, 0xa1, 0x67, 0x62,
+    0xd1, 0x4c, 0x16, 0x06, 0x35, 0x17, 0xac, 0x56, 0xb8, 0xd1, 0xc9, 0x73, 0xdd, 0x47, 0xf7, 0x94,
+    0xfc, 0x44, 0xcc, 0x2b, 0x25, 0x0f, 0x89, 0xf5, 0x88, 0xdb, 0x7d, 0x5a, 0xa9, 0xcd, 0xf8, 0x44,
+    0xec, 0x0d, 0xd8, 0xef, 0xf7, 0xef, 0x35, 0x6e, 0x1b, 0x49, 0xaa, 0xa5, 0x84, 0x4e, 0xb3, 0xf5,
+    0xd0, 0x69, 0x5e, 0xa6, 0x59, 0x3f, 0x9a, 0x98, 0xcd, 0x21, 0x4a, 0x49, 0x51, 0x0c, 0xac, 0xbf,
+    0x7b, 0x33, 0x8f, 0x2b, 0xf1, 0xfe, 0xe3, 0x65, 0x61, 0x72, 0x2b, 0xcc, 0x77, 0x38, 0x86, 0x91,
+    0x55, 0x55, 0xeb, 0xef, 0x98, 0xb1, 0x29, 0xaf, 0xf4, 0x0d, 0x60, 0xb9, 0xa9, 0xdb, 0xea, 0xdb,
+    0xf2, 0x1a, 0xf0, 0x73, 0x83, 0x77, 0x18, 0xfd, 0xa6, 0x7f, 0x96, 0x9f, 0x8d, 0x7f, 0xd8, 0x69,
+    0x63, 0xe0, 0xd7, 0xe8, 0xae, 0x11, 0xe0, 0xa6, 0xb9, 0xf8, 0x0a, 0xaf, 0x99, 0x3d, 0x62, 0xa1,
+    0x93, 0x63, 0x37, 0x02, 0x89, 0xa4, 0x93, 0x81, 0xe5, 0x20, 0xeb, 0x09, 0x9b, 0x5a, 0xc3, 0xb0,
+    0xd6, 0xeb, 0x90, 0x35, 0xf6, 0x2e, 0x3f, 0xed, 0xca, 0x9a, 0x84, 0xd0, 0x21, 0x46, 0x06, 0x1c,
+    0xdc, 0x98, 0x46, 0x06, 0xa7, 0xfa, 0x6d, 0xff, 0x00, 0xae, 0x14, 0xfe, 0x50, 0xcd, 0x03, 0x00,
+    0x00,
+};
+
+// login.html: 1245 -> 1057 (мин.) -> 679 (gzip) байт
+static constexpr uint8_t ASSET_LOGIN_HTML[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x54, 0xcb, 0x6e, 0x13, 0x31,
+    0x14, 0xdd, 0xe7, 0x2b, 0x8c, 0x37, 0x49, 0xa4, 0x26, 0x43, 0x45, 0x2b, 0x95, 0x36, 0x13, 0x24,
+    0x4a, 0x91, 0x90, 0x90, 0x1a, 0xd1, 0x76, 0xc1, 0xd2, 0x19, 0x3b, 0x1d, 0xab, 0x1e, 0x3b, 0xd8,
+    0x9e, 0x84, 0x08, 0x21, 0xf5, 0x21, 0x04, 0x12, 0x88, 0x4a, 0x2c, 0x41, 0xa8, 0x0b, 0x7e, 0x20,
+    0x14, 0x22, 0x52, 0x9a, 0x96, 0x5f, 0xf0, 0xfc, 0x09, 0x9f, 0xc0, 0xf5, 0xcc, 0xa4, 0xa5, 0x6c,
+    0xd8, 0xc4, 0x8f, 0xb9, 0xf7, 0xdc, 0x73, 0xce, 0xbd, 0x4e, 0xeb, 0xd6, 0x83, 0xcd, 0xf5, 0xed,
+    0xa7, 0x9d, 0x0d, 0x14, 0xdb, 0x44, 0xb4, 0x2b, 0xad, 0xf9, 0xc2, 0x08, 0x85, 0x25, 0x61, 0x96,
+    0xa0, 0x28, 0x26, 0xda, 0x30, 0x1b, 0xe2, 0x9d, 0xed, 0x87, 0x8d, 0x15, 0x3c, 0xbf, 0x96, 0x24,
+    0x61, 0x21, 0x1e, 0x70, 0x36, 0xec, 0x2b, 0x6d, 0x31, 0x8a, 0x94, 0xb4, 0x4c, 0x42, 0xd8, 0x90,
+    0x53, 0x1b, 0x87, 0x94, 0x0d, 0x78, 0xc4, 0x1a, 0xf9, 0x61, 0x01, 0x71, 0xc9, 0x2d, 0x27, 0xa2,
+    0x61, 0x22, 0x22, 0x58, 0xb8, 0xe8, 0x41, 0x2c, 0xb7, 0x82, 0xb5, 0xdd, 0x87, 0xec, 0x95, 0xbb,
+    0x74, 0xdf, 0x91, 0x3b, 0x45, 0xd9, 0x81, 0x9b, 0x66, 0x07, 0xd9, 0xa1, 0x9b, 0xb8, 0x59, 0x76,
+    0xd4, 0x0a, 0x8a, 0x88, 0x4a, 0x4b, 0x70, 0xb9, 0x87, 0x34, 0x13, 0x21, 0x36, 0x76, 0x24, 0x98,
+    0x89, 0x19, 0x83, 0x7a, 0xb1, 0x66, 0xbd, 0x10, 0x07, 0xf9, 0x55, 0x33, 0x32, 0xe6, 0xde, 0x20,
+    0xbc, 0xbb, 0x14, 0xad, 0x2c, 0xdf, 0xb9, 0x4d, 0x96, 0x96, 0x7d, 0x81, 0xa0, 0x14, 0xd1, 0x55,
+    0x74, 0x04, 0x0b, 0xe5, 0x03, 0x14, 0x09, 0x62, 0x4c, 0x88, 0x85, 0xda, 0xe5, 0xb2, 0xe1, 0x09,
+    0x13, 0x2e, 0x99, 0xf6, 0xc1, 0xf1, 0x62, 0xfb, 0xf7, 0xc9, 0xc7, 0x31, 0x72, 0x5f, 0xdc, 0xcc,
+    0x5d, 0xb8, 0x71, 0x76, 0x8c, 0xdc, 0x2f, 0x20, 0x36, 0x83, 0xdf, 0x31, 0x40, 0x2d, 0x42, 0x4c,
+    0x4f, 0xe9, 0x04, 0x81, 0xf6, 0x58, 0xd1, 0x10, 0x77, 0x36, 0xb7, 0xb6, 0x31, 0x22, 0x91, 0xe5,
+    0x4a, 0x02, 0x8d, 0x1c, 0xd2, 0x03, 0x71, 0xd9, 0x4f, 0x2d, 0xb2, 0xa3, 0x3e, 0x98, 0x63, 0xd9,
+    0x73, 0x20, 0x5a, 0x18, 0x95, 0x1a, 0xa6, 0xfd, 0x0e, 0xa3, 0xbe, 0x20, 0x11, 0x8b, 0x95, 0xa0,
+    0x4c, 0x87, 0xd8, 0x7d, 0x82, 0x22, 0xdf, 0xdc, 0xd4, 0x5d, 0x60, 0x34, 0x20, 0x22, 0x85, 0x48,
+    0x42, 0x13, 0x80, 0x02, 0xc1, 0x84, 0x2a, 0x29, 0x46, 0xff, 0x60, 0xf6, 0x41, 0xc1, 0x50, 0x69,
+    0x3a, 0xc7, 0xbd, 0x3e, 0xdf, 0xc4, 0x3d, 0x01, 0x0d, 0xfb, 0x80, 0x7d, 0x9e, 0xbd, 0xf3, 0x58,
+    0xcf, 0x52, 0xae, 0x59, 0xee, 0x46, 0x6a, 0xad, 0x92, 0x25, 0x98, 0x49, 0xbb, 0x09, 0xb7, 0x18,
+    0xba, 0x00, 0x91, 0x67, 0xe0, 0xfc, 0xb4, 0x15, 0x14, 0x01, 0xde, 0x3f, 0xaf, 0xf7, 0xa6, 0x71,
+    0x5c, 0xf6, 0x14, 0x88, 0xbc, 0x26, 0xbd, 0x8a, 0x72, 0xb6, 0xa8, 0x06, 0x9e, 0x4d, 0x10, 0xdc,
+    0xfc, 0x00, 0xc7, 0x26, 0xee, 0x22, 0x3b, 0x76, 0x93, 0xec, 0x10, 0x9a, 0x79, 0x5c, 0x6f, 0x75,
+    0x35, 0x64, 0xfc, 0x45, 0x27, 0x37, 0x16, 0x65, 0x47, 0x10, 0xe9, 0xcf, 0xaf, 0xdd, 0x18, 0x92,
+    0xa7, 0xd9, 0xfb, 0x12, 0x0b, 0x0a, 0x43, 0xc5, 0xb2, 0x2e, 0x07, 0xa7, 0x99, 0xd6, 0x4a, 0xe3,
+    0x39, 0x85, 0xf2, 0x94, 0xb7, 0x3d, 0xc4, 0x94, 0x1b, 0x90, 0x3d, 0x5a, 0x95, 0x4a, 0xb2, 0x35,
+    0xdc, 0x9e, 0xa7, 0x96, 0x8b, 0x89, 0x34, 0xef, 0xdb, 0x76, 0x25, 0x08, 0x90, 0x3b, 0xc9, 0xcb,
+    0x9f, 0x02, 0xad, 0x7d, 0x4f, 0xce, 0xcd, 0x16, 0x10, 0xec, 0x61, 0xda, 0x3c, 0xa1, 0x73, 0x37,
+    0x45, 0xee, 0x32, 0x7b, 0x03, 0x02, 0xbe, 0xba, 0x9f, 0x6e, 0xec, 0xa7, 0x71, 0xe7, 0xc9, 0xe3,
+    0x0a, 0x8c, 0x88, 0xb1, 0x28, 0xd5, 0xa2, 0x43, 0x34, 0x49, 0x0c, 0x0a, 0x91, 0x64, 0x43, 0xff,
+    0x65, 0x8b, 0x11, 0x1d, 0xc5, 0xc5, 0x6d, 0x6d, 0xc8, 0x25, 0x55, 0xc3, 0xa6, 0x50, 0x11, 0xf1,
+    0xd3, 0xd0, 0x34, 0xf9, 0xc7, 0xfa, 0x5a, 0x85, 0xf7, 0x50, 0xed, 0x2a, 0xb9, 0x19, 0x13, 0x53,
+    0xab, 0xe6, 0xf4, 0xab, 0xf5, 0x3a, 0x7a, 0x51, 0xa1, 0x2a, 0x4a, 0x13, 0x78, 0x31, 0xcd, 0x5d,
+    0x66, 0x37, 0x04, 0xf3, 0xdb, 0xfb, 0xa3, 0x47, 0xf4, 0x2a, 0xa6, 0x59, 0x8c, 0x76, 0x29, 0x11,
+    0x6a, 0x57, 0xbb, 0x50, 0x62, 0xaf, 0xba, 0xf6, 0xff, 0x4c, 0x3f, 0x78, 0xeb, 0xc5, 0x7b, 0xf4,
+    0x79, 0xee, 0x33, 0x08, 0xce, 0xa5, 0x43, 0x67, 0xde, 0xba, 0x33, 0xdf, 0x81, 0xab, 0x76, 0x00,
+    0xde, 0x4b, 0x70, 0x6c, 0xee, 0x15, 0x0c, 0x40, 0xf1, 0x5e, 0x82, 0xfc, 0xaf, 0xe0, 0x0f, 0x1d,
+    0x91, 0x79, 0x8f, 0x21, 0x04, 0x00, 0x00,
+};
+
+// script.js: 10732 -> 7659 (мин.) -> 2784 (gzip) байт
+static constexpr uint8_t ASSET_SCRIPT_JS[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x59, 0xeb, 0x6e, 0xdc, 0xc6,
+    0x15, 0xfe, 0xbf, 0x4f, 0x31, 0x56, 0x6b, 0x93, 0xac, 0xb5, 0xdc, 0x55, 0x7c, 0x09, 0xb0, 0xab,
+    0xb5, 0x1b, 0xc9, 0x12, 0xa2, 0xd6, 0x92, 0x0c, 0x4b, 0x6e, 0x02, 0x14, 0x85, 0x4d, 0x91, 0xb3,
+    0xbb, 0x8c, 0x78, 0x0b, 0x39, 0xeb, 0x95, 0xaa, 0x2c, 0x50, 0x3b, 0x08, 0x52, 0x34, 0x46, 0x0d,
+    0xa4, 0x2d, 0xfa, 0xa7, 0xae, 0x91, 0x3e, 0x81, 0xec, 0xd8, 0x8d, 0x6c, 0x2b, 0xca, 0x2b, 0x70,
+    0x5f, 0x21, 0x4f, 0xd0, 0x47, 0xe8, 0x39, 0x33, 0x43, 0x72, 0xc8, 0xbd, 0x28, 0x28, 0x0a, 0xc3,
+    0xd2, 0xee, 0xcc, 0xb9, 0xcd, 0xb9, 0x7e, 0x33, 0xf2, 0x28, 0x23, 0x76, 0x18, 0x04, 0xd4, 0x66,
+    0xd4, 0x21, 0x1d, 0xc2, 0xe2, 0x01, 0x6d, 0xd7, 0x3c, 0x58, 0x8d, 0xa9, 0x5c, 0xff, 0x80, 0x31,
+    0xea, 0x47, 0x2c, 0x81, 0xdd, 0x66, 0xbb, 0x06, 0x8b, 0x09, 0x23, 0x09, 0xb3, 0xd8, 0x00, 0x57,
+    0x8e, 0x46, 0x82, 0x9a, 0x3e, 0xa4, 0x01, 0xdb, 0x09, 0x07, 0xb1, 0x4d, 0x61, 0x35, 0x18, 0x78,
+    0x9e, 0x58, 0x8f, 0x42, 0xcf, 0xdb, 0x75, 0x7d, 0x1a, 0x97, 0x56, 0x05, 0xfb, 0xda, 0xae, 0xd5,
+    0xcb, 0x96, 0x09, 0x69, 0x34, 0x48, 0xfa, 0x75, 0xfa, 0x7a, 0xfc, 0x87, 0xf1, 0xa3, 0xf4, 0x64,
+    0xfc, 0x94, 0xa4, 0xaf, 0xd2, 0xb3, 0xf4, 0xed, 0xf8, 0xf3, 0xf4, 0x34, 0x7d, 0x9d, 0x7e, 0x3f,
+    0x7e, 0x9c, 0x1e, 0x93, 0x86, 0x15, 0xb9, 0x0d, 0xc1, 0xbb, 0x48, 0x60, 0xe7, 0xdf, 0xe9, 0x6b,
+    0x92, 0xfe, 0x00, 0x64, 0xef, 0xc6, 0x9f, 0x8f, 0xbf, 0x44, 0x32, 0xf8, 0x77, 0x8c, 0xbc, 0x6f,
+    0xd3, 0x77, 0xe9, 0x89, 0xe4, 0x3b, 0x4b, 0x4f, 0xa5, 0xd5, 0x6b, 0x77, 0xef, 0x6e, 0xdf, 0xbd,
+    0xbf, 0xbb, 0xf6, 0xf1, 0x2e, 0x5a, 0x5e, 0xeb, 0x1f, 0xbc, 0xbf, 0xb4, 0x74, 0x9f, 0x81, 0x75,
+    0xe1, 0x80, 0xb5, 0x88, 0x06, 0x1a, 0x8f, 0xc7, 0x8f, 0x41, 0xd0, 0x49, 0xfa, 0x96, 0xa4, 0x2f,
+    0xc1, 0x96, 0x47, 0xe9, 0xb1, 0xb6, 0x58, 0x0b, 0xc2, 0xfb, 0x5d, 0x2f, 0x1c, 0x22, 0xc5, 0xf7,
+    0xb0, 0xf8, 0x18, 0xf7, 0xce, 0xd2, 0x57, 0xe3, 0xaf, 0x60, 0xaf, 0xeb, 0x7a, 0x9e, 0x22, 0x02,
+    0xcd, 0x4c, 0xdf, 0x80, 0xc9, 0xc7, 0x60, 0x11, 0x10, 0x82, 0x39, 0xdc, 0x92, 0x97, 0x5c, 0x50,
+    0x4c, 0x13, 0x1a, 0x3f, 0x0c, 0xdd, 0xf8, 0x3e, 0x3a, 0xf4, 0x10, 0x05, 0xbe, 0x00, 0x02, 0x50,
+    0xf6, 0x03, 0x90, 0x3f, 0x1a, 0x3f, 0xd6, 0x6a, 0xe0, 0x4e, 0x27, 0xb4, 0x07, 0x3e, 0x78, 0xd3,
+    0xb4, 0x1c, 0x67, 0x0d, 0xdd, 0x7a, 0xdb, 0x4d, 0x18, 0x0d, 0x68, 0xac, 0x6b, 0xb7, 0xb6, 0x37,
+    0x57, 0xc3, 0x80, 0xe1, 0x5a, 0x68, 0x39, 0xd4, 0xd1, 0x16, 0x49, 0x77, 0x10, 0xd8, 0xcc, 0x0d,
+    0x03, 0xdd, 0x80, 0x13, 0xb9, 0x5d, 0xa2, 0x0f, 0xdd, 0xc0, 0x09, 0x87, 0xe6, 0x5a, 0x11, 0x10,
+    0xdc, 0x01, 0xaf, 0xc5, 0x4c, 0xac, 0xb1, 0x98, 0x5a, 0xbe, 0x6e, 0xb4, 0x6b, 0x23, 0x42, 0xbd,
+    0x84, 0x66, 0x9b, 0x77, 0x20, 0x52, 0x6e, 0xd0, 0xe3, 0x1b, 0xb5, 0x11, 0xfc, 0xcc, 0x24, 0x93,
+    0x49, 0x5e, 0xe0, 0xa9, 0x04, 0x9c, 0x0e, 0x89, 0xa2, 0x51, 0xd7, 0x78, 0xa8, 0x38, 0x4d, 0xa2,
+    0x81, 0x2c, 0x85, 0xda, 0x0c, 0x03, 0x9f, 0x26, 0x89, 0xd5, 0x43, 0xbe, 0xdc, 0x7a, 0x4e, 0x80,
+    0x72, 0xb7, 0xf7, 0x3e, 0x81, 0x9c, 0x33, 0xad, 0x24, 0x71, 0x7b, 0x81, 0x9e, 0x05, 0xfb, 0x57,
+    0x3b, 0xdb, 0x5b, 0x66, 0x64, 0xc5, 0x09, 0x15, 0x94, 0xa6, 0x63, 0x31, 0xcb, 0x30, 0x78, 0x3a,
+    0x56, 0x72, 0x77, 0x46, 0xde, 0x0e, 0x22, 0x60, 0xa1, 0xab, 0x62, 0x0b, 0x34, 0xee, 0x70, 0xc9,
+    0x3a, 0xf2, 0x18, 0xd9, 0xee, 0xbd, 0x0d, 0xa9, 0x10, 0x7d, 0x50, 0x35, 0x9a, 0xc6, 0x71, 0x18,
+    0xab, 0x26, 0xa3, 0xb5, 0xaa, 0xfa, 0xae, 0x05, 0xde, 0x9c, 0xa9, 0x88, 0xef, 0x82, 0x5c, 0x0c,
+    0x91, 0x2a, 0x18, 0x1c, 0xea, 0x1c, 0x22, 0x0d, 0xb8, 0xa3, 0xd3, 0x51, 0x9d, 0x68, 0xae, 0xde,
+    0xde, 0xde, 0x59, 0xbb, 0x35, 0xc5, 0xd9, 0xbc, 0x8e, 0xa6, 0x04, 0x0d, 0x7f, 0x94, 0xa3, 0x96,
+    0xef, 0xcb, 0xe4, 0xc8, 0xcb, 0xd1, 0x80, 0xfa, 0x66, 0x83, 0x38, 0xc8, 0xec, 0x95, 0x56, 0x82,
+    0x1c, 0xb5, 0x62, 0x13, 0xca, 0x36, 0x20, 0xdd, 0xe2, 0x87, 0x96, 0xa7, 0xab, 0x74, 0x8b, 0x64,
+    0xa9, 0xd9, 0x6c, 0x1a, 0x25, 0x7d, 0x65, 0x39, 0xc2, 0x37, 0x50, 0x73, 0x7d, 0x38, 0x1f, 0x8d,
+    0x31, 0x08, 0x4a, 0xd1, 0xdf, 0x24, 0x47, 0x44, 0xdb, 0xe8, 0xd6, 0xb7, 0xc0, 0xad, 0xf5, 0x4d,
+    0x8b, 0xd9, 0x7d, 0xad, 0xa5, 0xee, 0x8f, 0x48, 0x8b, 0x77, 0x96, 0x2e, 0x85, 0x2d, 0x99, 0x4c,
+    0x62, 0x1b, 0x32, 0xfe, 0x28, 0x93, 0xd9, 0xca, 0x3e, 0x2c, 0x12, 0xdb, 0xb2, 0xfb, 0x14, 0xea,
+    0x29, 0x08, 0xeb, 0x09, 0x0b, 0x63, 0xaa, 0x91, 0x91, 0x51, 0x33, 0x59, 0x9f, 0x06, 0x3a, 0x14,
+    0x5d, 0x04, 0x96, 0x80, 0xe3, 0x6e, 0x48, 0x27, 0x64, 0x2b, 0x66, 0xd6, 0xc5, 0xc0, 0xef, 0x57,
+    0x9a, 0x57, 0x33, 0x97, 0x48, 0xff, 0x22, 0xe5, 0x85, 0x9c, 0x34, 0xdc, 0x37, 0x08, 0xeb, 0xc7,
+    0xe1, 0x50, 0xa4, 0x3a, 0xe6, 0x82, 0xae, 0x6d, 0x51, 0x36, 0x0c, 0xe3, 0x7d, 0xc2, 0x53, 0x03,
+    0xd3, 0xbc, 0xd4, 0xd7, 0x72, 0x5e, 0x69, 0xa5, 0xd9, 0xa3, 0x4c, 0xd7, 0x70, 0x13, 0x49, 0xa5,
+    0xae, 0x9c, 0xe8, 0x93, 0x04, 0x53, 0x0a, 0x3c, 0x9a, 0xd9, 0x8d, 0x19, 0x2e, 0x6c, 0xfe, 0x3f,
+    0xe5, 0x38, 0x1e, 0x88, 0x97, 0xcd, 0xcc, 0x2a, 0xe3, 0xbb, 0x53, 0x8b, 0x81, 0x9b, 0x65, 0x63,
+    0xa0, 0x74, 0x59, 0x07, 0xd2, 0xb0, 0x24, 0xf4, 0xa8, 0x49, 0x85, 0x3b, 0xb8, 0x57, 0x5a, 0x10,
+    0x21, 0xfe, 0xbd, 0x52, 0x9c, 0xb2, 0x3a, 0x26, 0x2c, 0xbf, 0x7c, 0xf9, 0xdc, 0x92, 0x19, 0x95,
+    0x13, 0x0d, 0x92, 0x72, 0x97, 0x1e, 0x30, 0xdd, 0x75, 0x16, 0x09, 0x24, 0xe6, 0x80, 0x16, 0xc9,
+    0x46, 0x3d, 0xd0, 0x94, 0xf7, 0x4f, 0xf0, 0xf7, 0x9a, 0x47, 0xf1, 0xe3, 0xca, 0xe1, 0x86, 0x03,
+    0xf4, 0x59, 0xf9, 0x79, 0xe4, 0xd2, 0x25, 0xc1, 0x4a, 0x2e, 0x40, 0xec, 0x07, 0x81, 0x43, 0xbb,
+    0x6e, 0x00, 0x66, 0x96, 0x96, 0x31, 0x0d, 0x0c, 0x10, 0x69, 0x32, 0xd0, 0x26, 0xdb, 0x2e, 0x88,
+    0xe7, 0x04, 0x53, 0x32, 0x1f, 0xfc, 0x95, 0x79, 0x37, 0xf3, 0xb4, 0x69, 0x0f, 0xe2, 0x18, 0xb8,
+    0x3e, 0xa2, 0x6e, 0xaf, 0xcf, 0xca, 0xba, 0x8c, 0xfc, 0x1c, 0x5a, 0x89, 0x4a, 0x13, 0x61, 0xa8,
+    0xb0, 0x5e, 0x26, 0x1a, 0x49, 0xbf, 0xd5, 0x94, 0x28, 0x9a, 0x7c, 0x84, 0x9c, 0x23, 0x59, 0xa1,
+    0xc9, 0xe4, 0xaa, 0x6c, 0x53, 0xa4, 0x0e, 0xe1, 0x24, 0xf1, 0x6f, 0x42, 0x0f, 0x3c, 0x38, 0x53,
+    0xaa, 0x42, 0x93, 0x49, 0x55, 0xd9, 0xb8, 0xd4, 0xd3, 0xf4, 0x1d, 0x2f, 0x88, 0xe2, 0x8c, 0x51,
+    0x52, 0x1c, 0x2d, 0x4a, 0x8c, 0x0c, 0x49, 0x44, 0x71, 0xd8, 0x83, 0x22, 0x48, 0x56, 0xac, 0x78,
+    0x4e, 0xec, 0x34, 0x85, 0x2c, 0xb3, 0x57, 0xe5, 0x84, 0xc0, 0xcd, 0x37, 0x3f, 0xa7, 0xf0, 0xad,
+    0x03, 0xb1, 0x5f, 0x64, 0x4d, 0x44, 0xa1, 0xaf, 0x06, 0x4c, 0x4c, 0x24, 0xe8, 0x46, 0x7d, 0xd3,
+    0x77, 0x03, 0x1d, 0x3a, 0xdc, 0xa2, 0xfc, 0x66, 0x1d, 0xe8, 0xf0, 0x79, 0xd2, 0x41, 0x8d, 0x09,
+    0x91, 0xbf, 0xc0, 0xc6, 0x88, 0x73, 0x49, 0x31, 0x0e, 0xda, 0xcc, 0x21, 0x14, 0xc9, 0xd0, 0x75,
+    0x58, 0x1f, 0x14, 0x28, 0xda, 0xc0, 0x53, 0x17, 0x35, 0x4c, 0xa5, 0xdc, 0xfd, 0xc9, 0x21, 0x8c,
+    0x7a, 0x5f, 0x8c, 0x83, 0x8a, 0xfb, 0xf3, 0x1c, 0x97, 0x73, 0x48, 0x44, 0x93, 0x7f, 0xc9, 0xce,
+    0x26, 0xbe, 0x21, 0x1f, 0x34, 0xc2, 0x00, 0x9a, 0xe0, 0x4d, 0xa2, 0x17, 0x98, 0xe7, 0xb7, 0x05,
+    0xcd, 0xef, 0xc8, 0x67, 0x9f, 0x29, 0x2c, 0x06, 0xb4, 0x5b, 0x39, 0x54, 0xb2, 0x78, 0x29, 0x86,
+    0x64, 0x05, 0x0d, 0xd2, 0x26, 0x6c, 0xc4, 0x58, 0xeb, 0x1a, 0xfc, 0x12, 0x14, 0xf0, 0xd5, 0xd0,
+    0x40, 0x58, 0x95, 0xce, 0x28, 0x1d, 0x72, 0x9f, 0x32, 0xe6, 0xd1, 0x3b, 0x88, 0x86, 0x82, 0xd9,
+    0xb9, 0x5b, 0xa2, 0xca, 0x52, 0xa7, 0xcc, 0x7a, 0x93, 0x68, 0x3f, 0xfe, 0xe3, 0x0b, 0x92, 0xfe,
+    0x0d, 0xb1, 0xd3, 0xf8, 0x09, 0x6a, 0xd6, 0x7e, 0x7c, 0xf6, 0x84, 0xa4, 0xcf, 0x10, 0xa6, 0x95,
+    0xf3, 0xda, 0xed, 0xba, 0x3b, 0xd0, 0xeb, 0x2c, 0x6f, 0xd2, 0xaf, 0x45, 0x62, 0xe7, 0x44, 0x79,
+    0x5e, 0x17, 0x6c, 0x78, 0x54, 0x67, 0xc5, 0x2f, 0x65, 0x35, 0xdf, 0xce, 0xe6, 0xd2, 0x1c, 0x06,
+    0xe5, 0xf0, 0xfe, 0xa7, 0x8c, 0xad, 0xe6, 0x7d, 0x71, 0xd6, 0xe1, 0x91, 0xaa, 0x2c, 0xb8, 0xcc,
+    0x97, 0x9d, 0xfc, 0x39, 0x02, 0x51, 0x44, 0xbb, 0xe3, 0x3f, 0x0b, 0x00, 0x5c, 0xf8, 0xe0, 0x9f,
+    0x80, 0x45, 0xd5, 0x0d, 0xd5, 0x1b, 0xb6, 0xe5, 0xb9, 0x7b, 0xb1, 0x85, 0xdd, 0x6b, 0xdd, 0xb2,
+    0x99, 0x4c, 0x9a, 0xa9, 0xbd, 0xa9, 0x4a, 0x99, 0x17, 0x71, 0x75, 0xc3, 0x64, 0xe1, 0xba, 0x7b,
+    0x40, 0x1d, 0xfd, 0xba, 0x31, 0x43, 0xd5, 0x2d, 0xc8, 0xc9, 0x9f, 0xa2, 0xa8, 0x7c, 0xf0, 0xaa,
+    0x80, 0xec, 0xe8, 0x7f, 0x49, 0xcf, 0x38, 0xb8, 0x47, 0x68, 0xad, 0x06, 0x1e, 0xd0, 0xf9, 0xf8,
+    0x2b, 0x71, 0x2b, 0x40, 0xb8, 0x8e, 0x10, 0xbc, 0x14, 0x33, 0xee, 0x5a, 0x25, 0xa5, 0xb2, 0xef,
+    0x55, 0x9a, 0x75, 0xcb, 0xf5, 0x38, 0xc2, 0xce, 0xa9, 0xc4, 0x8a, 0x7a, 0xb8, 0x41, 0x84, 0xd0,
+    0x7f, 0xe6, 0x99, 0xc4, 0x36, 0x82, 0xf4, 0x30, 0xf6, 0x2d, 0x76, 0x8f, 0x7f, 0x55, 0x39, 0x4b,
+    0x9e, 0xea, 0xc6, 0x94, 0x7e, 0x48, 0xad, 0x68, 0xa6, 0xb8, 0x8c, 0x20, 0x17, 0xb8, 0x72, 0xc8,
+    0x68, 0x52, 0x66, 0x36, 0xa6, 0x81, 0xb2, 0x89, 0xc9, 0xea, 0x26, 0x79, 0x2a, 0x15, 0x8d, 0x45,
+    0x82, 0x97, 0x79, 0x23, 0x54, 0xb3, 0x2b, 0x92, 0xb2, 0xac, 0xba, 0x90, 0x31, 0x17, 0xb8, 0x12,
+    0x97, 0x2b, 0x7a, 0x32, 0x22, 0xd3, 0xf6, 0x00, 0x79, 0x6c, 0x59, 0x3e, 0x36, 0x5c, 0x45, 0x66,
+    0x5d, 0x02, 0xb2, 0x30, 0x00, 0xd0, 0x4a, 0xb5, 0x76, 0xc1, 0x50, 0x1e, 0xc1, 0xda, 0x7f, 0x9e,
+    0x3f, 0xff, 0x17, 0xf9, 0xc8, 0x5d, 0x77, 0xc5, 0xf5, 0xaf, 0x5c, 0x01, 0xe5, 0x8b, 0xcd, 0x4f,
+    0x53, 0xd8, 0xed, 0x9e, 0xab, 0xf1, 0xaf, 0xaf, 0x48, 0xfa, 0x0d, 0x28, 0x7b, 0x0d, 0xea, 0x4e,
+    0x64, 0x66, 0x9d, 0xc8, 0x0b, 0x28, 0x24, 0x22, 0x5e, 0x5c, 0x9f, 0xc2, 0xd2, 0x99, 0x89, 0x55,
+    0x09, 0xdf, 0x80, 0x60, 0xc2, 0x36, 0x64, 0x30, 0x4d, 0x93, 0xf7, 0x7c, 0x25, 0x4a, 0xa5, 0xf4,
+    0xf0, 0x13, 0x25, 0x24, 0x88, 0x96, 0x9c, 0x24, 0x1b, 0x4b, 0x70, 0x0b, 0x05, 0x9c, 0xe5, 0x27,
+    0x30, 0x78, 0x24, 0xfe, 0x96, 0x18, 0x1b, 0x6e, 0x06, 0x15, 0xa2, 0x8c, 0xb3, 0x41, 0xae, 0x5c,
+    0x57, 0x28, 0x61, 0xb0, 0x0d, 0x20, 0x67, 0xca, 0xb4, 0x39, 0xf1, 0x45, 0x41, 0x0c, 0x4c, 0xd7,
+    0x9b, 0x05, 0x44, 0x15, 0xd2, 0xb1, 0x9b, 0x8d, 0xbf, 0x24, 0xd8, 0xeb, 0x33, 0x21, 0x72, 0xd0,
+    0x9f, 0x08, 0x9f, 0x57, 0x8f, 0x23, 0x92, 0x73, 0x0f, 0x7f, 0x66, 0x98, 0x88, 0x7f, 0x21, 0xcb,
+    0x60, 0xfc, 0x7b, 0x05, 0xda, 0x16, 0x8b, 0x28, 0x6b, 0x45, 0x6b, 0x4f, 0x90, 0xf1, 0x89, 0xaa,
+    0x50, 0xcb, 0xcd, 0x86, 0x58, 0xcd, 0x7b, 0xce, 0x92, 0xc1, 0x25, 0xfc, 0x1a, 0x45, 0x54, 0x29,
+    0x75, 0x55, 0xce, 0x04, 0xcb, 0xe6, 0x8a, 0x56, 0x41, 0x97, 0x81, 0xb3, 0x1a, 0xfa, 0xbe, 0x15,
+    0x38, 0xfa, 0x20, 0xf6, 0xd0, 0x74, 0x29, 0x50, 0x5c, 0x46, 0x60, 0x0d, 0xaf, 0x20, 0x3e, 0x65,
+    0xfd, 0xd0, 0x81, 0xb6, 0x73, 0x67, 0x7b, 0x67, 0x77, 0xc6, 0x6d, 0xa3, 0x82, 0xed, 0x27, 0x81,
+    0x7d, 0xd2, 0x0f, 0x87, 0x5b, 0x21, 0x83, 0x91, 0x61, 0xf3, 0xfe, 0x26, 0x27, 0x84, 0xbc, 0x1d,
+    0xc3, 0x88, 0x96, 0xa0, 0x60, 0x60, 0xdb, 0xb0, 0x86, 0x9d, 0x4f, 0xe9, 0x7a, 0x67, 0xbc, 0xeb,
+    0x41, 0x9b, 0xff, 0x23, 0x44, 0xe0, 0x05, 0x64, 0x19, 0xb4, 0xb9, 0x22, 0x68, 0xc8, 0xd8, 0xfe,
+    0xdf, 0x50, 0xfb, 0x84, 0x55, 0x9a, 0x98, 0xa7, 0x64, 0xfc, 0x08, 0x5a, 0xeb, 0xd3, 0xf4, 0xbb,
+    0xf4, 0x04, 0x3e, 0x12, 0xf1, 0x62, 0x01, 0x79, 0x7e, 0x96, 0xbe, 0xc1, 0x4f, 0xfc, 0x51, 0xe4,
+    0x54, 0x9b, 0xc4, 0xeb, 0xf8, 0x44, 0xb2, 0x0a, 0x90, 0x4f, 0xb7, 0xc3, 0x81, 0xb8, 0xe3, 0xab,
+    0x3e, 0x16, 0x97, 0x3b, 0xa4, 0xb9, 0x89, 0xb8, 0xb0, 0x83, 0x09, 0x26, 0x08, 0x27, 0x84, 0xac,
+    0x03, 0x44, 0xd1, 0xe7, 0xf0, 0x77, 0x61, 0xbf, 0xb3, 0xa4, 0x4d, 0xd3, 0x0e, 0x97, 0x42, 0x5f,
+    0xb9, 0x94, 0xfa, 0xd8, 0xe4, 0xb6, 0x06, 0xfe, 0x1e, 0x8d, 0xf5, 0xd9, 0xbd, 0x8e, 0x73, 0x6d,
+    0xde, 0xd6, 0x0c, 0x53, 0x5c, 0x33, 0x44, 0x76, 0x02, 0xef, 0x8d, 0x0e, 0xb9, 0xd6, 0x44, 0xd4,
+    0x05, 0x9f, 0x97, 0x3b, 0x64, 0xe9, 0x7d, 0x2c, 0x9a, 0x99, 0x66, 0xf9, 0x1e, 0x3f, 0x14, 0x2f,
+    0xb8, 0x18, 0x4e, 0xe6, 0x80, 0x08, 0x43, 0x7d, 0x7e, 0xb1, 0x3c, 0x1a, 0x43, 0x7b, 0x4f, 0xbf,
+    0xc6, 0x37, 0x27, 0xec, 0x2e, 0xd8, 0x4e, 0xf0, 0x0d, 0xeb, 0x0c, 0x7a, 0x0a, 0xf6, 0x91, 0xb7,
+    0xb0, 0xf0, 0x3d, 0x0c, 0xb5, 0x37, 0x04, 0x5c, 0xfc, 0x62, 0xfc, 0x27, 0x58, 0x3a, 0x25, 0x98,
+    0x08, 0x68, 0x06, 0xbe, 0x93, 0x71, 0x13, 0x72, 0xd0, 0x3d, 0x2a, 0x3f, 0x03, 0x84, 0xd1, 0xba,
+    0x3b, 0xd3, 0x71, 0xb8, 0x5d, 0xf1, 0x18, 0x7f, 0x38, 0x58, 0x2d, 0xa6, 0x6e, 0xfe, 0x78, 0x00,
+    0xbe, 0xeb, 0xba, 0xb1, 0x0f, 0x96, 0xfe, 0x3d, 0x3d, 0xce, 0x9e, 0xac, 0xd0, 0xda, 0xf1, 0x13,
+    0xb4, 0x56, 0xbc, 0x74, 0xbd, 0xe0, 0x19, 0xf1, 0x12, 0x5f, 0xee, 0xf2, 0x67, 0x2d, 0x58, 0xf8,
+    0x16, 0x8c, 0x84, 0x1e, 0x88, 0x8f, 0x63, 0xd8, 0x05, 0x81, 0xfa, 0x26, 0xa4, 0xeb, 0x54, 0x93,
+    0xb2, 0x81, 0x4f, 0x27, 0xcf, 0x52, 0xcd, 0x4c, 0x59, 0x2a, 0x45, 0x60, 0x03, 0x65, 0x57, 0x9d,
+    0x63, 0x76, 0x4c, 0x41, 0xa0, 0x0c, 0xaf, 0xae, 0x39, 0xee, 0x43, 0x14, 0xae, 0x52, 0x97, 0x47,
+    0x84, 0xba, 0xa3, 0x55, 0x08, 0xcb, 0x93, 0x41, 0x9a, 0x50, 0xa1, 0x11, 0x90, 0xdf, 0x4e, 0x12,
+    0x9c, 0xdc, 0x40, 0xf5, 0xa0, 0x16, 0x85, 0x89, 0x8b, 0x5b, 0x2d, 0xc8, 0x48, 0x68, 0x3f, 0xed,
+    0x1a, 0x38, 0xbe, 0x45, 0xde, 0x6b, 0x46, 0x07, 0x50, 0xb3, 0x78, 0x1b, 0xcb, 0xbe, 0xec, 0x59,
+    0xf6, 0x7e, 0x8f, 0xe7, 0x49, 0x8b, 0xfc, 0xec, 0xea, 0xea, 0x07, 0xeb, 0xd7, 0xf8, 0xab, 0xab,
+    0x07, 0x45, 0x4a, 0x86, 0x7d, 0x97, 0x81, 0xaa, 0xc8, 0x72, 0x1c, 0x37, 0xe8, 0xb5, 0xc8, 0xd2,
+    0xb5, 0xe8, 0x20, 0x63, 0x0b, 0x63, 0x87, 0xc6, 0xf5, 0xd8, 0x72, 0xdc, 0x41, 0xd2, 0x22, 0xd7,
+    0xc4, 0xda, 0x41, 0x3d, 0xe9, 0x5b, 0x0e, 0xbe, 0x5d, 0x36, 0xc9, 0x55, 0xa0, 0xbd, 0x0e, 0xff,
+    0xe3, 0xde, 0x9e, 0x05, 0xf7, 0x19, 0xfe, 0xcf, 0x5c, 0x02, 0x37, 0xfc, 0xbe, 0xee, 0x02, 0xda,
+    0x38, 0x68, 0xf1, 0xa1, 0xd2, 0xae, 0x59, 0x81, 0xeb, 0x5b, 0xc2, 0xd4, 0xc4, 0x73, 0x1d, 0xba,
+    0x11, 0x90, 0xa6, 0x79, 0x25, 0x21, 0xd4, 0xc2, 0x0b, 0xfc, 0x03, 0xe5, 0x81, 0x72, 0x2f, 0x74,
+    0x0e, 0x4d, 0x2b, 0x8a, 0x30, 0x84, 0x7d, 0xd7, 0x73, 0x74, 0xd5, 0x07, 0x12, 0x4f, 0x89, 0xa7,
+    0x51, 0x1d, 0x92, 0x88, 0x37, 0x9f, 0x29, 0x5e, 0xca, 0xf5, 0xa1, 0xe3, 0xb9, 0xc6, 0xed, 0x01,
+    0x2b, 0x54, 0x6a, 0x53, 0xe5, 0x94, 0x6d, 0x88, 0xa9, 0x1f, 0x3e, 0xa4, 0x53, 0x6d, 0x18, 0x2d,
+    0x92, 0x2b, 0xe2, 0xa9, 0x8a, 0x7f, 0xa8, 0x3c, 0x5a, 0x61, 0x46, 0xad, 0xf6, 0xad, 0xa0, 0x47,
+    0xef, 0x40, 0xf4, 0x87, 0xe0, 0xc3, 0x5b, 0xae, 0xe5, 0x85, 0x3d, 0xb5, 0x57, 0x84, 0x8e, 0xe5,
+    0x9d, 0x9f, 0x4b, 0x9c, 0xac, 0x9c, 0x44, 0x7c, 0x49, 0xcb, 0xb6, 0x5c, 0x00, 0x1d, 0xf1, 0x87,
+    0xbb, 0x9b, 0xb7, 0x79, 0x3a, 0x2c, 0x03, 0x1b, 0xe1, 0xd4, 0x9d, 0x05, 0xbe, 0x5f, 0xb7, 0x45,
+    0x4a, 0x2d, 0xdc, 0xa8, 0x2d, 0xf7, 0xaf, 0xdc, 0x00, 0xa8, 0x71, 0x2a, 0xc0, 0x2b, 0x02, 0x8c,
+    0x63, 0x5e, 0x54, 0xef, 0xc6, 0x4f, 0x97, 0x1b, 0xb0, 0x57, 0x5b, 0x76, 0x83, 0x08, 0x5c, 0xc4,
+    0x0e, 0x23, 0xda, 0x59, 0x88, 0xa4, 0xe1, 0x0b, 0xc4, 0x75, 0x3a, 0x0b, 0xa1, 0xe7, 0xdc, 0xc9,
+    0x17, 0x22, 0xcf, 0xb2, 0x69, 0x1f, 0x96, 0x68, 0xdc, 0x59, 0x48, 0xbf, 0xc1, 0xc7, 0x69, 0xe8,
+    0x28, 0xbc, 0x8f, 0x14, 0x32, 0x9f, 0x2c, 0xcc, 0x15, 0x18, 0xd0, 0xe1, 0x2c, 0x81, 0xcf, 0xb0,
+    0xd0, 0x27, 0xc4, 0x11, 0x5d, 0x60, 0x02, 0x93, 0x5c, 0xc5, 0x89, 0x71, 0x02, 0xdf, 0x5e, 0x72,
+    0x30, 0x7e, 0x6c, 0xcc, 0xd7, 0x24, 0xdb, 0xcb, 0x2c, 0x6d, 0xfc, 0xaa, 0xc3, 0xc7, 0x0c, 0x82,
+    0xab, 0xbc, 0x4b, 0x56, 0x0e, 0x32, 0xe1, 0xd6, 0xbd, 0x01, 0x63, 0x10, 0x47, 0xdc, 0x13, 0x1f,
+    0x01, 0x5d, 0xda, 0x9e, 0x6b, 0xef, 0x83, 0xc2, 0x52, 0xe0, 0x75, 0x30, 0x0f, 0x01, 0xde, 0xf8,
+    0x0b, 0x90, 0x77, 0x8c, 0x5d, 0x0a, 0x1b, 0xdb, 0x72, 0x43, 0x70, 0x4d, 0x63, 0xf7, 0xc2, 0x84,
+    0x6e, 0xa2, 0x12, 0xce, 0x8a, 0xf7, 0x2d, 0x19, 0x32, 0x85, 0xa9, 0x01, 0x06, 0xe5, 0xbf, 0xe6,
+    0xd6, 0x0e, 0x37, 0xb7, 0x9c, 0x9d, 0x55, 0x03, 0xf3, 0x9c, 0x94, 0x51, 0x9e, 0x87, 0xd4, 0x95,
+    0x44, 0xc8, 0x06, 0x58, 0x06, 0x02, 0x65, 0x48, 0xe7, 0x71, 0x2b, 0x51, 0xaf, 0x72, 0x2b, 0x61,
+    0x3a, 0xe7, 0xa6, 0xa0, 0x46, 0xb3, 0x90, 0x92, 0xbd, 0xe9, 0x8a, 0xc3, 0xd5, 0xb3, 0x1c, 0xc0,
+    0x87, 0xdd, 0x5a, 0x19, 0x55, 0x2d, 0xd6, 0xf2, 0x87, 0xde, 0x23, 0x4d, 0x76, 0xdc, 0xfa, 0x2e,
+    0x64, 0x8e, 0x06, 0x14, 0xe0, 0x3a, 0x4f, 0x56, 0x79, 0xe3, 0xa0, 0x3e, 0x1c, 0x0e, 0xeb, 0x08,
+    0x3b, 0xeb, 0x00, 0xcf, 0x68, 0x60, 0x87, 0xf8, 0xb7, 0x91, 0xd1, 0x62, 0x0d, 0x9d, 0xdc, 0x22,
+    0x0f, 0x14, 0x5f, 0x74, 0x7e, 0x7e, 0x24, 0xf6, 0xef, 0xdd, 0xdd, 0x80, 0xb1, 0x03, 0xf8, 0x0c,
+    0x8b, 0x58, 0x12, 0x18, 0xa3, 0x4b, 0xca, 0xc1, 0xa7, 0x93, 0x4a, 0x02, 0x20, 0xad, 0x9c, 0x70,
+    0x3a, 0xb9, 0x42, 0x64, 0x8c, 0x1e, 0x14, 0xaf, 0xbb, 0x1c, 0x8b, 0xc5, 0x33, 0x91, 0x61, 0xf1,
+    0x20, 0x24, 0xb0, 0x9f, 0x51, 0xc0, 0x04, 0x79, 0xef, 0x2f, 0xea, 0x0d, 0x67, 0x2c, 0x94, 0xc1,
+    0x6b, 0x00, 0x82, 0x70, 0xfd, 0x20, 0x50, 0x71, 0xdf, 0xc9, 0x44, 0x84, 0xff, 0x17, 0xb0, 0x37,
+    0xa9, 0x99, 0x3a, 0x89, 0x3b, 0xe4, 0x6b, 0x41, 0x0e, 0x23, 0x5b, 0x1c, 0xe4, 0xab, 0x50, 0x34,
+    0xff, 0x93, 0x90, 0x9a, 0x9b, 0x8a, 0xcc, 0xd9, 0xbd, 0xf2, 0xd3, 0x01, 0x8d, 0x0f, 0x77, 0xa8,
+    0x47, 0xf1, 0x85, 0x40, 0xd7, 0x4c, 0xd1, 0x12, 0x33, 0x24, 0xc5, 0x33, 0x5e, 0x30, 0xc9, 0x16,
+    0x2e, 0xfe, 0x90, 0x91, 0xdd, 0x47, 0x61, 0x3a, 0xcc, 0x69, 0xbc, 0x7c, 0x5f, 0xbc, 0xba, 0xe3,
+    0x18, 0x29, 0x8f, 0xe5, 0x07, 0xb5, 0x5f, 0xee, 0xd3, 0xc3, 0x6e, 0x0c, 0xad, 0x38, 0xc9, 0xc7,
+    0xd8, 0x51, 0xad, 0x1b, 0x87, 0x3e, 0xa0, 0x77, 0x16, 0x5b, 0x41, 0x82, 0xf9, 0xd2, 0x12, 0x1f,
+    0x3d, 0x90, 0xfb, 0x31, 0xbe, 0xf8, 0x5d, 0x34, 0xda, 0x24, 0x8c, 0x2c, 0xdb, 0xc5, 0xbf, 0xce,
+    0x35, 0xdb, 0x64, 0x04, 0x63, 0x7a, 0x26, 0x7d, 0x53, 0x25, 0x5e, 0x42, 0xe2, 0xd1, 0x84, 0x56,
+    0x1c, 0x65, 0xe7, 0xa8, 0x9d, 0x14, 0x33, 0x47, 0xe7, 0x54, 0x1b, 0x47, 0xa5, 0xce, 0x82, 0x45,
+    0x53, 0xea, 0x2c, 0xdc, 0x3f, 0x46, 0xfb, 0xbf, 0x79, 0xa3, 0xc8, 0xa9, 0xeb, 0x1d, 0x00, 0x00,
+};
+
+// style.css: 6684 -> 5715 (мин.) -> 1691 (gzip) байт
+static constexpr uint8_t ASSET_STYLE_CSS[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x58, 0xdb, 0x8e, 0xdb, 0x36,
+    0x10, 0x7d, 0xf7, 0x57, 0xb0, 0x48, 0x53, 0xd9, 0xad, 0xe5, 0xc8, 0x77, 0xaf, 0x8d, 0x14, 0x4d,
+    0x36, 0x49, 0x91, 0x87, 0xa2, 0x41, 0x93, 0x14, 0xe8, 0x5b, 0x68, 0x91, 0x92, 0x98, 0xc8, 0xa2,
+    0x40, 0xc9, 0xeb, 0xdd, 0x2c, 0x16, 0x68, 0x51, 0x14, 0xe8, 0x43, 0x80, 0xfe, 0x40, 0x2f, 0xbf,
+    0x90, 0x02, 0x0d, 0x1a, 0xf4, 0x92, 0xfe, 0x82, 0xf6, 0x17, 0xf2, 0x25, 0x1d, 0x52, 0x17, 0x4b,
+    0x32, 0xb5, 0x97, 0x26, 0x45, 0x60, 0xec, 0xae, 0x6c, 0x73, 0x86, 0x33, 0x67, 0xce, 0x1c, 0x0e,
+    0xf7, 0x43, 0x74, 0xdc, 0x5a, 0x61, 0xe1, 0xb2, 0x60, 0x8e, 0xac, 0x45, 0x2b, 0xc4, 0x84, 0xb0,
+    0xc0, 0x55, 0xcf, 0x4b, 0x7e, 0x68, 0x46, 0xec, 0xa9, 0x7a, 0xbb, 0xe4, 0x82, 0x50, 0x61, 0xc2,
+    0x47, 0x8b, 0xd6, 0x09, 0x7c, 0x43, 0x8e, 0xc0, 0xce, 0xe1, 0x41, 0x6c, 0x3a, 0x78, 0xc5, 0xfc,
+    0xa3, 0x39, 0x32, 0xee, 0x53, 0x97, 0x53, 0xf4, 0xf0, 0xae, 0xd1, 0x45, 0x0f, 0xb0, 0xc7, 0x57,
+    0xb8, 0x8b, 0x3e, 0xa5, 0x01, 0x3d, 0x80, 0xbf, 0x5f, 0x52, 0x41, 0x70, 0x00, 0x0f, 0x11, 0x0e,
+    0x22, 0x33, 0xa2, 0x82, 0x39, 0xe0, 0x1e, 0xdb, 0x4f, 0x5c, 0xc1, 0xd7, 0x01, 0x99, 0x23, 0x9f,
+    0x05, 0x14, 0x0b, 0xd3, 0x15, 0x98, 0x30, 0x1a, 0xc4, 0xed, 0xfe, 0x70, 0x4c, 0xa8, 0xdb, 0x45,
+    0x57, 0x26, 0x93, 0x29, 0xa5, 0x18, 0x59, 0x57, 0xe1, 0x79, 0x3a, 0x19, 0x2d, 0xf1, 0x00, 0xf5,
+    0x2d, 0xeb, 0x6a, 0x67, 0xd1, 0x5a, 0xb1, 0xc0, 0xf4, 0x28, 0x73, 0xbd, 0x78, 0x2e, 0x3f, 0x3a,
+    0xf0, 0x4a, 0xc1, 0x0f, 0xac, 0x50, 0xc5, 0xd9, 0xb3, 0x21, 0x42, 0x0c, 0xbe, 0x85, 0xca, 0xf2,
+    0xd0, 0xdc, 0x30, 0x12, 0x7b, 0xb0, 0x7e, 0x60, 0xa9, 0x15, 0x45, 0xe2, 0x08, 0xaf, 0x63, 0xae,
+    0x2c, 0x3c, 0x8a, 0x89, 0x5a, 0x5e, 0x0e, 0x6f, 0xe3, 0xb1, 0x98, 0xee, 0xf8, 0xcf, 0x30, 0x91,
+    0x31, 0xaf, 0x23, 0x19, 0xc4, 0xd6, 0x25, 0x00, 0x15, 0xc7, 0x7c, 0xb5, 0x5d, 0x09, 0x48, 0x7a,
+    0x98, 0xf0, 0x8d, 0xdc, 0x6b, 0x14, 0x1e, 0xa2, 0x09, 0xfc, 0x08, 0x77, 0x89, 0xdb, 0x56, 0x57,
+    0xbd, 0x7a, 0x7d, 0x48, 0x89, 0xb0, 0x28, 0xf4, 0x31, 0x60, 0xe9, 0xf8, 0x14, 0xac, 0x1e, 0xaf,
+    0xa3, 0x98, 0x39, 0x47, 0xa6, 0x4c, 0x02, 0x40, 0x99, 0xa3, 0x28, 0xc4, 0x36, 0x35, 0x97, 0x34,
+    0xde, 0x50, 0x1a, 0x2c, 0x5a, 0xd8, 0x67, 0x6e, 0x60, 0x42, 0x64, 0x2b, 0xd8, 0xdd, 0x86, 0x15,
+    0x54, 0x2c, 0x5a, 0xd2, 0xd4, 0xdc, 0x08, 0x1c, 0x42, 0xd4, 0xf0, 0xbb, 0x9c, 0x93, 0xd7, 0x87,
+    0xb4, 0x6c, 0xee, 0x73, 0x31, 0x47, 0x57, 0x86, 0xc3, 0xe1, 0x22, 0x2d, 0x20, 0x94, 0x98, 0x42,
+    0xa0, 0xa3, 0x2d, 0x64, 0x01, 0xb5, 0x63, 0xc6, 0x03, 0x33, 0x8a, 0x71, 0xbc, 0x8e, 0xc0, 0xa8,
+    0x48, 0x7c, 0x06, 0x61, 0xf7, 0x27, 0x9a, 0xe4, 0xd3, 0x3c, 0x95, 0xbf, 0x4d, 0x56, 0x94, 0x25,
+    0xf7, 0x89, 0xde, 0x63, 0x8f, 0x07, 0xb2, 0xe0, 0x35, 0x90, 0xaf, 0x90, 0x11, 0x25, 0x04, 0x2f,
+    0x8a, 0x10, 0xfb, 0xe3, 0xf1, 0x74, 0x30, 0x6a, 0x72, 0xe1, 0x38, 0x3a, 0x1f, 0xce, 0x8c, 0x4c,
+    0xcb, 0x3e, 0xa6, 0x83, 0xbe, 0x9d, 0xfb, 0xc0, 0x82, 0xbc, 0x9b, 0xba, 0xe6, 0x9b, 0x7b, 0x83,
+    0x7a, 0x01, 0x6a, 0x5e, 0xfb, 0xe3, 0x02, 0xc5, 0xb4, 0x2a, 0xfd, 0x59, 0x29, 0xa0, 0x62, 0x6f,
+    0xd8, 0x23, 0xe2, 0x3e, 0x23, 0x90, 0xae, 0x25, 0x5f, 0x45, 0x06, 0x5b, 0x47, 0x79, 0x03, 0xb0,
+    0xc0, 0xe1, 0xd0, 0x56, 0x4c, 0x66, 0x5e, 0xd0, 0x4b, 0xbe, 0x5f, 0xb4, 0xe4, 0x6f, 0x13, 0xc8,
+    0x03, 0x9f, 0xc5, 0x14, 0x48, 0xe6, 0xaf, 0x57, 0x01, 0xa4, 0x2b, 0x68, 0x48, 0x71, 0xdc, 0x96,
+    0x0d, 0x61, 0x3a, 0x2c, 0xee, 0x22, 0x68, 0x34, 0x68, 0x9d, 0xb6, 0x6a, 0x99, 0x2e, 0xea, 0x3b,
+    0xa2, 0x03, 0x29, 0xb9, 0x92, 0x60, 0x69, 0xb8, 0xf9, 0x2e, 0x92, 0x88, 0xbb, 0xe5, 0x70, 0xf6,
+    0x1c, 0x5c, 0x42, 0x38, 0x35, 0xa9, 0x21, 0xac, 0x92, 0x8c, 0xe9, 0x61, 0x6c, 0x2a, 0x4a, 0x6f,
+    0xc9, 0x9c, 0xbb, 0xf6, 0xf1, 0x92, 0xfa, 0xe5, 0x0c, 0x96, 0x3e, 0xb7, 0x9f, 0x6c, 0xab, 0x3c,
+    0x99, 0x4c, 0xaa, 0xb0, 0x8d, 0x34, 0x25, 0xab, 0x04, 0x7b, 0x80, 0xfd, 0x35, 0x3d, 0xc3, 0xa3,
+    0xbe, 0x3d, 0xf4, 0xfc, 0x0e, 0x05, 0x77, 0x05, 0x8d, 0x22, 0xb3, 0xac, 0x36, 0x55, 0x18, 0xb2,
+    0x32, 0xe5, 0x7a, 0x35, 0xd4, 0xf2, 0x4c, 0x05, 0xc8, 0x0f, 0xa8, 0x70, 0x7c, 0x49, 0x28, 0x8f,
+    0x11, 0x22, 0xdb, 0x3c, 0x17, 0x29, 0xf9, 0xbd, 0x94, 0xe5, 0xf2, 0x8e, 0x4b, 0x2c, 0xf7, 0x2a,
+    0xc9, 0xe0, 0xd5, 0xb3, 0x75, 0x75, 0xcf, 0x4a, 0x65, 0x75, 0xb4, 0x7f, 0xe3, 0xce, 0xd8, 0x82,
+    0x87, 0xd9, 0xcd, 0xfd, 0xe1, 0xe8, 0x06, 0x14, 0x34, 0x16, 0x20, 0xcd, 0x4c, 0x76, 0x18, 0xb4,
+    0x85, 0x54, 0x49, 0x64, 0xf5, 0x86, 0x11, 0xa2, 0x38, 0x82, 0x06, 0xc9, 0x64, 0x53, 0x7a, 0x2f,
+    0xef, 0xae, 0xca, 0x12, 0x95, 0x51, 0xbc, 0x98, 0x70, 0x9d, 0x5d, 0x36, 0xd8, 0x21, 0xed, 0xf1,
+    0xb7, 0xc3, 0xdb, 0xfe, 0x78, 0x97, 0xb7, 0x56, 0x75, 0x9f, 0x8c, 0xb9, 0x5b, 0x92, 0xa6, 0xe5,
+    0xd1, 0x11, 0xb9, 0x56, 0xb3, 0x71, 0xd5, 0x51, 0xce, 0xd3, 0xc6, 0x04, 0x07, 0x72, 0x7d, 0x9d,
+    0x73, 0x5b, 0xfb, 0x9c, 0x95, 0x4d, 0x2c, 0x4c, 0xa5, 0x57, 0xc3, 0xc2, 0xba, 0xcb, 0x8c, 0xfa,
+    0x31, 0x0f, 0xb7, 0x31, 0x2e, 0xd7, 0xd0, 0x07, 0xc1, 0x5b, 0x02, 0x75, 0xd0, 0x00, 0xaa, 0x56,
+    0x26, 0xe5, 0xe6, 0x71, 0x50, 0x41, 0x58, 0x6a, 0x58, 0x59, 0x6d, 0xe7, 0x28, 0xe0, 0x01, 0xd5,
+    0xe3, 0xbb, 0xc3, 0x10, 0x0d, 0x00, 0xf6, 0x5a, 0x44, 0x12, 0xb2, 0x90, 0xb3, 0x54, 0x3a, 0xca,
+    0x7c, 0xc6, 0xbe, 0x5f, 0x66, 0x73, 0x1a, 0xce, 0xdc, 0x93, 0xad, 0x06, 0x41, 0xa9, 0x95, 0x0e,
+    0x17, 0x10, 0xae, 0x7a, 0x94, 0x08, 0x7c, 0xd5, 0x36, 0x21, 0xc2, 0x8e, 0x4e, 0xe1, 0x67, 0x75,
+    0x85, 0x1f, 0x74, 0x0a, 0x97, 0x18, 0x8e, 0xa8, 0x03, 0xda, 0xe8, 0xd3, 0x2a, 0x56, 0x9a, 0xa1,
+    0x60, 0x00, 0xd5, 0x51, 0x5d, 0x28, 0x06, 0xfd, 0xbd, 0xc9, 0x9d, 0x61, 0xd1, 0x21, 0xd9, 0xf9,
+    0x94, 0xd9, 0x44, 0x6b, 0xdb, 0x86, 0xb6, 0xab, 0xdb, 0xa4, 0xbd, 0xdc, 0x60, 0x03, 0x63, 0x97,
+    0xab, 0xd1, 0xa3, 0xd1, 0x68, 0x38, 0x9c, 0x34, 0x98, 0x6c, 0xb0, 0x08, 0xa0, 0x48, 0x3b, 0x36,
+    0xce, 0xde, 0xcc, 0x6a, 0xda, 0x26, 0xa2, 0xd0, 0xeb, 0x44, 0x93, 0xd0, 0x1e, 0x95, 0x2f, 0x8d,
+    0x95, 0x0d, 0x1a, 0xc1, 0x57, 0x40, 0x2a, 0xdf, 0x2f, 0x26, 0xd0, 0x94, 0xaf, 0x29, 0x2d, 0xea,
+    0x27, 0xc6, 0x05, 0x9a, 0x71, 0x96, 0x4f, 0x30, 0x25, 0xd7, 0xde, 0xf0, 0xdc, 0x76, 0xaa, 0x9f,
+    0xc1, 0x96, 0xc6, 0x0d, 0x0b, 0xc2, 0x75, 0xac, 0x91, 0x88, 0x8c, 0xbb, 0xfd, 0xed, 0x89, 0x4c,
+    0x08, 0xd1, 0xb3, 0x38, 0x1f, 0x3d, 0xc7, 0xe5, 0x3e, 0x11, 0xb9, 0x70, 0x97, 0x74, 0xe4, 0x7f,
+    0xd4, 0xbd, 0xb2, 0x5c, 0xe5, 0xaa, 0xa7, 0x3b, 0x77, 0xdf, 0x50, 0x09, 0xdf, 0x4c, 0x07, 0xcf,
+    0x55, 0xc1, 0xc6, 0x59, 0xf3, 0x22, 0x2a, 0x68, 0x43, 0xaa, 0x4b, 0x81, 0xd5, 0x28, 0x29, 0x27,
+    0x81, 0xdd, 0xd3, 0x4b, 0x41, 0x35, 0xd0, 0xa9, 0x59, 0x8a, 0xdf, 0x7f, 0x07, 0xe7, 0x93, 0x15,
+    0x25, 0x0c, 0xa3, 0x76, 0xe9, 0x26, 0x32, 0x9d, 0x00, 0x6b, 0x3b, 0x10, 0x44, 0x65, 0x52, 0x6b,
+    0x28, 0x35, 0xd4, 0x52, 0xa3, 0xe4, 0xcd, 0x8b, 0x0b, 0x03, 0x4d, 0xd2, 0xea, 0x9e, 0x40, 0x98,
+    0x48, 0xa7, 0x6a, 0x28, 0xbd, 0xb2, 0xab, 0x1d, 0x90, 0x60, 0xba, 0xe2, 0x04, 0xcb, 0x52, 0x86,
+    0x3c, 0x57, 0x53, 0x87, 0x1d, 0x52, 0x00, 0x5b, 0xa1, 0x0a, 0x7a, 0xe0, 0x53, 0x27, 0x56, 0x0f,
+    0x39, 0xc1, 0xd5, 0x10, 0xd2, 0x3c, 0x92, 0x54, 0xb4, 0x73, 0x7c, 0x81, 0x5b, 0x4f, 0x4e, 0x4a,
+    0xed, 0x75, 0xe7, 0x29, 0xe4, 0x43, 0xe8, 0xa1, 0xda, 0x28, 0x9d, 0x8d, 0x54, 0xc0, 0xb9, 0xf5,
+    0x39, 0xf3, 0xfe, 0xb0, 0x79, 0xde, 0xcf, 0xb2, 0x19, 0xe6, 0x17, 0xc5, 0xa2, 0x62, 0x7b, 0xd9,
+    0x14, 0x54, 0xdd, 0x47, 0xe9, 0x8c, 0xf6, 0xf0, 0xab, 0xb0, 0x78, 0xc7, 0x2e, 0x17, 0x96, 0x0a,
+    0x78, 0x35, 0x86, 0x15, 0x03, 0xa0, 0x95, 0x0e, 0x80, 0x97, 0x51, 0x9d, 0xe6, 0x3b, 0x7c, 0x16,
+    0x48, 0xca, 0xa5, 0xa8, 0xa1, 0x0d, 0x2a, 0x87, 0x7a, 0x49, 0x9d, 0x77, 0xcc, 0xd3, 0xbf, 0x19,
+    0xaf, 0xc0, 0xae, 0x74, 0xef, 0xbc, 0xd0, 0x16, 0xe7, 0x9d, 0x23, 0x13, 0x7b, 0x3a, 0x9e, 0x92,
+    0xf3, 0x4e, 0x9f, 0xe2, 0x4c, 0xaf, 0xd8, 0x8e, 0xf1, 0x64, 0x30, 0x99, 0xc9, 0xd5, 0xce, 0x3a,
+    0x50, 0x74, 0x47, 0x91, 0xc7, 0x37, 0xfb, 0x9e, 0x3c, 0x1b, 0xef, 0xe1, 0x28, 0xda, 0x00, 0x30,
+    0xb7, 0x18, 0xf6, 0xb9, 0xdb, 0x96, 0xad, 0x48, 0xb8, 0xbd, 0x5e, 0x41, 0x71, 0x7a, 0x2e, 0x8d,
+    0x6f, 0xfb, 0x54, 0x3e, 0xde, 0x3c, 0xba, 0x4b, 0xda, 0x46, 0x98, 0xad, 0xfd, 0x4c, 0xa6, 0x6e,
+    0x74, 0x40, 0xad, 0x8e, 0x7c, 0xda, 0xcb, 0x92, 0x42, 0xd7, 0x91, 0x21, 0xd3, 0x32, 0x16, 0xcd,
+    0x0e, 0x40, 0xa5, 0xf2, 0xfd, 0xc0, 0x3c, 0xd5, 0x39, 0x30, 0x3b, 0xcb, 0x24, 0xa0, 0x9b, 0xcb,
+    0x9a, 0x00, 0x18, 0x0e, 0x13, 0xab, 0xcb, 0x9a, 0xe5, 0xd9, 0xdd, 0x16, 0x82, 0x0b, 0x5d, 0x76,
+    0x72, 0x42, 0x33, 0x2a, 0x30, 0xda, 0x3e, 0x8f, 0xa8, 0x42, 0xe3, 0x0d, 0x81, 0xd3, 0xb8, 0xae,
+    0x54, 0x47, 0xb9, 0x87, 0xbc, 0xa2, 0x18, 0x65, 0x18, 0x82, 0xd5, 0x65, 0x60, 0x5e, 0x64, 0xd6,
+    0x19, 0x9c, 0x67, 0x59, 0x6b, 0x10, 0xcf, 0xad, 0x4b, 0xc8, 0x9e, 0xe5, 0xa1, 0xa1, 0x00, 0x70,
+    0x66, 0xd1, 0xd8, 0xf6, 0xda, 0xc6, 0xb5, 0x34, 0x39, 0x33, 0x87, 0xc5, 0xe8, 0x4a, 0xf1, 0xa0,
+    0xb1, 0xc7, 0x81, 0xae, 0xc6, 0xbd, 0xcf, 0xef, 0x3f, 0x30, 0xba, 0xad, 0xb4, 0x79, 0xa0, 0x8f,
+    0x8f, 0x8d, 0xfd, 0x54, 0x2c, 0xcc, 0x07, 0x47, 0x21, 0x35, 0x60, 0x05, 0x0e, 0x43, 0x9f, 0xd9,
+    0x4a, 0xce, 0xaf, 0x81, 0x2e, 0x6d, 0x36, 0xa6, 0x1c, 0x35, 0xcd, 0xb5, 0xf0, 0x69, 0x60, 0x73,
+    0x42, 0x89, 0x71, 0xd2, 0x55, 0xff, 0xa3, 0x9b, 0xa3, 0x47, 0x25, 0x2c, 0xae, 0xbf, 0x7f, 0x9c,
+    0x7e, 0xff, 0xf0, 0x8b, 0xbb, 0xfb, 0x7c, 0x15, 0x02, 0xe6, 0x70, 0x25, 0xcc, 0x16, 0x74, 0x4e,
+    0x3e, 0x28, 0x25, 0xae, 0x5f, 0x9a, 0x2d, 0x80, 0xa5, 0xb5, 0x0c, 0xf5, 0xcb, 0x4b, 0x8b, 0x3a,
+    0x27, 0x8f, 0x5a, 0x27, 0x9d, 0x56, 0x2f, 0xf6, 0x68, 0xd0, 0x86, 0xbb, 0x23, 0xac, 0x88, 0x80,
+    0x90, 0x1f, 0xa3, 0xfc, 0xb9, 0xf7, 0x38, 0xe2, 0x41, 0xbb, 0x93, 0x2f, 0x21, 0x38, 0xc6, 0xf2,
+    0xeb, 0xe3, 0x16, 0x73, 0x90, 0x7a, 0xd7, 0xcb, 0xa6, 0x5f, 0x49, 0x04, 0xec, 0x53, 0x11, 0xb7,
+    0x8d, 0xd7, 0x3f, 0x7e, 0x87, 0x92, 0x5f, 0x92, 0xe7, 0xa7, 0x5f, 0x27, 0xaf, 0x92, 0x3f, 0x4f,
+    0x9f, 0xa1, 0xd3, 0x6f, 0x4f, 0xbf, 0x49, 0xfe, 0x49, 0x5e, 0x9c, 0x7e, 0x9f, 0xfc, 0x9d, 0xbc,
+    0x42, 0xc9, 0xcb, 0xe4, 0xf7, 0xe4, 0xaf, 0xe4, 0x05, 0xbc, 0x81, 0x9f, 0xf7, 0x0c, 0x38, 0x6b,
+    0xca, 0x84, 0x05, 0xba, 0x21, 0xb8, 0xbe, 0xd2, 0x8b, 0x10, 0xb7, 0xb1, 0x27, 0xd4, 0xa4, 0x71,
+    0x99, 0xae, 0x92, 0xe3, 0x56, 0x56, 0x4f, 0x69, 0xff, 0xfa, 0xa7, 0x67, 0xc8, 0x40, 0x1f, 0x21,
+    0x95, 0xe2, 0x0a, 0xf2, 0xc3, 0xae, 0xd2, 0x35, 0x09, 0x16, 0x54, 0x18, 0xd8, 0x42, 0xa5, 0x61,
+    0x8a, 0xc5, 0xbb, 0x0d, 0x33, 0xf9, 0x19, 0x70, 0x7d, 0x99, 0xfc, 0x9a, 0xfc, 0x91, 0x3c, 0x47,
+    0x00, 0xf4, 0x2b, 0x40, 0xf5, 0x37, 0xf8, 0x40, 0xa1, 0x9b, 0xbc, 0x3c, 0xfd, 0x41, 0x36, 0xb0,
+    0x44, 0xf5, 0x5f, 0x57, 0x8d, 0x87, 0xf8, 0x53, 0x16, 0x00, 0x00,
+};
+
+// success.html: 1145 -> 1033 (мин.) -> 634 (gzip) байт
+static constexpr uint8_t ASSET_SUCCESS_HTML[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6d, 0x53, 0xcb, 0x6e, 0xd3, 0x40,
+    0x14, 0xdd, 0xe7, 0x2b, 0x6e, 0xcd, 0x06, 0xa4, 0x3a, 0x8e, 0x43, 0x1a, 0x55, 0x8e, 0x1d, 0xa9,
+    0x2a, 0x74, 0x87, 0x00, 0x29, 0x08, 0xb1, 0x9c, 0xd8, 0x93, 0x78, 0x84, 0x63, 0x9b, 0xf1, 0xe4,
+    0x51, 0x50, 0xa5, 0xa6, 0x88, 0x87, 0x54, 0x89, 0x2e, 0xd8, 0x82, 0xf8, 0x02, 0xa4, 0xa8, 0x10,
+    0x11, 0x42, 0xda, 0xfe, 0xc2, 0xf8, 0x17, 0xf8, 0x12, 0xee, 0xf8, 0x41, 0x53, 0x88, 0x66, 0x71,
+    0xc7, 0x33, 0xf7, 0x9e, 0x73, 0xee, 0x9d, 0x63, 0x7b, 0xeb, 0xde, 0xc3, 0xfd, 0xce, 0xb3, 0x47,
+    0xf7, 0xc1, 0x17, 0x83, 0xa0, 0x5d, 0xb1, 0xcb, 0x40, 0x89, 0x87, 0x61, 0x40, 0x05, 0x81, 0x90,
+    0x0c, 0xa8, 0xa3, 0x8d, 0x18, 0x1d, 0xc7, 0x11, 0x17, 0x1a, 0xb8, 0x51, 0x28, 0x68, 0x28, 0x1c,
+    0x6d, 0xcc, 0x3c, 0xe1, 0x3b, 0x1e, 0x1d, 0x31, 0x97, 0xea, 0xd9, 0xc7, 0x36, 0xb0, 0x90, 0x09,
+    0x46, 0x02, 0x3d, 0x71, 0x49, 0x40, 0x1d, 0x53, 0x2b, 0x41, 0x5c, 0x9f, 0xf0, 0x84, 0x62, 0xd1,
+    0x93, 0xce, 0x81, 0xbe, 0xab, 0x8e, 0x05, 0x13, 0x01, 0x6d, 0xcb, 0xcf, 0x72, 0x96, 0x4e, 0xd3,
+    0x93, 0xf4, 0x58, 0x5e, 0xca, 0x9f, 0x72, 0x29, 0x17, 0x20, 0xaf, 0x70, 0xbb, 0x92, 0x57, 0xe9,
+    0x29, 0xa4, 0x53, 0x79, 0x99, 0xbe, 0xc1, 0xbb, 0x99, 0xbc, 0x90, 0x73, 0x79, 0x91, 0x9e, 0xda,
+    0x46, 0x5e, 0x57, 0xb1, 0x13, 0x71, 0xa8, 0x62, 0x37, 0xf2, 0x0e, 0xe1, 0x15, 0xf4, 0x50, 0x94,
+    0xde, 0x23, 0x03, 0x16, 0x1c, 0x5a, 0xb0, 0xc7, 0x51, 0x42, 0x0b, 0x04, 0x9d, 0x08, 0x9d, 0x04,
+    0xac, 0x1f, 0x5a, 0xe0, 0xa2, 0x62, 0xca, 0x5b, 0x30, 0x20, 0xbc, 0xcf, 0x42, 0x5d, 0x44, 0xb1,
+    0x05, 0x3b, 0xb5, 0x78, 0xd2, 0x82, 0x2e, 0x71, 0x9f, 0xf7, 0x79, 0x34, 0x0c, 0x3d, 0x0b, 0x6e,
+    0xf5, 0x6a, 0x6a, 0xb5, 0xe0, 0xa8, 0x52, 0x55, 0x6d, 0x12, 0x16, 0x52, 0x8e, 0xe8, 0x03, 0x32,
+    0xc9, 0x1b, 0xb4, 0xa0, 0x51, 0xcb, 0xaa, 0x72, 0x1c, 0x0b, 0x6a, 0x40, 0x86, 0x22, 0xba, 0x89,
+    0x32, 0xf6, 0x99, 0xa0, 0x2d, 0x88, 0x89, 0xe7, 0xb1, 0xb0, 0x6f, 0xc1, 0xdd, 0x9c, 0x27, 0xe2,
+    0x1e, 0xe5, 0x3a, 0x27, 0x1e, 0x1b, 0x26, 0x16, 0x98, 0xc5, 0xe1, 0x44, 0x4f, 0x7c, 0xe2, 0x45,
+    0x63, 0x05, 0x55, 0x8f, 0x27, 0xd9, 0x39, 0xf0, 0x7e, 0x97, 0xdc, 0xae, 0x6d, 0x67, 0xab, 0x6a,
+    0xde, 0x51, 0x7a, 0x7c, 0x13, 0x75, 0xb8, 0x51, 0x10, 0x71, 0x94, 0xd9, 0xd8, 0xdf, 0x3b, 0xd8,
+    0x41, 0x99, 0x59, 0xd7, 0x09, 0x7b, 0x49, 0x2d, 0xa8, 0x37, 0x14, 0x1e, 0xea, 0x66, 0x61, 0x2f,
+    0x5a, 0x4b, 0x6d, 0x36, 0x9b, 0xd7, 0x6a, 0xeb, 0x0a, 0x3c, 0x6f, 0x2f, 0x19, 0xba, 0x2e, 0x4d,
+    0x12, 0x9d, 0x61, 0x9f, 0xe5, 0xfc, 0x72, 0xa4, 0xc6, 0xee, 0x7a, 0x83, 0x65, 0xc9, 0xbf, 0xd4,
+    0x47, 0x15, 0xdb, 0x28, 0x9e, 0x20, 0x7f, 0x61, 0x5f, 0x88, 0x58, 0xa7, 0x2f, 0x86, 0x6c, 0xe4,
+    0x68, 0x9c, 0xf6, 0x38, 0x4d, 0xfc, 0x35, 0xaf, 0x98, 0xb5, 0xd6, 0x90, 0x07, 0x8e, 0xa1, 0x5e,
+    0xde, 0x28, 0xdc, 0xa5, 0x9e, 0x0e, 0x83, 0xc7, 0x46, 0xe0, 0x06, 0x24, 0x49, 0x1c, 0xed, 0xef,
+    0xcc, 0xb5, 0x9b, 0xe7, 0xeb, 0x62, 0xb5, 0xf6, 0xef, 0x4f, 0x1f, 0x6d, 0x03, 0x6f, 0x95, 0x4f,
+    0xcd, 0x4d, 0x0e, 0xfa, 0xdf, 0x36, 0x5b, 0x48, 0x6a, 0x62, 0x7e, 0x5c, 0x22, 0xaa, 0x29, 0x69,
+    0x6d, 0xf9, 0x05, 0x6b, 0x55, 0xda, 0x4a, 0xce, 0x15, 0x02, 0x5a, 0xee, 0x29, 0xd3, 0x0f, 0x18,
+    0x20, 0xc8, 0x83, 0xc7, 0x9d, 0xce, 0x06, 0xa4, 0xaa, 0xdd, 0xe5, 0xed, 0x0a, 0x16, 0x66, 0x1e,
+    0x95, 0x33, 0x65, 0xd7, 0x39, 0x26, 0xcc, 0xe5, 0x0f, 0x4c, 0xfa, 0x86, 0x18, 0xaf, 0x71, 0xb7,
+    0x40, 0xb4, 0x69, 0x7a, 0x06, 0xa5, 0x9d, 0xbf, 0xa3, 0xae, 0x5f, 0xe9, 0x87, 0xf4, 0xdd, 0xf5,
+    0xcd, 0x12, 0xe4, 0x39, 0xb2, 0xbf, 0x97, 0x0b, 0xb9, 0x52, 0x3c, 0x4a, 0xc0, 0x99, 0x5c, 0x55,
+    0x6d, 0x23, 0xde, 0x20, 0xf4, 0x6b, 0x7a, 0x82, 0x5c, 0x45, 0x9f, 0x4a, 0xcc, 0x22, 0x7d, 0xab,
+    0xc8, 0x15, 0xe9, 0x32, 0x6b, 0x7d, 0x5e, 0x02, 0xcf, 0xe4, 0x39, 0x26, 0x2b, 0x79, 0x33, 0x8c,
+    0x0b, 0xe4, 0x9c, 0x23, 0x3c, 0xce, 0xa5, 0x80, 0x2e, 0x46, 0x67, 0x14, 0xe3, 0x37, 0xb2, 0x5f,
+    0xfe, 0x0f, 0x40, 0xe0, 0x0c, 0xf5, 0x09, 0x04, 0x00, 0x00,
+};
+
+static constexpr WebAsset WEB_ASSETS[] = {
+    { "/config.html", "text/html", ASSET_CONFIG_HTML, sizeof(ASSET_CONFIG_HTML), 6677, "\"875ecde006\"", false },
+    { "/dashboard.html", "text/html", ASSET_DASHBOARD_HTML, sizeof(ASSET_DASHBOARD_HTML), 5523, "\"0c804987dd\"", false },
+    { "/error.html", "text/html", ASSET_ERROR_HTML, sizeof(ASSET_ERROR_HTML), 1269, "\"a1201b011e\"", false },
+    { "/index.html", "text/html", ASSET_INDEX_HTML, sizeof(ASSET_INDEX_HTML), 1073, "\"392fe5d3ce\"", false },
+    { "/login.html", "text/html", ASSET_LOGIN_HTML, sizeof(ASSET_LOGIN_HTML), 1245, "\"4eaca7a74e\"", false },
+    { "/script.js", "application/javascript", ASSET_SCRIPT_JS, sizeof(ASSET_SCRIPT_JS), 10732, "\"c3b2246115\"", true },
+    { "/style.css", "text/css", ASSET_STYLE_CSS, sizeof(ASSET_STYLE_CSS), 6684, "\"94c8530a45\"", true },
+    { "/success.html", "text/html", ASSET_SUCCESS_HTML, sizeof(ASSET_SUCCESS_HTML), 1145, "\"d18eaf8359\"", false },
+};
+
+static constexpr size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
+
+#endif
@@ -3,15 +3,37 @@
 
 #include "WebDashboard.h"
 #include "debug.h"
+#include "JsonWriter.h"
+#include <lwip/sockets.h>
+#include <errno.h>
+
+static const char* STATE_NAMES[] = {"INIT", "IDLE", "FILLING", "CALIBRATION", "ERROR"};
 
 WebDashboard::WebDashboard(WebServer& srv, Scale& s, PumpController& p, Display& d, 
                            StateMachine* sm, WiFiManager& wm, MQTTManager* mqm,
                            bool enableAuth)
     : server(srv), scale(s), pump(p), display(d), 
       stateMachine(sm), wifiManager(wm), mqttManager(mqm),
+      eventQueue(nullptr), controlScheduler(nullptr), networkScheduler(nullptr),
       authEnabled(enableAuth), 
       username(WEB_USERNAME), 
-      defaultPassword(WEB_PASSWORD) {
+      defaultPassword(WEB_PASSWORD),
+      lastSsePush(0), sseEventsSent(0), sseRejected(0),
+      lastSsePushTime(0), maxSsePushTime(0), lastStatusTime(0), maxStatusTime(0),
+      sseClientHeap(0), lastStatusSize(0), networkStackFree(0),
+      statusCacheLength(0), statusCacheTime(0),
+      statusCacheHits(0), statusCacheMisses(0), statusNotModified(0),
+      rebootAt(0), apiCommands(0), apiRejected(0) {
+    
+    for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+        sseClients[i].active = false;
+        sseClients[i].pending = 0;
+    }
+    
+    // ETag отличается между перезагрузками: номер выдачи начинается заново
+    statusETag.begin(esp_random());
+    statusCache[0] = '\0';
+    memset(&statusSnapshot, 0, sizeof(statusSnapshot));
     
     // Загружаем пароль из EEPROM или используем default
     loadPasswordFromEEPROM();
@@ -96,6 +118,10 @@ void WebDashboard::begin() {
     // Страница смены пароля
     server.on("/change-password", HTTP_POST, std::bind(&WebDashboard::handleChangePassword, this));
     
+    // Заголовки запроса, которые нужны обработчикам (Authorization собирается всегда)
+    static const char* headerKeys[] = { "If-None-Match" };
+    server.collectHeaders(headerKeys, 1);
+    
     // Главная страница
     server.on("/", HTTP_GET, [this]() {
         if (!checkAuth()) return;
@@ -108,6 +134,12 @@ void WebDashboard::begin() {
         handleAPIStatus();
     });
     
+    // Поток изменений состояния (Server-Sent Events) вместо опроса /api/status
+    server.on("/api/events", HTTP_GET, [this]() {
+        if (!checkAuth()) return;
+        handleAPIEvents();
+    });
+    
     server.on("/api/fill", HTTP_POST, [this]() {
         if (!checkAuth()) return;
         handleAPIFill();
@@ -128,11 +160,19 @@ void WebDashboard::begin() {
         handleAPIReboot();
     });
     
-    // Статические файлы
-    server.serveStatic("/dashboard.html", SPIFFS, "/dashboard.html");
-    server.serveStatic("/style.css", SPIFFS, "/style.css");
-    server.serveStatic("/script.js", SPIFFS, "/script.js");
-    server.serveStatic("/favicon.ico", SPIFFS, "/favicon.ico");
+    // Сброс статистики задач - для замеров под нагрузкой (tools/load_test.py)
+    server.on("/api/stats/reset", HTTP_POST, [this]() {
+        if (!checkAuth()) return;
+        handleAPIStatsReset();
+    });
+    
+    // Статические файлы: встроены в прошивку и уже сжаты (WebAssets.h)
+    for (size_t i = 0; i < getWebAssetCount(); i++) {
+        const WebAsset* asset = &getWebAsset(i);
+        server.on(asset->path, HTTP_GET, [this, asset]() {
+            sendWebAsset(server, *asset);
+        });
+    }
     
     server.onNotFound(std::bind(&WebDashboard::handleNotFound, this));
     
@@ -164,10 +204,9 @@ void WebDashboard::handleLogin() {
         }
     } else {
         // Просто показываем страницу входа
-        if (SPIFFS.exists("/login.html")) {
-            File file = SPIFFS.open("/login.html", "r");
-            server.streamFile(file, "text/html");
-            file.close();
+        const WebAsset* page = findWebAsset("/login.html");
+        if (page) {
+            sendWebAsset(server, *page);
         } else {
             server.send(500, "text/plain", "Login page not found");
         }
@@ -229,67 +268,530 @@ void WebDashboard::handleRoot() {
 
 void WebDashboard::handleAPIStatus() {
     DENTER("WebDashboard::handleAPIStatus");
+    uint32_t start = micros();
     
-    StaticJsonDocument<1024> doc;
+    // Обработчик работает в сетевой задаче на другом ядре - состояние
+    // берем только из согласованного снимка, а не из геттеров модулей
+    SystemSnapshot snap;
+    if (stateMachine) {
+        stateMachine->readSnapshot(snap);
+    } else {
+        memset(&snap, 0, sizeof(snap));
+    }
     
-    float currentWeight = scale.getCurrentWeight();
-    float emptyWeight = scale.getEmptyWeight();
-    float waterVolume = currentWeight - emptyWeight;
-    if (waterVolume < 0) waterVolume = 0;
+    // Поля рисуются из снимка последней версии: шум веса внутри шага версии
+    // (SNAPSHOT_*) не меняет их текст, а значит и ETag
+    if (snap.version != statusSnapshot.version) statusSnapshot = snap;
+    
+    // ETag - по хешу отрисованных полей; документ пересобирается при его смене,
+    // диагностика (uptime, куча, MQTT) - не реже STATUS_CACHE_MAX_AGE
+    unsigned long now = millis();
+    bool changed = statusETag.update(hashStatusView(statusSnapshot), now, STATUS_ETAG_MAX_AGE);
+    bool fresh = !changed && statusCacheLength > 0 && now - statusCacheTime < STATUS_CACHE_MAX_AGE;
+    if (fresh) {
+        statusCacheHits++;
+    } else {
+        statusCacheMisses++;
+        statusCacheTime = now;
+        JsonWriter json(statusCache, sizeof(statusCache));
+        writeStatus(json, statusSnapshot);
+        statusCacheLength = json.finish();
+    }
     
-    doc["currentWeight"] = currentWeight;
-    doc["emptyWeight"] = emptyWeight;
-    doc["waterVolume"] = waterVolume;
-    doc["maxVolume"] = FULL_WATER_LEVEL;
-    doc["cups"] = Display::mlToCups(waterVolume);
-    doc["waterLevel"] = (int)((waterVolume / FULL_WATER_LEVEL) * 100);
+    server.sendHeader("ETag", statusETag.c_str());
+    server.sendHeader("Cache-Control", "no-cache");
+    
+    if (statusETag.matches(server.header("If-None-Match").c_str())) {
+        // У клиента та же версия документа - тело не отправляем
+        statusNotModified++;
+        server.send(304);
+    } else if (statusCacheLength > 0) {
+        server.setContentLength(statusCacheLength);
+        server.send(200, "application/json", "");
+        server.sendContent(statusCache, statusCacheLength);
+        lastStatusSize = statusCacheLength;
+    } else {
+        // Документ не поместился в кэш - пишем чанками из буфера на стеке
+        char chunk[STATUS_CHUNK_SIZE];
+        server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+        server.send(200, "application/json", "");
+        JsonWriter json(chunk, sizeof(chunk), sendChunk, &server);
+        writeStatus(json, statusSnapshot);
+        lastStatusSize = json.finish();
+        server.sendContent("");  // Последний (пустой) чанк
+    }
     
-    SystemState state = stateMachine ? stateMachine->getCurrentStateEnum() : ST_IDLE;
-    const char* stateNames[] = {"INIT", "IDLE", "FILLING", "CALIBRATION", "ERROR"};
-    doc["systemState"] = stateNames[state];
+    lastStatusTime = micros() - start;
+    if (lastStatusTime > maxStatusTime) maxStatusTime = lastStatusTime;
     
-    doc["kettlePresent"] = scale.isKettlePresent();
-    doc["wifiConnected"] = wifiManager.isConnected();
-    doc["wifiSignal"] = WiFi.RSSI();
-    doc["wifiSSID"] = wifiManager.getSSID();
-    doc["localIP"] = WiFi.localIP().toString();
+    // Минимальный запас стека сетевой задачи за все время работы (байт)
+    networkStackFree = uxTaskGetStackHighWaterMark(NULL) * sizeof(StackType_t);
     
-    bool mqttConnected = mqttManager ? mqttManager->isConnected() : false;
-    doc["mqttConnected"] = mqttConnected;
-    doc["mqttSent"] = mqttManager ? mqttManager->getMessagesSent() : 0;
-    doc["mqttFailed"] = mqttManager ? mqttManager->getMessagesFailed() : 0;
+    DEXIT("WebDashboard::handleAPIStatus");
+}
+
+void WebDashboard::writeStatusView(JsonWriter& json, const SystemSnapshot& snap) {
+    json.field("version", snap.version);
+    json.field("currentWeight", snap.currentWeight);
+    json.field("emptyWeight", snap.emptyWeight);
+    json.field("waterVolume", snap.waterVolume);
+    json.field("maxVolume", (int)FULL_WATER_LEVEL);
+    json.field("cups", Display::mlToCups(snap.waterVolume));
+    json.field("waterLevel", (int)((snap.waterVolume / FULL_WATER_LEVEL) * 100));
+    json.field("systemState", STATE_NAMES[snap.state]);
+    json.field("error", errorName(snap.error));
+    
+    json.field("flowRate", snap.flowRate);
+    json.field("flowVariance", snap.flowVariance, 3);
+    json.field("timeToTarget", snap.timeToTarget, 1);
+    
+    json.field("fillsLearned", snap.fillsLearned);
+    json.field("fillErrorMean", snap.fillErrorMean);
+    json.field("fillErrorStd", snap.fillErrorStd);
+    json.field("stateTransitions", snap.stateTransitions);
+    json.field("commandLatency", snap.commandLatency);
+    json.field("commandLatencyMax", snap.commandLatencyMax);
+    
+    json.field("kettlePresent", snap.kettlePresent);
+    json.field("wifiConnected", wifiManager.isConnected());
+    json.field("mqttConnected", mqttManager ? mqttManager->isConnected() : false);
+    
+    json.field("calibrationFactor", snap.calibrationFactor, 6);
+    json.field("calibrationDone", snap.calibrationDone);
+    json.field("factorCalibrated", snap.factorCalibrated);
+}
+
+uint32_t WebDashboard::hashStatusView(const SystemSnapshot& snap) {
+    // Текст полей не хранится: окно на стеке сбрасывается прямо в хеш
+    char window[STATUS_HASH_WINDOW];
+    uint32_t hash = STATUS_HASH_SEED;
+    JsonWriter json(window, sizeof(window), statusHashChunk, &hash);
+    json.beginObject();
+    writeStatusView(json, snap);
+    json.endObject();
+    json.finish();
+    return hash;
+}
+
+void WebDashboard::writeStatus(JsonWriter& json, const SystemSnapshot& snap) {
+    json.beginObject();
+    writeStatusView(json, snap);
+    
+    if (eventQueue) {
+        json.field("eventsPosted", eventQueue->getPosted());
+        json.field("eventsDropped", eventQueue->getDropped());
+        json.field("eventLatencyMaxUs", eventQueue->getMaxLatency());
+    }
     
-    doc["calibrationFactor"] = scale.getCalibrationFactor();
-    doc["calibrationDone"] = scale.isCalibrationDone();
-    doc["factorCalibrated"] = scale.isFactorCalibrated();
+    json.beginArray("tasks");
+    TaskScheduler* schedulers[] = { controlScheduler, networkScheduler };
+    for (uint8_t k = 0; k < 2; k++) {
+        TaskScheduler* scheduler = schedulers[k];
+        if (!scheduler) continue;
+        
+        for (uint8_t i = 0; i < scheduler->getTaskCount(); i++) {
+            const ScheduledTask& task = scheduler->getTask(i);
+            json.beginObject();
+            json.field("name", task.name);
+            json.field("core", scheduler == networkScheduler ? NETWORK_TASK_CORE : 1);
+            json.field("runs", task.runs);
+            json.field("avgUs", scheduler->getAverageRunTime(i));
+            json.field("maxUs", task.maxRunTime);
+            json.field("jitterUs", task.maxJitter);
+            json.field("misses", task.misses);
+            json.endObject();
+        }
+    }
+    json.endArray();
+    
+    IPAddress ip = WiFi.localIP();
+    char ipText[16];
+    snprintf(ipText, sizeof(ipText), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+    
+    json.field("wifiSignal", (int)WiFi.RSSI());
+    json.field("wifiSSID", wifiManager.getSSID().c_str());
+    json.field("localIP", ipText);
+    
+    json.field("mqttSent", mqttManager ? mqttManager->getMessagesSent() : 0UL);
+    json.field("mqttFailed", mqttManager ? mqttManager->getMessagesFailed() : 0UL);
+    if (mqttManager) {
+        json.field("mqttClientId", mqttManager->getClientId());
+        json.field("mqttDevice", mqttManager->getDeviceName());
+        json.field("mqttState", MQTTManager::connStateName(mqttManager->getConnState()));
+        json.field("mqttLastError", MQTTManager::failReasonName(mqttManager->getLastFailReason()));
+        json.field("mqttLastErrorCode", mqttManager->getLastFailCode());
+        json.field("mqttConnectMs", mqttManager->getLastConnectLatency());
+        json.field("mqttConnectMaxMs", mqttManager->getMaxConnectLatency());
+        json.field("mqttRetryMs", mqttManager->getRetryDelay());
+        json.field("mqttReceived", mqttManager->getMessagesReceived());
+        json.field("mqttReceiveUs", mqttManager->getLastReceiveTime());
+        json.field("mqttReceiveMaxUs", mqttManager->getMaxReceiveTime());
+        json.field("mqttReceiveHeapOps", mqttManager->getReceiveHeapOps());
+        json.field("commandsDuplicate", mqttManager->getCommandsDuplicate());
+        json.field("commandAcks", mqttManager->getAcksSent());
+        json.field("waterStatePublishes", mqttManager->getWaterStatePublishes());
+        json.field("waterStateSuppressed", mqttManager->getWaterStateSuppressed());
+        json.field("telemetrySent", mqttManager->getTelemetrySent());
+        json.field("telemetryBytes", mqttManager->getLastTelemetrySize());
+        
+        MqttOutbox& outbox = mqttManager->getOutbox();
+        json.field("outboxDepth", outbox.getDepth());
+        json.field("outboxDrained", outbox.getDrained());
+        json.field("outboxDropped", outbox.getDropped());
+        json.field("outboxDrainRate", mqttManager->getOutboxDrainRate(), 1);
+    }
     
-    doc["uptime"] = millis();
-    doc["freeHeap"] = ESP.getFreeHeap();
+    json.field("sseClients", getSseClientCount());
+    json.field("sseEventsSent", sseEventsSent);
+    json.field("sseRejected", sseRejected);
+    json.field("ssePushUs", lastSsePushTime);
+    json.field("ssePushMaxUs", maxSsePushTime);
+    json.field("sseClientHeap", sseClientHeap);
+    json.field("statusUs", lastStatusTime);
+    json.field("statusMaxUs", maxStatusTime);
+    json.field("statusBytes", lastStatusSize);
+    json.field("networkStackFree", networkStackFree);
+    
+    unsigned long requests = statusCacheHits + statusCacheMisses;
+    json.field("statusCacheHits", statusCacheHits);
+    json.field("statusCacheMisses", statusCacheMisses);
+    json.field("statusNotModified", statusNotModified);
+    json.field("statusCacheHitRate", requests > 0 ? 100.0 * statusCacheHits / requests : 0.0, 1);
+    json.field("apiCommands", apiCommands);
+    json.field("apiRejected", apiRejected);
+    
+    const WebAssetStats& assets = getWebAssetStats();
+    json.field("assetRequests", assets.requests);
+    json.field("assetNotModified", assets.notModified);
+    json.field("assetBytes", assets.bytesSent);
+    json.field("assetSendUs", assets.lastSendUs);
+    json.field("assetSendMaxUs", assets.maxSendUs);
+    
+    json.field("uptime", millis());
+    json.field("freeHeap", ESP.getFreeHeap());
     
     // Информация о пароле (безопасно - только факт смены)
-    doc["passwordChanged"] = (currentPassword != defaultPassword);
+    json.field("passwordChanged", currentPassword != defaultPassword);
+    json.endObject();
+}
+
+void WebDashboard::sendChunk(void* context, const char* data, size_t length) {
+    ((WebServer*)context)->sendContent(data, length);
+}
+
+// ==================== SERVER-SENT EVENTS ====================
+void WebDashboard::handleAPIEvents() {
+    SseClient* sse = nullptr;
+    for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+        if (!sseClients[i].active) {
+            sse = &sseClients[i];
+            break;
+        }
+    }
+    if (!sse) {
+        sseRejected++;
+        server.send(503, "text/plain", "Too many event subscribers");
+        return;
+    }
     
-    String response;
-    serializeJson(doc, response);
-    server.send(200, "application/json", response);
+    // Сервер закроет свою копию клиента после обработчика, наша держит сокет открытым
+    int32_t heapBefore = ESP.getFreeHeap();
+    sse->client = server.client();
+    sse->client.setNoDelay(true);
+    sse->client.print("HTTP/1.1 200 OK\r\n"
+                      "Content-Type: text/event-stream\r\n"
+                      "Cache-Control: no-cache\r\n"
+                      "Connection: keep-alive\r\n\r\n"
+                      "retry: 3000\n\n");
+    
+    sse->active = true;
+    sse->needFull = true;
+    sse->pending = 0;
+    sse->lastEventTime = millis();
+    sse->deferred = 0;
+    sseClientHeap = heapBefore - (int32_t)ESP.getFreeHeap();
+    
+    // Первое событие со всеми полями - на ближайшем проходе
+    lastSsePush = 0;
+    DPRINTF("📊 SSE: подписчик подключен (%u из %d)\n", getSseClientCount(), SSE_MAX_CLIENTS);
+}
+
+void WebDashboard::readSseFields(SseFields& fields) {
+    SystemSnapshot snap;
+    if (stateMachine) {
+        stateMachine->readSnapshot(snap);
+    } else {
+        memset(&snap, 0, sizeof(snap));
+    }
     
-    DEXIT("WebDashboard::handleAPIStatus");
+    memset(&fields, 0, sizeof(fields));
+    fields.currentWeight = roundf(snap.currentWeight * 10) / 10;
+    fields.emptyWeight = roundf(snap.emptyWeight * 10) / 10;
+    fields.waterVolume = roundf(snap.waterVolume);
+    fields.cups = Display::mlToCups(snap.waterVolume);
+    fields.state = snap.state;
+    fields.error = snap.error;
+    fields.kettlePresent = snap.kettlePresent;
+    fields.calibrationDone = snap.calibrationDone;
+    fields.mqttConnected = mqttManager ? mqttManager->isConnected() : false;
+    fields.wifiSignal = WiFi.RSSI();
+    fields.calibrationFactor = snap.calibrationFactor;
+    fields.flowRate = roundf(snap.flowRate * 10) / 10;
+    fields.timeToTarget = roundf(snap.timeToTarget);
+    fields.mqttSent = mqttManager ? mqttManager->getMessagesSent() : 0;
+    fields.mqttFailed = mqttManager ? mqttManager->getMessagesFailed() : 0;
+    fields.uptimeMinutes = millis() / 60000;
+    fields.freeHeapKb = ESP.getFreeHeap() / 1024;
+}
+
+size_t WebDashboard::buildSseEvent(const SseFields& current, const SseFields& last, bool full,
+                                   char* out, size_t size) {
+    // Формат события: "data: <json>\n\n"
+    const size_t prefix = 6;
+    if (size < prefix + 3) return 0;
+    memcpy(out, "data: ", prefix);
+    
+    // Два байта в конце оставляем под "\n\n"
+    JsonWriter json(out + prefix, size - prefix - 2);
+    json.beginObject();
+    
+    // Только изменившиеся поля (или все - для нового подписчика)
+    bool changed = false;
+#define SSE_FIELD(name, ...) \
+    if (full || current.name != last.name) { json.field(#name, current.name, ##__VA_ARGS__); changed = true; }
+    SSE_FIELD(currentWeight, 1);
+    SSE_FIELD(emptyWeight, 1);
+    SSE_FIELD(waterVolume, 0);
+    SSE_FIELD(cups);
+    SSE_FIELD(kettlePresent);
+    SSE_FIELD(calibrationDone);
+    SSE_FIELD(mqttConnected);
+    SSE_FIELD(wifiSignal);
+    SSE_FIELD(calibrationFactor, 6);
+    SSE_FIELD(flowRate, 1);
+    SSE_FIELD(timeToTarget, 0);
+    SSE_FIELD(mqttSent);
+    SSE_FIELD(mqttFailed);
+#undef SSE_FIELD
+    if (full || current.state != last.state) {
+        json.field("systemState", STATE_NAMES[current.state]);
+        changed = true;
+    }
+    if (full || current.error != last.error) {
+        json.field("error", errorName((ErrorType)current.error));
+        changed = true;
+    }
+    if (full || current.uptimeMinutes != last.uptimeMinutes) {
+        json.field("uptime", current.uptimeMinutes * 60000UL);
+        changed = true;
+    }
+    if (full || current.freeHeapKb != last.freeHeapKb) {
+        json.field("freeHeap", current.freeHeapKb * 1024UL);
+        changed = true;
+    }
+    if (full) json.field("maxVolume", (int)FULL_WATER_LEVEL);
+    
+    json.endObject();
+    size_t length = json.finish();
+    if (!changed || length == 0) return 0;
+    
+    length += prefix;
+    out[length++] = '\n';
+    out[length++] = '\n';
+    out[length] = '\0';
+    return length;
+}
+
+void WebDashboard::pushEvents() {
+    // Досылаем то, что не ушло в сокет на прошлых проходах
+    bool anyActive = false;
+    for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+        SseClient& sse = sseClients[i];
+        if (!sse.active) continue;
+        if (!flushSseClient(sse)) {
+            closeSseClient(sse);
+            continue;
+        }
+        anyActive = true;
+    }
+    if (!anyActive) return;
+    
+    unsigned long now = millis();
+    if (now - lastSsePush < SSE_PUSH_INTERVAL) return;
+    lastSsePush = now;
+    uint32_t start = micros();
+    
+    SseFields current;
+    readSseFields(current);
+    
+    char event[SSE_EVENT_MAX];
+    for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+        SseClient& sse = sseClients[i];
+        if (!sse.active) continue;
+        
+        size_t length = buildSseEvent(current, sse.last, sse.needFull, event, sizeof(event));
+        bool keepalive = false;
+        if (length == 0) {
+            // Ничего не изменилось: изредка шлем комментарий, чтобы заметить разрыв
+            if (now - sse.lastEventTime < SSE_KEEPALIVE) continue;
+            length = snprintf(event, sizeof(event), ": ping\n\n");
+            keepalive = true;
+        }
+        
+        // Медленный клиент: событие не помещается в буфер - откладываем,
+        // изменения войдут в следующее событие
+        if (sse.pending + length > SSE_BUFFER_SIZE) {
+            sse.deferred++;
+            continue;
+        }
+        
+        memcpy(sse.buffer + sse.pending, event, length);
+        sse.pending += length;
+        sse.lastEventTime = now;
+        if (!keepalive) {
+            sse.last = current;
+            sse.needFull = false;
+            sseEventsSent++;
+        }
+        
+        if (!flushSseClient(sse)) closeSseClient(sse);
+    }
+    
+    lastSsePushTime = micros() - start;
+    if (lastSsePushTime > maxSsePushTime) maxSsePushTime = lastSsePushTime;
+}
+
+bool WebDashboard::flushSseClient(SseClient& sse) {
+    if (!sse.client.connected()) return false;
+    if (sse.pending == 0) return true;
+    
+    // Неблокирующая запись: сетевая задача не ждет медленного клиента
+    int sent = send(sse.client.fd(), sse.buffer, sse.pending, MSG_DONTWAIT);
+    if (sent < 0) return errno == EAGAIN || errno == EWOULDBLOCK;
+    
+    memmove(sse.buffer, sse.buffer + sent, sse.pending - sent);
+    sse.pending -= sent;
+    return true;
+}
+
+void WebDashboard::closeSseClient(SseClient& sse) {
+    sse.client.stop();
+    sse.active = false;
+    sse.pending = 0;
+    DPRINTF("📊 SSE: подписчик отключен (отложено событий: %lu)\n", sse.deferred);
+}
+
+uint8_t WebDashboard::getSseClientCount() {
+    uint8_t count = 0;
+    for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+        if (sseClients[i].active) count++;
+    }
+    return count;
+}
+
+// ==================== КОМАНДЫ API ====================
+// Ответ отправляется сразу после постановки события в очередь: налив и
+// калибровка идут в задаче управления, ход виден через /api/status и /api/events.
+// Проверки те же, что у команд MQTT (checkFill), только по снимку (WebApi.h);
+// задача управления повторяет их на текущих данных перед выполнением.
+
+bool WebDashboard::readCommandSnapshot(const char* action, SystemSnapshot& snap) {
+    if (!stateMachine || !eventQueue) {
+        sendActionResult(503, action, "unavailable", "Система не готова");
+        return false;
+    }
+    stateMachine->readSnapshot(snap);
+    if (snap.version == 0) {
+        sendActionResult(503, action, "unavailable", "Система не готова");
+        return false;
+    }
+    return true;
+}
+
+void WebDashboard::sendActionResult(int code, const char* action, const char* error,
+                                    const char* message, float target, float emptyWeight) {
+    char buffer[ACTION_RESPONSE_SIZE];
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginObject();
+    json.field("success", error == nullptr);
+    json.field("action", action);
+    if (error) json.field("error", error);
+    json.field("message", message);
+    if (target >= 0) {
+        json.field("targetWeight", target, 1);
+        json.field("targetVolume", target - emptyWeight, 0);
+    }
+    json.endObject();
+    size_t length = json.finish();
+    
+    if (error) apiRejected++;
+    else apiCommands++;
+    
+    server.setContentLength(length);
+    server.send(code, "application/json", "");
+    server.sendContent(buffer, length);
+    
+    DPRINTF("📊 API %s: %d %s\n", action, code, error ? error : "ok");
+}
+
+const char* WebDashboard::argOrNull(const char* name, String& holder) {
+    if (!server.hasArg(name)) return nullptr;
+    holder = server.arg(name);
+    return holder.c_str();
 }
 
 void WebDashboard::handleAPIFill() {
-    // ... (тот же код, что и раньше) ...
+    SystemSnapshot snap;
+    if (!readCommandSnapshot("fill", snap)) return;
+    
+    // Разбор параметров и проверки - WebApi.h
+    String cups, full, ml;
+    ApiResult result = apiFill(argOrNull("cups", cups), argOrNull("full", full), argOrNull("ml", ml), snap,
+                               [this](float target) { return eventQueue->post(EVT_FILL, (int32_t)lroundf(target)); });
+    sendActionResult("fill", result, snap.emptyWeight);
 }
 
 void WebDashboard::handleAPIStop() {
-    // ... (тот же код, что и раньше) ...
+    SystemSnapshot snap;
+    if (!readCommandSnapshot("stop", snap)) return;
+    sendActionResult("stop", apiStop(snap, [this]() { return eventQueue->post(EVT_STOP); }));
 }
 
 void WebDashboard::handleAPICalibrate() {
-    // ... (тот же код, что и раньше) ...
+    SystemSnapshot snap;
+    if (!readCommandSnapshot("calibrate", snap)) return;
+    sendActionResult("calibrate", apiCalibrate(snap, [this]() { return eventQueue->post(EVT_CALIBRATE); }));
 }
 
 void WebDashboard::handleAPIReboot() {
-    // ... (тот же код, что и раньше) ...
+    // Перезагрузка из handle() после отправки ответа, а не внутри обработчика
+    if (rebootAt != 0) {
+        sendActionResult(202, "reboot", nullptr, "Перезагрузка уже запланирована");
+        return;
+    }
+    
+    // Идущий налив сначала останавливаем; если остановку не поставить в очередь,
+    // не перезагружаемся: помпа осталась бы включенной до самого сброса
+    SystemSnapshot snap;
+    if (stateMachine && eventQueue) {
+        stateMachine->readSnapshot(snap);
+        if (snap.state == ST_FILLING && !eventQueue->post(EVT_STOP)) {
+            sendActionResult(503, "reboot", "queue_full", "Система занята, повторите команду");
+            return;
+        }
+    }
+    
+    rebootAt = millis() + WEB_REBOOT_DELAY;
+    if (rebootAt == 0) rebootAt = 1;
+    sendActionResult(202, "reboot", nullptr, "Перезагрузка");
+    LOG_WARN("📊 Перезагрузка по запросу из веб-интерфейса");
+}
+
+void WebDashboard::handleAPIStatsReset() {
+    // Каждый планировщик сбрасывает свою статистику сам, в своей задаче
+    if (controlScheduler) controlScheduler->requestReset();
+    if (networkScheduler) networkScheduler->requestReset();
+    sendActionResult(200, "stats_reset", nullptr, "Статистика задач сброшена");
 }
 
 void WebDashboard::handleNotFound() {
@@ -314,6 +816,11 @@ void WebDashboard::sendJsonResponse(int code, const JsonDocument& doc) {
 
 void WebDashboard::handle() {
     server.handleClient();
+    pushEvents();
+    
+    if (rebootAt != 0 && (long)(millis() - rebootAt) >= 0) {
+        ESP.restart();
+    }
 }
 
 // Публичный метод для сброса пароля (вызывается при factory reset)
@@ -14,6 +14,12 @@
 #include "StateMachine.h"
 #include "WiFiManager.h"
 #include "MQTTManager.h"
+#include "EventQueue.h"
+#include "TaskScheduler.h"
+#include "JsonWriter.h"
+#include "WebAsset.h"
+#include "StatusETag.h"
+#include "WebApi.h"
 
 // Данные для входа по умолчанию
 #ifndef WEB_USERNAME
@@ -24,6 +30,59 @@
 #define WEB_PASSWORD "admin"      // Пароль по умолчанию (можно изменить через веб)
 #endif
 
+// ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
+#define SSE_MAX_CLIENTS 3              // Одновременных подписчиков /api/events
+#define SSE_BUFFER_SIZE 512            // Буфер отправки на клиента (байт)
+#define SSE_EVENT_MAX 384              // Максимальный размер одного события (байт)
+#define SSE_KEEPALIVE 15000            // Комментарий-пинг при отсутствии изменений (мс)
+#define STATUS_CHUNK_SIZE 512          // Буфер чанка ответа /api/status (байт, на стеке)
+#define STATUS_CACHE_SIZE 3072         // Кэш сериализованного /api/status (байт)
+#define ACTION_RESPONSE_SIZE 256       // Ответ команд /api/fill, /api/stop... (байт, на стеке)
+#define WEB_REBOOT_DELAY 500           // Задержка перезагрузки после ответа /api/reboot (мс)
+
+/**
+ * Поля дашборда, которые рассылаются через /api/events
+ * Значения округлены до точности отображения: шум в последних знаках
+ * не считается изменением и не рассылается
+ */
+struct SseFields {
+    float currentWeight;
+    float emptyWeight;
+    float waterVolume;
+    int cups;
+    uint8_t state;
+    uint8_t error;
+    bool kettlePresent;
+    bool calibrationDone;
+    bool mqttConnected;
+    int wifiSignal;
+    float calibrationFactor;
+    float flowRate;
+    float timeToTarget;
+    unsigned long mqttSent;
+    unsigned long mqttFailed;
+    uint32_t uptimeMinutes;
+    uint32_t freeHeapKb;
+};
+
+/**
+ * Подписчик /api/events (Server-Sent Events)
+ * - Соединение остается открытым после обработчика (храним копию WiFiClient)
+ * - Отправка неблокирующая: что не ушло в сокет, ждет в буфере клиента;
+ *   если событие не помещается в буфер, оно откладывается, а изменения
+ *   накапливаются в следующем событии (last хранит отправленное клиенту)
+ */
+struct SseClient {
+    WiFiClient client;
+    bool active;
+    bool needFull;                     // Следующее событие - все поля
+    SseFields last;                    // Что уже поставлено в буфер клиента
+    char buffer[SSE_BUFFER_SIZE];
+    size_t pending;                    // Байт в буфере, ожидающих отправки
+    unsigned long lastEventTime;
+    unsigned long deferred;            // Событий, отложенных из-за полного буфера
+};
+
 class WebDashboard {
 private:
     WebServer& server;
@@ -33,6 +92,9 @@ private:
     StateMachine* stateMachine;
     WiFiManager& wifiManager;
     MQTTManager* mqttManager;
+    EventQueue* eventQueue;
+    TaskScheduler* controlScheduler;   // Ядро 1: управление, дисплей, Serial
+    TaskScheduler* networkScheduler;   // Ядро 0: сеть
     
     // Аутентификация
     bool authEnabled;
@@ -40,6 +102,74 @@ private:
     String defaultPassword;  // Пароль по умолчанию (admin)
     String currentPassword;  // Текущий пароль (из EEPROM или default)
     
+    // Server-Sent Events
+    SseClient sseClients[SSE_MAX_CLIENTS];
+    unsigned long lastSsePush;
+    unsigned long sseEventsSent;
+    unsigned long sseRejected;         // Отказано: нет свободных слотов
+    uint32_t lastSsePushTime;          // Длительность последней рассылки (мкс)
+    uint32_t maxSsePushTime;
+    uint32_t lastStatusTime;           // Длительность последнего /api/status (мкс)
+    uint32_t maxStatusTime;
+    int32_t sseClientHeap;             // Куча, занятая последним подключением (байт)
+    size_t lastStatusSize;             // Размер последнего ответа /api/status (байт)
+    uint32_t networkStackFree;         // Минимальный запас стека сетевой задачи (байт)
+    
+    // Отправить заполненную часть буфера JsonWriter чанком ответа
+    static void sendChunk(void* context, const char* data, size_t length);
+    
+    // Кэш /api/status: пересобирается при смене ETag (отрисованных полей)
+    // или по возрасту - ради диагностики
+    char statusCache[STATUS_CACHE_SIZE];
+    size_t statusCacheLength;          // 0 - кэш пуст или документ не поместился
+    unsigned long statusCacheTime;
+    SystemSnapshot statusSnapshot;     // Снимок, из которого отрисованы поля (меняется с версией)
+    StatusETag statusETag;
+    unsigned long statusCacheHits;
+    unsigned long statusCacheMisses;
+    unsigned long statusNotModified;   // Ответов 304
+    
+    // Записать документ /api/status
+    void writeStatus(JsonWriter& json, const SystemSnapshot& snap);
+    
+    // Поля, которые показывает дашборд (по ним считается ETag), и их хеш
+    void writeStatusView(JsonWriter& json, const SystemSnapshot& snap);
+    uint32_t hashStatusView(const SystemSnapshot& snap);
+    
+    // Команды API: проверяются по снимку, выполняются автоматом через очередь событий
+    unsigned long rebootAt;            // Момент перезагрузки по /api/reboot (0 - не запрошена)
+    unsigned long apiCommands;         // Принято команд
+    unsigned long apiRejected;         // Отклонено команд
+    
+    /**
+     * Снимок для проверки команды
+     * @return false - автомат или очередь недоступны (ответ 503 уже отправлен)
+     */
+    bool readCommandSnapshot(const char* action, SystemSnapshot& snap);
+    
+    /**
+     * Отправить результат команды: {"success":..., "action":..., ...}
+     * @param error - код ошибки (nullptr - успех)
+     * @param target - цель налива (г), меньше 0 - не выводить
+     */
+    void sendActionResult(int code, const char* action, const char* error,
+                          const char* message, float target = -1.0f, float emptyWeight = 0);
+    void sendActionResult(const char* action, const ApiResult& result, float emptyWeight = 0) {
+        sendActionResult(result.code, action, result.error, result.message, result.target, emptyWeight);
+    }
+    
+    /**
+     * Значение параметра запроса (nullptr - параметра нет)
+     * @param holder - строка, которая держит значение до конца обработчика
+     */
+    const char* argOrNull(const char* name, String& holder);
+    
+    void readSseFields(SseFields& fields);
+    size_t buildSseEvent(const SseFields& current, const SseFields& last, bool full, char* out, size_t size);
+    void pushEvents();
+    bool flushSseClient(SseClient& sse);
+    void closeSseClient(SseClient& sse);
+    
     // Приватные методы
     bool checkAuth();
     void loadPasswordFromEEPROM();
@@ -52,10 +182,12 @@ private:
     void handleRoot();
     void handleChangePassword();
     void handleAPIStatus();
+    void handleAPIEvents();
     void handleAPIFill();
     void handleAPIStop();
     void handleAPICalibrate();
     void handleAPIReboot();
+    void handleAPIStatsReset();
     void handleNotFound();
     
     String getContentType(const String& path);
@@ -68,10 +200,29 @@ public:
                  StateMachine* sm, WiFiManager& wm, MQTTManager* mqm,
                  bool enableAuth = true);
     
+    // Очередь событий для команд из API (статистика и налив)
+    void setEventQueue(EventQueue* q) { eventQueue = q; }
+    
+    // Планировщики задач обоих ядер (статистика в /api/status)
+    void setSchedulers(TaskScheduler* control, TaskScheduler* network) {
+        controlScheduler = control;
+        networkScheduler = network;
+    }
+    
     // Публичные методы
     void begin();
     void handle();
     void resetPassword();  // Для вызова при полном сбросе
+    
+    // ==================== СТАТИСТИКА SSE ====================
+    uint8_t getSseClientCount();
+    unsigned long getSseEventsSent() { return sseEventsSent; }
+    unsigned long getSseRejected() { return sseRejected; }
+    uint32_t getLastSsePushTime() { return lastSsePushTime; }
+    uint32_t getMaxSsePushTime() { return maxSsePushTime; }
+    uint32_t getLastStatusTime() { return lastStatusTime; }
+    uint32_t getMaxStatusTime() { return maxStatusTime; }
+    int32_t getSseClientHeap() { return sseClientHeap; }
 };
 
 #endif
\ No newline at end of file
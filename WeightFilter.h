@@ -0,0 +1,225 @@
+// файл: WeightFilter.h
+// Конвейер фильтров веса, собираемый на этапе компиляции
+// Каждая ступень - обычный класс без виртуальных функций, вся цепочка инлайнится
+
+#ifndef WEIGHT_FILTER_H
+#define WEIGHT_FILTER_H
+
+#include <math.h>
+#include "SlidingMedian.h"
+
+/**
+ * Интерфейс ступени фильтра (без наследования):
+ *   bool apply(float& grams) - обработать отсчет; false - отсчет отброшен,
+ *                              дальше по цепочке он не идет
+ *   void reset()             - сбросить внутреннее состояние
+ *
+ * Параметры ступеней задаются целыми числами (граммы, доли),
+ * чтобы их можно было передать как аргументы шаблона.
+ */
+
+// ==================== ОГРАНИЧЕНИЕ СНИЗУ ====================
+
+/**
+ * Значения меньше MinGrams заменяются на MinGrams
+ * (отрицательный вес после тары - это шум датчика)
+ */
+template <int MinGrams = 0>
+class Clamp {
+public:
+    bool apply(float& grams) {
+        if (grams < MinGrams) grams = MinGrams;
+        return true;
+    }
+    void reset() {}
+};
+
+// ==================== ОТСЕЧЕНИЕ СКАЧКОВ ====================
+
+/**
+ * Отбрасывает отсчеты, отличающиеся от последнего принятого больше чем на MaxJumpGrams
+ * Если ConfirmSamples > 0, новый уровень принимается после стольких подряд
+ * отброшенных, но согласованных между собой отсчетов (чайник сняли/поставили)
+ */
+template <int MaxJumpGrams, int ConfirmSamples = 0>
+class JumpReject {
+private:
+    float last = 0;
+    float candidate = 0;
+    int candidateCount = 0;
+
+public:
+    bool apply(float& grams) {
+        if (last <= 0 || fabsf(grams - last) <= MaxJumpGrams) {
+            last = grams;
+            candidateCount = 0;
+            return true;
+        }
+
+        if (ConfirmSamples > 0) {
+            if (candidateCount == 0 || fabsf(grams - candidate) > MaxJumpGrams) {
+                candidate = grams;
+                candidateCount = 0;
+            }
+            if (++candidateCount >= ConfirmSamples) {
+                last = grams;
+                candidateCount = 0;
+                return true;
+            }
+        }
+        return false;
+    }
+    void reset() { last = 0; candidateCount = 0; }
+};
+
+// ==================== ФИЛЬТР ХАМПЕЛЯ ====================
+
+/**
+ * Отбрасывает выбросы относительно медианы окна из Window отсчетов:
+ * отсчет отбрасывается, если |x - медиана| > max(K * 1.4826 * MAD, MinGrams),
+ * где K = ThresholdX10 / 10, MAD - медиана абсолютных отклонений.
+ * Все отсчеты (и отброшенные) попадают в окно, поэтому устойчивое
+ * изменение уровня принимается примерно через Window/2 отсчетов.
+ */
+template <size_t Window, int ThresholdX10 = 30, int MinGrams = 5>
+class HampelReject {
+private:
+    SlidingMedian<float, Window> window;
+
+    // Медиана абсолютных отклонений: отклонения от медианы в отсортированном
+    // окне растут в обе стороны от центра, поэтому сливаем две половины
+    float mad(float med) const {
+        const float* v = window.sortedValues();
+        size_t n = window.size();
+        size_t k = n / 2;
+        int left = (int)(n / 2) - 1;
+        size_t right = n / 2;
+        float dev = 0;
+        for (size_t i = 0; i <= k; i++) {
+            float dl = left >= 0 ? med - v[left] : INFINITY;
+            float dr = right < n ? v[right] - med : INFINITY;
+            if (dl < dr) { dev = dl; left--; }
+            else { dev = dr; right++; }
+        }
+        return dev;
+    }
+
+public:
+    bool apply(float& grams) {
+        bool accept = true;
+        if (window.isFull()) {
+            float med = window.median();
+            float limit = (ThresholdX10 / 10.0f) * 1.4826f * mad(med);
+            if (limit < MinGrams) limit = MinGrams;
+            accept = fabsf(grams - med) <= limit;
+        }
+        window.push(grams);
+        return accept;
+    }
+    void reset() { window.reset(); }
+};
+
+// ==================== МЕДИАНА ====================
+
+/**
+ * Скользящая медиана по Window отсчетам
+ */
+template <size_t Window>
+class Median {
+private:
+    SlidingMedian<float, Window> window;
+
+public:
+    bool apply(float& grams) {
+        grams = window.push(grams);
+        return true;
+    }
+    void reset() { window.reset(); }
+};
+
+// ==================== ЭКСПОНЕНЦИАЛЬНОЕ СГЛАЖИВАНИЕ ====================
+
+/**
+ * БИХ-фильтр первого порядка: y += alpha * (x - y), alpha = AlphaPermille / 1000
+ */
+template <int AlphaPermille>
+class IIR {
+    static_assert(AlphaPermille > 0 && AlphaPermille <= 1000, "AlphaPermille должен быть в диапазоне 1..1000");
+
+private:
+    float state = 0;
+    bool initialized = false;
+
+public:
+    bool apply(float& grams) {
+        if (!initialized) {
+            state = grams;
+            initialized = true;
+        } else {
+            state += (AlphaPermille / 1000.0f) * (grams - state);
+        }
+        grams = state;
+        return true;
+    }
+    void reset() { initialized = false; }
+};
+
+// ==================== ЗОНА НЕЧУВСТВИТЕЛЬНОСТИ ====================
+
+/**
+ * Выход меняется только при отклонении больше BandCentigrams / 100 грамм
+ * (убирает дрожание последней цифры на дисплее и в MQTT)
+ */
+template <int BandCentigrams>
+class Deadband {
+private:
+    float held = 0;
+    bool initialized = false;
+
+public:
+    bool apply(float& grams) {
+        if (!initialized || fabsf(grams - held) >= BandCentigrams / 100.0f) {
+            held = grams;
+            initialized = true;
+        }
+        grams = held;
+        return true;
+    }
+    void reset() { initialized = false; }
+};
+
+// ==================== ЦЕПОЧКА ФИЛЬТРОВ ====================
+
+/**
+ * Цепочка ступеней, применяемых по порядку:
+ *   FilterChain<Clamp<>, JumpReject<500>, Median<5>> filter;
+ *   if (filter.apply(grams)) { ... }
+ * Отсчет, отброшенный ступенью, в следующие ступени не передается.
+ */
+template <typename... Stages>
+class FilterChain;
+
+template <>
+class FilterChain<> {
+public:
+    bool apply(float&) { return true; }
+    void reset() {}
+};
+
+template <typename Head, typename... Tail>
+class FilterChain<Head, Tail...> {
+private:
+    Head head;
+    FilterChain<Tail...> tail;
+
+public:
+    bool apply(float& grams) {
+        return head.apply(grams) && tail.apply(grams);
+    }
+    void reset() {
+        head.reset();
+        tail.reset();
+    }
+};
+
+#endif
@@ -204,6 +204,9 @@ void WiFiManager::startAPMode() {
     server.on("/scan", std::bind(&WiFiManager::handleScan, this));      // Обработчик сканирования
     server.onNotFound(std::bind(&WiFiManager::handleFileRequest, this)); // Все остальные запросы
     
+    static const char* headerKeys[] = { "If-None-Match" };  // Нужен для ответов 304 на страницы
+    server.collectHeaders(headerKeys, 1);
+    
     server.begin();  // Запускаем сервер
     
     currentState = WIFI_STATE_AP;      // Переходим в состояние AP
@@ -243,34 +246,36 @@ void WiFiManager::startConfigPortal() {
 
 // ==================== HTTP ОБРАБОТЧИКИ ====================
 
+/**
+ * Отправка встроенной в прошивку страницы (см. WebAsset.h)
+ * @param path - путь страницы ("/index.html")
+ * @return false - такой страницы нет, ответ не отправлен
+ */
+bool WiFiManager::sendPage(const char* path) {
+    const WebAsset* page = findWebAsset(path);  // Ищем страницу среди встроенных
+    if (!page) return false;                     // Нет такой страницы
+    sendWebAsset(server, *page);                 // Отправляем сжатую страницу из флеша
+    return true;
+}
+
 /**
  * Обработчик корневой страницы "/"
- * Отправляет клиенту файл index.html из SPIFFS
+ * Отправляет клиенту страницу index.html
  */
 void WiFiManager::handleRoot() {
-    // Открываем файл index.html в режиме чтения
-    File file = SPIFFS.open("/index.html", "r");
-    if (!file) {  // Если файл не открылся
+    if (!sendPage("/index.html")) {  // Если страница не найдена
         server.send(500, "text/plain", "File not found");  // Ошибка сервера
-        return;
     }
-    // Отправляем файл клиенту с типом text/html
-    server.streamFile(file, "text/html");
-    file.close();  // Закрываем файл
 }
 
 /**
  * Обработчик страницы конфигурации "/config"
- * Отправляет клиенту файл config.html из SPIFFS
+ * Отправляет клиенту страницу config.html
  */
 void WiFiManager::handleConfig() {
-    File file = SPIFFS.open("/config.html", "r");
-    if (!file) {
+    if (!sendPage("/config.html")) {
         server.send(500, "text/plain", "File not found");
-        return;
     }
-    server.streamFile(file, "text/html");
-    file.close();
 }
 
 /**
@@ -290,11 +295,7 @@ void WiFiManager::handleSave() {
             newMqttUser.length() == 0 || newMqttPass.length() == 0) {
             
             // Отправляем страницу с ошибкой
-                File file = SPIFFS.open("/success.html", "r");
-                if (file) {
-                    server.streamFile(file, "text/html");
-                    file.close();
-                } else {
+                if (!sendPage("/success.html")) {
                     server.send(200, "text/html", 
                         "<html><body><h1>Configuration Saved!</h1>"
                         "<p>Device will restart...</p></body></html>");
@@ -325,12 +326,8 @@ void WiFiManager::handleSave() {
             Serial.printf("MQTT User: %s\n", newMqttUser.c_str());  // Отладочный вывод
         }
         
-        // Отправляем страницу успеха из файла
-        File file = SPIFFS.open("/success.html", "r");
-        if (file) {
-            server.streamFile(file, "text/html");
-            file.close();
-        } else {
+        // Отправляем страницу успеха
+        if (!sendPage("/success.html")) {
             // Запасной вариант, если файл не найден
             server.send(200, "text/html", 
                        "<html><body><h1>Configuration Saved!</h1>"
@@ -380,8 +377,8 @@ void WiFiManager::handleScan() {
 }
 
 /**
- * Обработчик запросов файлов из SPIFFS
- * Отправляет запрошенный файл или перенаправляет на корень
+ * Обработчик запросов файлов
+ * Отправляет встроенный файл или перенаправляет на корень
  */
 void WiFiManager::handleFileRequest() {
     String path = server.uri();  // Получаем запрошенный путь
@@ -391,40 +388,12 @@ void WiFiManager::handleFileRequest() {
         path = "/index.html";
     }
     
-    // Проверяем существование файла в SPIFFS
-    if (!SPIFFS.exists(path)) {
+    // Ищем файл среди встроенных в прошивку
+    if (!sendPage(path.c_str())) {
         // Если файл не найден, перенаправляем на корень (для captive portal)
         server.sendHeader("Location", "http://192.168.4.1", true);  // HTTP редирект
         server.send(302, "text/plain", "");  // Код 302 - временное перенаправление
-        return;
     }
-    
-    // Открываем файл
-    File file = SPIFFS.open(path, "r");
-    if (!file) {
-        server.send(500, "text/plain", "Failed to open file");  // Ошибка открытия
-        return;
-    }
-    
-    // Определяем MIME-тип по расширению
-    String contentType = getContentType(path);
-    server.streamFile(file, contentType);  // Отправляем файл
-    file.close();  // Закрываем файл
-}
-
-/**
- * Определение MIME-типа файла по его расширению
- * @param filename - имя файла
- * @return MIME-тип как строка
- */
-String WiFiManager::getContentType(String filename) {
-    if (filename.endsWith(".html")) return "text/html";          // HTML файлы
-    else if (filename.endsWith(".css")) return "text/css";       // CSS файлы
-    else if (filename.endsWith(".js")) return "application/javascript";  // JavaScript
-    else if (filename.endsWith(".png")) return "image/png";      // PNG изображения
-    else if (filename.endsWith(".jpg")) return "image/jpeg";     // JPG изображения
-    else if (filename.endsWith(".ico")) return "image/x-icon";   // Иконки
-    return "text/plain";  // По умолчанию
 }
 
 /**
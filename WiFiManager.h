@@ -10,6 +10,7 @@
 #include <Preferences.h>  // Подключаем библиотеку для хранения данных в энергонезависимой памяти
 #include <DNSServer.h>    // Подключаем библиотеку для DNS сервера (нужен для captive portal)
 #include <SPIFFS.h>       // Подключаем библиотеку для работы с файловой системой SPIFFS
+#include "WebAsset.h"       // Встроенные в прошивку веб-страницы
 
 // Режимы работы WiFi (состояния WiFi менеджера)
 enum WiFiState {
@@ -64,12 +65,12 @@ private:
     void handleSave();          // Обработчик сохранения данных из формы
     void handleScan();          // Обработчик сканирования WiFi сетей
     void handleNotFound();      // Обработчик 404 (не найдено)
-    void handleFileRequest();   // Обработчик запросов файлов из SPIFFS
+    void handleFileRequest();   // Обработчик запросов встроенных файлов
     
     // ==================== ВНУТРЕННИЕ МЕТОДЫ ====================
     void startAPMode();         // Запуск режима точки доступа
     void stopAPMode();          // Остановка режима точки доступа
-    String getContentType(String filename);  // Определение MIME-типа по расширению файла
+    bool sendPage(const char* path);  // Отправка встроенной страницы (false - не найдена)
     
 public:
     // ==================== КОНСТРУКТОР ====================
@@ -91,7 +92,7 @@ public:
     // ==================== СТАТУС ====================
     bool isConnected() { return currentState == WIFI_STATE_CONNECTED; }    // Подключены ли к WiFi?
     bool isConfigured() { return configured; }                              // Есть ли сохраненные настройки?
-    String getSSID() { return ssid; }                                       // Имя текущей WiFi сети
+    const String& getSSID() { return ssid; }                                  // Имя текущей WiFi сети
     int getRSSI() { return WiFi.RSSI(); }                                   // Уровень сигнала
     WiFiState getState() { return currentState; }                           // Текущее состояние
     IPAddress getAPIP() { return WiFi.softAPIP(); }                         // IP адрес в режиме AP
@@ -25,6 +25,15 @@
 #define FULL_WATER_LEVEL 1700.0f
 #define EMPTY_KETTLE_OFFSET 0.0f
 
+// Уровень воды в MQTT (0 - пусто, 1 - низкий, 2 - нормальный)
+#define WATER_LEVEL_EMPTY 500
+#define WATER_LEVEL_LOW 1000
+#define WATER_LEVEL_HYSTERESIS 25      // Полоса гистерезиса вокруг порогов (мл)
+#define WATER_LEVEL_DWELL 2000         // Новый уровень должен продержаться столько (мс)
+
+// Цепочка фильтров веса для конкретного чайника/датчика (по умолчанию см. Scale.h)
+// #define SCALE_FILTER_CHAIN FilterChain<Clamp<>, HampelReject<9>, Median<15>, IIR<200>, Deadband<50>>
+
 // ==================== ВРЕМЕННЫЕ КОНСТАНТЫ ====================
 #define DEBOUNCE_TIME 50
 #define LONG_PRESS_TIME 3000
@@ -35,11 +44,39 @@
 #define POWER_RELAY_COOLDOWN 2000
 #define SERVO_MOVE_TIME 1000
 #define BUZZER_FEEDBACK 100
-#define LOOP_DELAY 100
+#define BUTTON_ACTIVE_WINDOW (DOUBLE_CLICK_TIME + 4 * DEBOUNCE_TIME) // Частый опрос кнопки после фронта
+
+// ==================== ДЕТЕКТОР ПОТОКА (FlowMonitor) ====================
+// Срабатывает раньше NO_FLOW_TIMEOUT, но не раньше PRIME + CONFIRM = 4 с:
+// сухой трубке нужно 2-3 с, чтобы вода дошла до носика, а окну
+// FlowEstimator (1.5 с) - время увидеть поток. NO_FLOW_TIMEOUT остается
+// запасной проверкой по весу
+#define NO_FLOW_PRIME_TIME 3000        // Заполнение трубки и окно оценки после включения помпы (мс)
+#define NO_FLOW_CONFIRM_TIME 1000      // Сколько признак должен держаться до срабатывания (мс)
+#define NO_FLOW_MIN_RATE 2.0f          // Поток ниже этого считается отсутствующим (г/с)
+#define NO_FLOW_CONFIDENCE 3.0f        // Запас в СКО оценки скорости (уверенность ~99.9%)
+#define FLOW_ESTABLISHED_RATE 5.0f     // Поток выше этого считается установившимся (г/с)
+#define DRY_FLOW_RATIO 0.3f            // Падение потока ниже этой доли пика - бак пустеет
+#define DRY_CONFIRM_TIME 1500          // Сколько должно держаться падение потока (мс)
+
+// ==================== ПЕРИОДЫ ЗАДАЧ ОСНОВНОГО ЦИКЛА (мс) ====================
+#define CONTROL_TASK_PERIOD 20     // Кнопка, помпа, конечный автомат (50 Гц)
+#define NETWORK_TASK_PERIOD 10     // OTA, веб-сервер, Wi-Fi, MQTT
+#define NETWORK_TASK_DEADLINE 50   // Сетевой задаче допустимо задержаться (мс)
+#define PUBLISH_TASK_PERIOD 100    // Публикация изменений в MQTT
+#define SERIAL_TASK_PERIOD 50      // Команды из Serial
+#define DISPLAY_TASK_PERIOD 200    // Дисплей (5 Гц)
+#define STATUS_TASK_PERIOD 1000    // Индикатор Wi-Fi на дисплее
+
+// ==================== СЕТЕВАЯ ЗАДАЧА FREERTOS ====================
+#define NETWORK_TASK_STACK 8192    // Стек сетевой задачи (байт)
+#define NETWORK_TASK_PRIORITY 1    // Приоритет (как у loop())
+#define NETWORK_TASK_CORE 0        // Ядро стека Wi-Fi; loop() и управление - на ядре 1
 
 // ==================== ПАМЯТЬ ====================
 #define EEPROM_SIZE 512
 #define EEPROM_CALIB_ADDR 0
+#define EEPROM_OVERSHOOT_ADDR 100
 #define EEPROM_WEB_PASS_ADDR 200
 
 // ==================== СБРОС ====================
@@ -47,10 +84,22 @@
 #define RESET_FULL_TIME 15000
 
 // ==================== MQTT НАСТРОЙКИ ====================
-#define MQTT_RECONNECT_INTERVAL 5000
-#define MQTT_PUBLISH_INTERVAL 2000
+// Для нагрузочных испытаний несколько помп можно направить на локальный брокер
+#define MQTT_SERVER "mqtt.dealgate.ru"
+#define MQTT_PORT 1883
+#define MQTT_PUBLISH_INTERVAL 2000         // Обновление состояний и телеметрия в покое
+#define MQTT_TELEMETRY_FAST_INTERVAL 200   // Телеметрия во время налива (5 Гц)
+#define MQTT_TOPIC_ROOT "/devices"     // Корень топиков: <корень>/<имя устройства>/<топик>
+#define MQTT_CLIENT_PREFIX "smartpump" // Client ID: <префикс>-<MAC>
+// Имя устройства в топиках, по умолчанию "pump" (/devices/pump/...)
+// #define MQTT_DEVICE_NAME "kitchen"
+// Несколько помп на одном брокере: добавить MAC к имени (/devices/pump-<MAC>/...)
+// #define MQTT_DEVICE_NAME_PER_MAC
 
 // ==================== ВЕБ-ИНТЕРФЕЙС ====================
+#define SSE_PUSH_INTERVAL 250       // Рассылка изменений подписчикам /api/events (мс)
+#define STATUS_CACHE_MAX_AGE 5000   // Максимальный возраст кэша /api/status без изменений снимка (мс)
+#define STATUS_ETAG_MAX_AGE 60000   // ETag /api/status без изменений полей живет не дольше (мс)
 #define WEB_USERNAME "myadmin"      // Ваш логин
 #define WEB_PASSWORD "StrongPass123"  // Ваш пароль
 
@@ -72,7 +121,8 @@ enum ErrorType {
     ERR_NONE,
     ERR_HX711_TIMEOUT,
     ERR_NO_FLOW,
-    ERR_FILL_TIMEOUT
+    ERR_FILL_TIMEOUT,
+    ERR_RESERVOIR_EMPTY
 };
 
 enum ServoState {
@@ -2,70 +2,137 @@
 let connected = true;
 let reconnectAttempts = 0;
 
+// Последнее известное состояние: события /api/events несут только изменившиеся поля
+const status = {};
+let eventSource = null;
+let pollTimer = null;
+let statusETag = null;  // Версия документа /api/status, уже полученная клиентом
+
+// Расшифровка кодов ошибок (поле error в /api/status и /api/events)
+const ERROR_TEXT = {
+    hx711_timeout: 'датчик веса',
+    no_flow: 'нет воды',
+    fill_timeout: 'таймаут налива',
+    reservoir_empty: 'бак пуст'
+};
+
 // Загрузка данных при открытии страницы
 document.addEventListener('DOMContentLoaded', function() {
-    updateStatus();
-    setInterval(updateStatus, 1000); // Обновление каждую секунду
+    if (window.EventSource) {
+        startEventStream();
+    } else {
+        startPolling();
+    }
 });
 
+// Поток изменений с сервера (Server-Sent Events)
+function startEventStream() {
+    eventSource = new EventSource('/api/events');
+    
+    eventSource.onmessage = function(event) {
+        Object.assign(status, JSON.parse(event.data));
+        connected = true;
+        reconnectAttempts = 0;
+        updateConnectionStatus(true);
+        updateUI(status);
+    };
+    
+    eventSource.onerror = function() {
+        connected = false;
+        updateConnectionStatus(false);
+        
+        // Браузер переподключается сам; если сервер отказал (нет мест) - опрашиваем
+        if (eventSource.readyState === EventSource.CLOSED) {
+            eventSource = null;
+            startPolling();
+        }
+    };
+}
+
+// Запасной вариант: опрос /api/status раз в секунду
+function startPolling() {
+    if (pollTimer) return;
+    updateStatus();
+    pollTimer = setInterval(updateStatus, 1000);
+}
+
 // Функция обновления статуса
+// Кэш браузера не используем: версию документа отправляем сами, и на 304
+// (ничего не изменилось) оставляем уже показанное состояние
 function updateStatus() {
-    fetch('/api/status')
+    const headers = statusETag ? { 'If-None-Match': statusETag } : {};
+    fetch('/api/status', { headers: headers, cache: 'no-store' })
         .then(response => {
+            if (response.status === 304) return null;
             if (!response.ok) throw new Error('Network error');
+            statusETag = response.headers.get('ETag');
             return response.json();
         })
         .then(data => {
             connected = true;
             reconnectAttempts = 0;
             updateConnectionStatus(true);
-            updateUI(data);
+            if (data) {
+                Object.assign(status, data);
+                updateUI(status);
+            }
         })
         .catch(error => {
             console.error('Error:', error);
             connected = false;
             reconnectAttempts++;
             updateConnectionStatus(false);
-            
-            // Пытаемся переподключиться
-            if (reconnectAttempts < 10) {
-                setTimeout(updateStatus, 2000);
-            }
         });
 }
 
+// Установить текст элемента, если он есть на странице и значение известно
+function setText(id, value) {
+    const el = document.getElementById(id);
+    if (el && value !== undefined && value !== null) el.textContent = value;
+}
+
 // Обновление UI с полученными данными
 function updateUI(data) {
     // Основная информация
-    document.getElementById('currentWeight').textContent = data.currentWeight + ' г';
-    document.getElementById('emptyWeight').textContent = data.emptyWeight + ' г';
-    document.getElementById('waterVolume').textContent = data.waterVolume + ' мл';
-    document.getElementById('cups').textContent = data.cups;
+    if (data.currentWeight !== undefined) setText('currentWeight', data.currentWeight + ' г');
+    if (data.emptyWeight !== undefined) setText('emptyWeight', data.emptyWeight + ' г');
+    if (data.waterVolume !== undefined) setText('waterVolume', data.waterVolume + ' мл');
+    setText('cups', data.cups);
     
     // Прогресс-бар
-    const percentage = (data.waterVolume / data.maxVolume) * 100;
-    document.getElementById('progressBar').style.width = percentage + '%';
+    const progressBar = document.getElementById('progressBar');
+    if (progressBar && data.waterVolume !== undefined && data.maxVolume) {
+        const percentage = Math.min(100, Math.max(0, (data.waterVolume / data.maxVolume) * 100));
+        progressBar.style.width = percentage + '%';
+    }
     
     // Состояние системы
-    document.getElementById('systemState').textContent = data.systemState;
-    document.getElementById('kettlePresent').textContent = data.kettlePresent ? '✅ Есть' : '❌ Нет';
-    document.getElementById('wifiSignal').textContent = data.wifiSignal + ' dBm';
-    document.getElementById('mqttStatus').textContent = data.mqttConnected ? '✅ Подключен' : '❌ Отключен';
+    if (data.systemState !== undefined) {
+        const error = data.error && data.error !== 'none' ? (ERROR_TEXT[data.error] || data.error) : null;
+        setText('systemState', error ? data.systemState + ' (' + error + ')' : data.systemState);
+    }
+    if (data.kettlePresent !== undefined) setText('kettlePresent', data.kettlePresent ? '✅ Есть' : '❌ Нет');
+    if (data.wifiSignal !== undefined) {
+        setText('wifiSignal', data.wifiSignal + ' dBm');
+        setText('wifiStatus', data.wifiSignal + ' dBm');
+    }
+    if (data.mqttConnected !== undefined) setText('mqttStatus', data.mqttConnected ? '✅ Подключен' : '❌ Отключен');
     
     // Калибровка
-    document.getElementById('calibrationFactor').textContent = data.calibrationFactor.toFixed(6);
-    document.getElementById('calibrationStatus').textContent = data.calibrationDone ? '✅ Готова' : '❌ Не выполнена';
+    if (data.calibrationFactor !== undefined) setText('calibrationFactor', data.calibrationFactor.toFixed(6));
+    if (data.calibrationDone !== undefined) setText('calibrationStatus', data.calibrationDone ? '✅ Готова' : '❌ Не выполнена');
     
     // Статистика
-    document.getElementById('mqttSent').textContent = data.mqttSent;
-    document.getElementById('mqttFailed').textContent = data.mqttFailed;
-    document.getElementById('uptime').textContent = formatUptime(data.uptime);
-    document.getElementById('freeHeap').textContent = formatBytes(data.freeHeap);
+    setText('mqttSent', data.mqttSent);
+    setText('mqttFailed', data.mqttFailed);
+    if (data.uptime !== undefined) setText('uptime', formatUptime(data.uptime));
+    if (data.freeHeap !== undefined) setText('freeHeap', formatBytes(data.freeHeap));
 }
 
 // Обновление статуса соединения
 function updateConnectionStatus(isConnected) {
     const statusEl = document.getElementById('connectionStatus');
+    if (!statusEl) return;
     if (isConnected) {
         statusEl.className = 'connection-status online';
         statusEl.textContent = '🟢 WiFi подключен';
@@ -91,55 +158,44 @@ function formatBytes(bytes) {
 }
 
 // Команды управления
-function fillCups(count) {
-    fetch('/api/fill?cups=' + count, { method: 'POST' })
-        .then(response => {
-            if (response.ok) {
-                showNotification('Налив ' + count + ' кружки(ек) запущен');
-            }
+// Сервер отвечает сразу (JSON с success и message), ход налива виден в статусе
+function sendCommand(url) {
+    return fetch(url, { method: 'POST' })
+        .then(response => response.json())
+        .then(data => {
+            showNotification(data.message || (data.success ? 'Готово' : 'Ошибка'));
+            return data;
+        })
+        .catch(error => {
+            console.error('Error:', error);
+            showNotification('Нет связи с устройством');
         });
 }
 
+function fillCups(count) {
+    sendCommand('/api/fill?cups=' + count);
+}
+
 function fillFull() {
-    fetch('/api/fill?full=1', { method: 'POST' })
-        .then(response => {
-            if (response.ok) {
-                showNotification('Налив полного чайника запущен');
-            }
-        });
+    sendCommand('/api/fill?full=1');
 }
 
 function fillCustom() {
-    const ml = document.getElementById('customML').value;
-    if (ml && ml > 0 && ml <= 1700) {
-        fetch('/api/fill?ml=' + ml, { method: 'POST' })
-            .then(response => {
-                if (response.ok) {
-                    showNotification('Налив ' + ml + ' мл запущен');
-                }
-            });
+    const ml = Number(document.getElementById('customML').value);
+    if (ml >= 50 && ml <= 1700) {
+        sendCommand('/api/fill?ml=' + Math.round(ml));
     } else {
         alert('Введите корректный объем от 50 до 1700 мл');
     }
 }
 
 function stopFill() {
-    fetch('/api/stop', { method: 'POST' })
-        .then(response => {
-            if (response.ok) {
-                showNotification('Налив остановлен');
-            }
-        });
+    sendCommand('/api/stop');
 }
 
 function startCalibration() {
     if (confirm('Запустить калибровку пустого чайника?')) {
-        fetch('/api/calibrate', { method: 'POST' })
-            .then(response => {
-                if (response.ok) {
-                    showNotification('Калибровка запущена');
-                }
-            });
+        sendCommand('/api/calibrate');
     }
 }
 
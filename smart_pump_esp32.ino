@@ -12,8 +12,11 @@
 #include "SerialCommandHandler.h"
 #include "esp_task_wdt.h"
 #include "WebDashboard.h"
+#include "EventQueue.h"
+#include "TaskScheduler.h"
 #include <EEPROM.h>
 #include <ArduinoOTA.h>
+#include <atomic>
 
 // ==================== ГЛОБАЛЬНЫЕ ОБЪЕКТЫ ====================
 Button button(PIN_BUTTON);
@@ -26,6 +29,11 @@ MQTTManager* mqttManager = nullptr;
 SerialCommandHandler* cmdHandler = nullptr;
 WebServer webServer(80);
 WebDashboard* webDashboard = nullptr;
+EventQueue eventQueue;
+EventQueue networkEvents;         // Сброс Wi-Fi и портал настройки (выполняет сетевая задача)
+TaskScheduler scheduler;          // Управление, дисплей, Serial (ядро 1, loop())
+TaskScheduler networkScheduler;   // Сеть (ядро 0, отдельная задача)
+TaskHandle_t networkTaskHandle = nullptr;
 
 // ==================== ГЛОБАЛЬНЫЕ ПЕРЕМЕННЫЕ ====================
 unsigned long pressStartTime = 0;
@@ -33,38 +41,99 @@ bool countdownActive = false;
 int lastDisplayedSeconds = -1;
 bool wifiResetPhase = false;
 
-unsigned long lastLoopTime = 0;
-const unsigned long LOOP_INTERVAL = LOOP_DELAY;
+// Состояние OTA для дисплея: сетевая задача пишет, задача дисплея рисует
+const int OTA_INACTIVE = -2;      // Обновления нет
+const int OTA_STARTED = -1;       // Начальный экран OTA
+const int OTA_COMPLETE = 101;     // Обновление завершено
+std::atomic<int> otaProgress(OTA_INACTIVE);
+
+// Фронт на кнопке: событие уже в очереди, повторно не кладем
+volatile bool buttonEdgePending = false;
+// До этого момента кнопка опрашивается на каждом проходе цикла
+unsigned long buttonActiveUntil = 0;
 
 // ==================== ПРОТОТИПЫ ФУНКЦИЙ ====================
 void onButtonHoldReleased(unsigned long holdDuration);
 void onMultiClick(int clickCount);
-String generateDeviceId();
 void onWiFiEvent(WiFiState state);
-void onMqttCommand(int mode);
+bool onMqttCommand(int mode, uint16_t tag);
 void publishMqttUpdates();
+void IRAM_ATTR onButtonEdge();
+void processEvent(const SystemEvent& evt);
+void processNetworkEvent(const SystemEvent& evt);
+void pollButton();
+void controlTask();
+void networkTask();
+void publishTask();
+void statusTask();
+void serialTask();
+void displayTask();
+void networkTaskLoop(void* param);
 
 // ==================== ВСПОМОГАТЕЛЬНЫЕ ФУНКЦИИ ====================
-String generateDeviceId() {
-    uint64_t chipid = ESP.getEfuseMac();
-    char deviceId[24] = {0};
-    snprintf(deviceId, sizeof(deviceId), "smartpump-%08X", (uint32_t)chipid);
-    return String(deviceId);
+void onWiFiEvent(WiFiState state) {
+    // Вызывается из сетевой задачи: индикатор обновит statusTask на ядре управления
+    Serial.printf("WiFi: состояние %d\n", state);
 }
 
-void onWiFiEvent(WiFiState state) {
-    display.setWiFiStatus(wifiManager.isConfigured(), wifiManager.isConnected());
+bool onMqttCommand(int mode, uint16_t tag) {
+    // Команда выполняется в основном цикле, который сразу проснется
+    if (!eventQueue.post(EVT_MQTT_COMMAND, MQTT_COMMAND_ARG(mode, tag))) {
+        Serial.println("⚠️ Очередь событий переполнена, MQTT команда потеряна");
+        return false;
+    }
+    return true;
+}
+
+void IRAM_ATTR onButtonEdge() {
+    if (buttonEdgePending) return;
+    buttonEdgePending = true;
+    eventQueue.postFromISR(EVT_BUTTON_EDGE);
+}
+
+void pollButton() {
+    if (otaProgress.load() != OTA_INACTIVE) return;
+    button.tick();
+    if (stateMachine) stateMachine->handleButton(button);
 }
 
-void onMqttCommand(int mode) {
-    if (stateMachine) stateMachine->handleMqttCommand(mode);
+void processEvent(const SystemEvent& evt) {
+    // Во время OTA команды не принимаем: помпа выключена до перезагрузки
+    if (otaProgress.load() != OTA_INACTIVE && evt.type != EVT_OTA_START) return;
+    
+    if (evt.type == EVT_BUTTON_EDGE) {
+        // Антидребезг и распознавание кликов остаются в Button -
+        // фронт только включает частый опрос на время нажатия
+        buttonEdgePending = false;
+        buttonActiveUntil = millis() + BUTTON_ACTIVE_WINDOW;
+        pollButton();
+        return;
+    }
+    
+    if (stateMachine) stateMachine->handleEvent(evt);
+}
+
+void processNetworkEvent(const SystemEvent& evt) {
+    switch (evt.type) {
+        case EVT_WIFI_RESET:
+            if (evt.arg && webDashboard) webDashboard->resetPassword();
+            wifiManager.resetSettings();
+            break;
+        case EVT_CONFIG_PORTAL:
+            wifiManager.startConfigPortal();
+            break;
+        default:
+            break;
+    }
 }
 
 void onButtonHoldReleased(unsigned long holdDuration) {
     if (holdDuration >= RESET_FULL_TIME) {
-        // ПОЛНЫЙ СБРОС - сбрасывает пароль!
-        if (webDashboard) webDashboard->resetPassword();
-        wifiManager.resetSettings();
+        // ПОЛНЫЙ СБРОС - сбрасывает пароль! Выполняет сетевая задача:
+        // Wi-Fi и веб-интерфейс принадлежат ядру 0
+        if (!networkEvents.post(EVT_WIFI_RESET, 1)) {
+            Serial.println("⚠️ Очередь сетевой задачи переполнена, сброс не выполнен");
+        }
     }
     else if (holdDuration >= RESET_CALIB_TIME) {
         // СБРОС КАЛИБРОВКИ
@@ -77,9 +146,12 @@ void onMultiClick(int clickCount) {
 }
 
 void publishMqttUpdates() {
-    if (!mqttManager || !mqttManager->isConnected() || !wifiManager.isConnected()) return;
+    // Без связи изменения не теряются: MQTTManager кладет их в очередь во флеше
+    if (!mqttManager) return;
     mqttManager->publishWaterState();
     mqttManager->publishKettleState();
+    mqttManager->publishTelemetry();
+    mqttManager->processCommandResults();
 }
 
 // ==================== ИНИЦИАЛИЗАЦИЯ ====================
@@ -92,6 +164,8 @@ void setup() {
     Serial.println("============================================\n");
     
     EEPROM.begin(EEPROM_SIZE);
+    eventQueue.begin();
+    networkEvents.begin();
 
     display.begin();
     display.setWiFiStatus(false, false);
@@ -112,12 +186,14 @@ void setup() {
     // Инициализация кнопки
     button.setHoldCallback(onButtonHoldReleased);
     button.setMultiClickCallback(onMultiClick);
+    attachInterrupt(digitalPinToInterrupt(PIN_BUTTON), onButtonEdge, CHANGE);
 
     pump.begin();
     pump.beepShortNonBlocking(1);
 
     // Создание StateMachine
     stateMachine = new StateMachine(scale, pump, display);
+    stateMachine->getOvershootModel().loadFromEEPROM(EEPROM_OVERSHOOT_ADDR);
 
     // Установка начального состояния
     if (!scaleInitSuccess) {
@@ -134,7 +210,6 @@ void setup() {
     }
 
     // Инициализация MQTT
-    String deviceId = generateDeviceId();
     mqttManager = new MQTTManager(scale, *stateMachine, wifiManager);
     mqttManager->begin();
     mqttManager->setCommandCallback(onMqttCommand);
@@ -149,21 +224,27 @@ void setup() {
     // webDashboard = new WebDashboard(webServer, scale, pump, display, 
     //                                 stateMachine, wifiManager, mqttManager,
     //                                 false);
+    webDashboard->setEventQueue(&eventQueue);
+    webDashboard->setSchedulers(&scheduler, &networkScheduler);
     webDashboard->begin();
 
     // ===== ИНИЦИАЛИЗАЦИЯ ОБРАБОТЧИКА КОМАНД =====
     cmdHandler = new SerialCommandHandler(scale, pump, display, stateMachine, 
                                           wifiManager, mqttManager);
+    cmdHandler->setEventQueue(&eventQueue);
+    cmdHandler->setNetworkQueue(&networkEvents);
+    cmdHandler->setSchedulers(&scheduler, &networkScheduler);
 
     // ===== НАСТРОЙКА OTA =====
     ArduinoOTA.setHostname("smartpump");
     ArduinoOTA.setPassword("smartpump123");
     
+    // Колбэки OTA выполняются в сетевой задаче (ядро 0): помпу выключает
+    // задача управления по событию, экран рисует задача дисплея по otaProgress
     ArduinoOTA.onStart([]() {
         Serial.println("\n=== ОБНОВЛЕНИЕ ПО ВОЗДУХУ (OTA) ===");
-        pump.pumpOff();
-        if (stateMachine) stateMachine->toIdle();
-        display.showOTAScreen();
+        otaProgress = OTA_STARTED;
+        eventQueue.post(EVT_OTA_START);
     });
     
     ArduinoOTA.onProgress([](unsigned int progress, unsigned int total) {
@@ -172,13 +253,13 @@ void setup() {
         if (percent != lastPercent) {
             lastPercent = percent;
             Serial.printf("\rПрогресс: %d%%", percent);
-            if (percent % 10 == 0) display.showOTAScreen(percent);
+            otaProgress = percent;
         }
     });
     
     ArduinoOTA.onEnd([]() {
         Serial.println("\n\n✓ ОБНОВЛЕНИЕ ЗАВЕРШЕНО");
-        display.showOTACompleteScreen();
+        otaProgress = OTA_COMPLETE;
         delay(2000);
     });
     
@@ -187,6 +268,7 @@ void setup() {
         if (error == OTA_AUTH_ERROR) Serial.println("Ошибка авторизации");
         else if (error == OTA_CONNECT_ERROR) Serial.println("Ошибка подключения");
         else Serial.println("Неизвестная ошибка");
+        otaProgress = OTA_INACTIVE;
     });
     
     ArduinoOTA.begin();
@@ -203,72 +285,133 @@ void setup() {
     esp_task_wdt_add(NULL);
     
     Serial.println("\n✓ Watchdog инициализирован");
+    
+    // ===== ПЛАНИРОВЩИК =====
+    scheduler.addTask("control", controlTask, CONTROL_TASK_PERIOD);
+    scheduler.addTask("serial", serialTask, SERIAL_TASK_PERIOD);
+    scheduler.addTask("display", displayTask, DISPLAY_TASK_PERIOD);
+    scheduler.addTask("status", statusTask, STATUS_TASK_PERIOD);
+    Serial.printf("✓ Планировщик: %d задач\n", scheduler.getTaskCount());
+    
+    // ===== СЕТЕВАЯ ЗАДАЧА =====
+    // Сеть живет на ядре 0 рядом со стеком Wi-Fi: медленный TCP connect или
+    // большой HTTP ответ не задерживают управление помпой на ядре 1.
+    // С управлением она общается только через очередь событий.
+    networkScheduler.addTask("network", networkTask, NETWORK_TASK_PERIOD, NETWORK_TASK_DEADLINE);
+    networkScheduler.addTask("publish", publishTask, PUBLISH_TASK_PERIOD);
+    xTaskCreatePinnedToCore(networkTaskLoop, "network", NETWORK_TASK_STACK, nullptr,
+                            NETWORK_TASK_PRIORITY, &networkTaskHandle, NETWORK_TASK_CORE);
+    Serial.printf("✓ Сетевая задача запущена на ядре %d\n", NETWORK_TASK_CORE);
     Serial.println("============================================\n");
     
     // Выводим справку
     if (cmdHandler) cmdHandler->printHelp();
 }
 
-// ==================== ГЛАВНЫЙ ЦИКЛ ====================
-void loop() {
-    esp_task_wdt_reset();
+// ==================== ЗАДАЧИ ПЛАНИРОВЩИКА ====================
+// Управление: кнопка, помпа, конечный автомат
+void controlTask() {
+    pollButton();
+    pump.update();
+    
+    if (stateMachine) {
+        stateMachine->update();
+        stateMachine->updateDisplayWaiting();
+    }
+}
+
+// Сетевые сервисы: OTA, веб-сервер, Wi-Fi, MQTT
+void networkTask() {
+    // Сброс Wi-Fi и портал настройки, запрошенные кнопкой и Serial с ядра 1
+    SystemEvent evt;
+    while (networkEvents.wait(evt, 0)) {
+        processNetworkEvent(evt);
+    }
+    
     ArduinoOTA.handle();
     if (webDashboard) {
         webDashboard->handle();  // Обработка веб-запросов
     }
-    unsigned long now = millis();
-        if ((long)(now - lastLoopTime) < (long)LOOP_INTERVAL) {
-            delay(1);
-            return;
-        }
-    lastLoopTime = now;
-   
-    // Обновление компонентов
+    
     wifiManager.loop();
     
     if (wifiManager.isConnected() && mqttManager) {
         mqttManager->loop();
     }
-    
-    button.tick();
-    
-    // Обновление статуса WiFi на дисплее
-    static unsigned long lastWiFiStatusUpdate = 0;
-    if (now - lastWiFiStatusUpdate > 1000) {
-        lastWiFiStatusUpdate = now;
-        display.setWiFiStatus(wifiManager.isConfigured(), wifiManager.isConnected());
+}
+
+void publishTask() {
+    publishMqttUpdates();
+}
+
+// Обновление статуса WiFi на дисплее
+void statusTask() {
+    display.setWiFiStatus(wifiManager.isConfigured(), wifiManager.isConnected());
+}
+
+// Обработка команд из Serial
+void serialTask() {
+    if (cmdHandler) {
+        cmdHandler->handle();
+    }
+}
+
+// Обновление дисплея
+void displayTask() {
+    int ota = otaProgress.load();
+    if (ota == OTA_COMPLETE) {
+        display.showOTACompleteScreen();
+        return;
+    }
+    if (ota != OTA_INACTIVE) {
+        display.showOTAScreen(ota);
+        return;
     }
     
-    // Обработка удержания кнопки для сброса
-    // ... (код обработки удержания) ...
+    if (!stateMachine) return;
     
-    pump.update();
+    SystemSnapshot snap;
+    stateMachine->readSnapshot(snap);
+    if (snap.version == 0) return;  // Автомат еще не сделал ни одного такта
     
-    if (stateMachine) {
-        stateMachine->update();
-        stateMachine->handleButton(button);
-        stateMachine->updateDisplayWaiting();
+    display.update(snap.state, snap.error, snap.kettlePresent,
+                  snap.currentWeight, snap.fillTarget, snap.fillStart,
+                  snap.powerRelayOn, snap.emptyWeight);
+}
+
+// Сетевая задача (ядро 0): свой планировщик и своя регистрация в watchdog
+void networkTaskLoop(void* param) {
+    esp_task_wdt_add(NULL);
+    
+    for (;;) {
+        esp_task_wdt_reset();
+        uint32_t idleMs = networkScheduler.run();
+        
+        // Хотя бы один тик сна: idle-задача ядра 0 тоже под watchdog
+        vTaskDelay(idleMs > 0 ? pdMS_TO_TICKS(idleMs) : 1);
     }
+}
+
+// ==================== ГЛАВНЫЙ ЦИКЛ ====================
+void loop() {
+    esp_task_wdt_reset();
     
-    publishMqttUpdates();
+    // Отсчеты HX711 читает отдельная задача весов (Scale::startSampling),
+    // здесь выполняются только периодические задачи, время которых пришло
+    uint32_t idleMs = scheduler.run();
     
-    // Обработка команд из Serial
-    if (cmdHandler) {
-        cmdHandler->handle();  // ← Теперь это одна строка вместо 500!
+    // Пока кнопка в работе - опрашиваем ее чаще такта управления
+    if ((long)(millis() - buttonActiveUntil) < 0) {
+        pollButton();
+        if (idleMs > 1) idleMs = 1;
     }
     
-    // Обновление дисплея
-    static unsigned long lastDisplayUpdate = 0;
-    if (now - lastDisplayUpdate > 200) {
-        lastDisplayUpdate = now;
-        
-        SystemState currentState = stateMachine ? stateMachine->getCurrentStateEnum() : ST_IDLE;
-        ErrorType currentError = stateMachine ? stateMachine->getCurrentError() : ERR_NONE;
-        float target = (currentState == ST_FILLING && stateMachine) ? stateMachine->getFillTarget() : 0;
-        float start = (currentState == ST_FILLING && stateMachine) ? stateMachine->getFillStart() : 0;
-        
-        display.update(currentState, currentError, scale.isKettlePresent(),
-                      scale.getCurrentWeight(), target, start,
-                      pump.isPowerRelayOn(), scale.getEmptyWeight());
+    // Спим до следующей задачи, но просыпаемся сразу при событии:
+    // команда проверяется немедленно, переход выполнит такт управления
+    SystemEvent evt;
+    if (eventQueue.wait(evt, idleMs)) {
+        do {
+            processEvent(evt);
+        } while (eventQueue.wait(evt, 0));
     }
-}
\ No newline at end of file
+}
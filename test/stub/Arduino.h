@@ -0,0 +1,42 @@
+// файл: test/stub/Arduino.h
+// Заглушка Arduino.h для хост-тестов: только то, что нужно чистым модулям
+// (config.h, FlowEstimator, FlowMonitor, TaskScheduler, JsonWriter, OvershootModel, заголовки с шаблонами)
+
+#ifndef ARDUINO_STUB_H
+#define ARDUINO_STUB_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+// Виртуальные часы: тест сам двигает время через stubMillis() и stubMicros()
+inline unsigned long& stubMillis() {
+    static unsigned long now = 0;
+    return now;
+}
+
+inline unsigned long millis() {
+    return stubMillis();
+}
+
+inline unsigned long& stubMicros() {
+    static unsigned long now = 0;
+    return now;
+}
+
+inline unsigned long micros() {
+    return stubMicros();
+}
+
+// Serial для LOG_*() из debug.h: вывод отбрасывается
+struct StubSerial {
+    template <typename T> void print(const T&) {}
+    template <typename T> void println(const T&) {}
+    void println() {}
+    template <typename... Args> void printf(const char*, Args...) {}
+};
+
+inline StubSerial Serial;
+
+#endif
@@ -0,0 +1,52 @@
+// файл: test/stub/EEPROM.h
+// Заглушка EEPROM для хост-тестов: буфер в памяти и отдельная копия "флеша"
+// Тест видит, что попало во флеш только через commit(), и сколько было записей
+
+#ifndef EEPROM_STUB_H
+#define EEPROM_STUB_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define STUB_EEPROM_SIZE 4096
+
+class EEPROMClass {
+private:
+    uint8_t buffer[STUB_EEPROM_SIZE];
+    uint8_t flash[STUB_EEPROM_SIZE];
+    uint32_t commits;
+
+public:
+    EEPROMClass() : commits(0) {
+        memset(buffer, 0xFF, sizeof(buffer));
+        memset(flash, 0xFF, sizeof(flash));
+    }
+
+    template <typename T> const T& put(int addr, const T& value) {
+        memcpy(buffer + addr, &value, sizeof(T));
+        return value;
+    }
+
+    template <typename T> T& get(int addr, T& value) {
+        memcpy(&value, buffer + addr, sizeof(T));
+        return value;
+    }
+
+    bool commit() {
+        memcpy(flash, buffer, sizeof(flash));
+        commits++;
+        return true;
+    }
+
+    // ==================== ДЛЯ ТЕСТОВ ====================
+    uint32_t getCommits() const { return commits; }
+
+    /** Перезагрузка: буфер снова читается из флеша, незаписанное теряется */
+    void reboot() { memcpy(buffer, flash, sizeof(buffer)); }
+
+    uint8_t* data() { return buffer; }
+};
+
+inline EEPROMClass EEPROM;
+
+#endif
@@ -0,0 +1,28 @@
+// файл: test/stub/freertos/FreeRTOS.h
+// Заглушка FreeRTOS для хост-тестов: типы и макросы, нужные EventQueue
+// Тик - 1 мс, время - виртуальные часы stubMicros() из Arduino.h
+
+#ifndef FREERTOS_STUB_H
+#define FREERTOS_STUB_H
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+#define IRAM_ATTR
+
+// Переключение на разбуженную задачу: тест только считает вызовы
+inline uint32_t& stubYieldsFromISR() {
+    static uint32_t count = 0;
+    return count;
+}
+
+#define portYIELD_FROM_ISR() (stubYieldsFromISR()++)
+
+#endif
@@ -0,0 +1,71 @@
+// файл: test/stub/freertos/queue.h
+// Заглушка статической очереди FreeRTOS для хост-тестов
+// Однопоточная: ожидание в xQueueReceive отдается тесту (stubQueueWait),
+// который двигает виртуальные часы и может положить событие "из прерывания"
+
+#ifndef FREERTOS_QUEUE_STUB_H
+#define FREERTOS_QUEUE_STUB_H
+
+#include "FreeRTOS.h"
+#include <string.h>
+
+struct StaticQueue_t {
+    uint8_t* storage;
+    UBaseType_t length;
+    UBaseType_t itemSize;
+    UBaseType_t head;
+    UBaseType_t count;
+};
+
+typedef StaticQueue_t* QueueHandle_t;
+
+/**
+ * Ожидание пустой очереди: тест двигает время не дальше ticks мс
+ * и возвращается, как только в очереди что-то появилось
+ * (nullptr - очередь не ждет, как при таймауте 0)
+ */
+typedef void (*StubQueueWait)(QueueHandle_t queue, TickType_t ticks);
+
+inline StubQueueWait& stubQueueWait() {
+    static StubQueueWait hook = nullptr;
+    return hook;
+}
+
+inline QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t itemSize,
+                                        uint8_t* storage, StaticQueue_t* control) {
+    control->storage = storage;
+    control->length = length;
+    control->itemSize = itemSize;
+    control->head = 0;
+    control->count = 0;
+    return control;
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t) {
+    if (queue->count == queue->length) return pdFALSE;
+    UBaseType_t tail = (queue->head + queue->count) % queue->length;
+    memcpy(queue->storage + tail * queue->itemSize, item, queue->itemSize);
+    queue->count++;
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* woken) {
+    BaseType_t sent = xQueueSend(queue, item, 0);
+    if (woken) *woken = sent;   // Ожидающая задача просыпается
+    return sent;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks) {
+    if (queue->count == 0 && ticks > 0 && stubQueueWait()) stubQueueWait()(queue, ticks);
+    if (queue->count == 0) return pdFALSE;
+    memcpy(item, queue->storage + queue->head * queue->itemSize, queue->itemSize);
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    return queue->count;
+}
+
+#endif
@@ -0,0 +1,40 @@
+// файл: test/test.h
+// Минимальный каркас хост-тестов: проверки и итог без внешних библиотек
+// Каждый test_*.cpp - отдельная программа, код возврата 0 - все проверки прошли
+
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+#include <math.h>
+
+static int testChecks = 0;
+static int testFailures = 0;
+
+#define CHECK(cond) do { \
+    testChecks++; \
+    if (!(cond)) { \
+        testFailures++; \
+        printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+    } \
+} while (0)
+
+#define CHECK_NEAR(actual, expected, eps) do { \
+    testChecks++; \
+    double a_ = (actual), e_ = (expected); \
+    if (!(fabs(a_ - e_) <= (eps))) { \
+        testFailures++; \
+        printf("  FAIL %s:%d: %s = %g, ожидалось %g +- %g\n", \
+               __FILE__, __LINE__, #actual, a_, e_, (double)(eps)); \
+    } \
+} while (0)
+
+#define RUN_TEST(fn) do { printf("%s\n", #fn); fn(); } while (0)
+
+// Итог программы: вызывается в конце main()
+static inline int testSummary(const char* name) {
+    printf("%s: %d проверок, %d ошибок\n", name, testChecks, testFailures);
+    return testFailures == 0 ? 0 : 1;
+}
+
+#endif
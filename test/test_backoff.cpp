@@ -0,0 +1,130 @@
+// файл: test/test_backoff.cpp
+// Пауза переподключения MQTT: границы, предел, разброс по парку устройств
+// и учет попыток (MqttReconnect.h)
+
+#include "test.h"
+#include "MqttReconnect.h"
+#include <random>
+#include <string.h>
+
+#define MIN_MS MQTT_BACKOFF_MIN
+#define MAX_MS MQTT_BACKOFF_MAX
+
+static uint32_t baseDelay(uint32_t failures) {
+    double base = MIN_MS * pow(2.0, failures - 1.0);
+    return base > MAX_MS ? MAX_MS : (uint32_t)base;
+}
+
+static void testBounds() {
+    // Для любой неудачи и любого случайного числа пауза в [основа / 2, основа]
+    std::mt19937 rng(1);
+    bool inside = true;
+    for (uint32_t failures = 1; failures <= 200; failures++) {
+        uint32_t base = baseDelay(failures);
+        uint32_t extremes[] = { 0, 1, base / 2, base / 2 + 1, 0xFFFFFFFFu };
+        for (uint32_t r : extremes) {
+            uint32_t delay = backoffDelay(failures, MIN_MS, MAX_MS, r);
+            if (delay < base / 2 || delay > base) inside = false;
+        }
+        for (int i = 0; i < 1000; i++) {
+            uint32_t delay = backoffDelay(failures, MIN_MS, MAX_MS, rng());
+            if (delay < base / 2 || delay > base) inside = false;
+        }
+    }
+    CHECK(inside);
+}
+
+static void testGrowthAndCap() {
+    // Без случайной части - ровно половина основы: 500, 1000, 2000... 30000
+    CHECK(backoffDelay(1, MIN_MS, MAX_MS, 0) == 500);
+    CHECK(backoffDelay(2, MIN_MS, MAX_MS, 0) == 1000);
+    CHECK(backoffDelay(6, MIN_MS, MAX_MS, 0) == 16000);
+    CHECK(backoffDelay(7, MIN_MS, MAX_MS, 0) == 30000);
+    CHECK(backoffDelay(1000000, MIN_MS, MAX_MS, 0) == 30000);
+
+    // Максимум достигается: случайная часть покрывает всю верхнюю половину
+    CHECK(backoffDelay(7, MIN_MS, MAX_MS, 30000) == 60000);
+
+    // Предел не кратен минимуму и близок к переполнению удвоения
+    CHECK(backoffDelay(40, 3000, 0xF0000000u, 0) == 0x78000000u);
+    CHECK(backoffDelay(0, MIN_MS, MAX_MS, 0) == 500);    // Защита от 0
+}
+
+static void testFleetSpread() {
+    // 1000 помп потеряли брокер одновременно: после 7-й неудачи попытки
+    // растянуты на 30 с, ни одна секунда не получает больше 6% парка
+    std::mt19937 rng(7);
+    uint32_t perSecond[61] = {};
+    for (int device = 0; device < 1000; device++) {
+        perSecond[backoffDelay(7, MIN_MS, MAX_MS, rng()) / 1000]++;
+    }
+    uint32_t peak = 0;
+    uint32_t busySeconds = 0;
+    for (uint32_t count : perSecond) {
+        if (count > peak) peak = count;
+        if (count > 0) busySeconds++;
+    }
+    printf("  пик %u попыток в секунду, занято %u секунд из 31\n", peak, busySeconds);
+    CHECK(peak <= 60);
+    CHECK(busySeconds >= 30);
+}
+
+static void testReconnectAccounting() {
+    MqttReconnect reconnect;
+    CHECK(reconnect.isDue(0));
+
+    // Брокер отказывает: пауза растет, причины считаются раздельно
+    unsigned long now = 1000;
+    reconnect.beginAttempt(now);
+    reconnect.attemptFinished(now + 3);
+    CHECK(reconnect.failed(MQTT_FAIL_TCP, now + 3, 0) == 500);
+    CHECK(!reconnect.isDue(now + 502));
+    CHECK(reconnect.isDue(now + 503));
+    CHECK(reconnect.retryDelay(now + 103) == 400);
+
+    now += 503;
+    reconnect.beginAttempt(now);
+    reconnect.attemptFinished(now + MQTT_CONNACK_TIMEOUT * 1000);
+    now += MQTT_CONNACK_TIMEOUT * 1000;
+    CHECK(reconnect.failed(MQTT_FAIL_TIMEOUT, now, 0) == 1000);
+    CHECK(reconnect.getConsecutiveFailures() == 2);
+    CHECK(reconnect.getLastFailReason() == MQTT_FAIL_TIMEOUT);
+    CHECK(reconnect.getFailures(MQTT_FAIL_TCP) == 1);
+    CHECK(reconnect.getFailures(MQTT_FAIL_TIMEOUT) == 1);
+    CHECK(reconnect.getLastLatency() == MQTT_CONNACK_TIMEOUT * 1000);
+    CHECK(reconnect.getMaxLatency() == MQTT_CONNACK_TIMEOUT * 1000);
+
+    // Успех сбрасывает серию: разрыв после него - снова с первой паузы
+    now += 1000;
+    reconnect.beginAttempt(now);
+    reconnect.attemptFinished(now + 40);
+    reconnect.succeeded();
+    CHECK(reconnect.getSuccesses() == 1 && reconnect.getAttempts() == 3);
+    CHECK(reconnect.getLastLatency() == 40 && reconnect.getMaxLatency() == MQTT_CONNACK_TIMEOUT * 1000);
+    CHECK(reconnect.failed(MQTT_FAIL_LOST, now + 60000, 0) == 500);
+
+    // Нет учетных данных - проверка раз в MQTT_BACKOFF_MAX, серия не растет
+    reconnect.blocked(MQTT_FAIL_NO_CREDENTIALS, now);
+    CHECK(reconnect.retryDelay(now) == MQTT_BACKOFF_MAX);
+    CHECK(reconnect.getConsecutiveFailures() == 1);
+    reconnect.retryNow(now + 5);
+    CHECK(reconnect.isDue(now + 5) && reconnect.getConsecutiveFailures() == 0);
+
+    // Переход millis() через ноль: срок попытки после нуля, 32 бита как на ESP32
+    uint32_t beforeWrap = 0xFFFFFF00u;
+    reconnect.failed(MQTT_FAIL_DNS, beforeWrap, 0);
+    CHECK(!reconnect.isDue(beforeWrap + 255));
+    CHECK(!reconnect.isDue(beforeWrap + 499));
+    CHECK(reconnect.isDue(beforeWrap + 500));
+    CHECK(reconnect.retryDelay(beforeWrap + 400) == 100);
+    CHECK(strcmp(mqttFailReasonName(MQTT_FAIL_TIMEOUT), "timeout") == 0);
+    CHECK(strcmp(mqttConnStateName(MQTT_CONN_CONNECTING), "connecting") == 0);
+}
+
+int main() {
+    RUN_TEST(testBounds);
+    RUN_TEST(testGrowthAndCap);
+    RUN_TEST(testFleetSpread);
+    RUN_TEST(testReconnectAccounting);
+    return testSummary("backoff");
+}
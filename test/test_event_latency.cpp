@@ -0,0 +1,241 @@
+// файл: test/test_event_latency.cpp
+// Очередь событий и основной цикл на виртуальных часах: задержка событие -> обработка
+// и команда -> pumpOn() не зависит от периода такта, события из прерывания не теряются
+
+#include "test.h"
+#include "EventQueue.h"
+#include "TaskScheduler.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Длительность задач основного цикла (мкс): дисплей - самая долгая (I2C)
+#define CONTROL_RUN_US 1500
+#define SERIAL_RUN_US 200
+#define DISPLAY_RUN_US 8000
+#define STATUS_RUN_US 100
+#define LOOP_PASS_US 20                // Проход loop() без задач и событий
+#define FILL_DURATION 3000             // Налив после включения помпы (мс)
+
+// ==================== ВИРТУАЛЬНЫЕ ЧАСЫ И ВНЕШНИЕ СОБЫТИЯ ====================
+struct External {
+    uint32_t at;            // micros() момента
+    EventType type;
+    bool fromISR;           // Кнопка - из прерывания, MQTT и веб - из сетевой задачи
+};
+
+static EventQueue queue;
+static std::vector<External> external;
+static size_t nextExternal = 0;
+
+static void setNow(uint32_t us) {
+    stubMicros() = us;
+    stubMillis() = us / 1000;
+}
+
+static void fire(const External& e) {
+    if (e.fromISR) queue.postFromISR(e.type);
+    else queue.post(e.type, e.type == EVT_FILL ? 1500 : MQTT_COMMAND_ARG(3, 0));
+}
+
+// Прошло us: внешние события приходят в свои моменты, даже посреди задачи
+static void advance(uint32_t us) {
+    uint32_t end = micros() + us;
+    while (nextExternal < external.size() && external[nextExternal].at <= end) {
+        setNow(std::max<uint32_t>(micros(), external[nextExternal].at));
+        fire(external[nextExternal++]);
+    }
+    setNow(end);
+}
+
+// Ожидание пустой очереди: сон до таймаута или до первого события
+static void waitHook(QueueHandle_t, TickType_t ticks) {
+    uint32_t end = micros() + ticks * 1000;
+    if (nextExternal < external.size() && external[nextExternal].at <= end) {
+        setNow(std::max<uint32_t>(micros(), external[nextExternal].at));
+        fire(external[nextExternal++]);
+        return;
+    }
+    setNow(end);
+}
+
+// ==================== МОДЕЛЬ УСТРОЙСТВА ====================
+// Как StateMachine: событие проверяется сразу, переход выполняет такт управления,
+// FillingState::enter() ведет серво к чайнику, помпа включается, когда оно доехало
+struct Device {
+    bool fillScheduled = false;
+    bool filling = false;
+    bool pumpOn = false;
+    bool servoMoving = false;
+    unsigned long servoStart = 0;
+    unsigned long pumpStart = 0;
+    uint32_t commandTime = 0;          // micros() события, запустившего налив
+    unsigned long buttonActiveUntil = 0;
+    uint32_t buttonPolls = 0;
+    uint32_t rejected = 0;
+    std::vector<uint32_t> actuation;   // Команда -> pumpOn() (мкс)
+    std::vector<uint32_t> dispatch;    // post() -> обработка (мкс)
+};
+
+static Device device;
+static TaskScheduler scheduler;
+
+static void processEvent(const SystemEvent& evt) {
+    device.dispatch.push_back(micros() - evt.timestamp);
+    switch (evt.type) {
+        case EVT_BUTTON_EDGE:
+            device.buttonActiveUntil = millis() + BUTTON_ACTIVE_WINDOW;
+            break;
+        case EVT_MQTT_COMMAND:
+        case EVT_FILL:
+            if (device.filling || device.fillScheduled) {
+                device.rejected++;
+                break;
+            }
+            device.fillScheduled = true;
+            if (device.commandTime == 0) device.commandTime = evt.timestamp;
+            break;
+        default:
+            break;
+    }
+}
+
+static void controlTask() {
+    // pump.update(): серво доехало за SERVO_MOVE_TIME
+    if (device.servoMoving && millis() - device.servoStart >= SERVO_MOVE_TIME) device.servoMoving = false;
+
+    // stateMachine->update(): переход, затем update() состояния
+    if (device.fillScheduled) {
+        device.fillScheduled = false;
+        device.filling = true;
+        device.servoMoving = true;
+        device.servoStart = millis();
+    }
+    if (device.filling && !device.servoMoving && !device.pumpOn) {
+        device.pumpOn = true;
+        device.pumpStart = millis();
+        device.actuation.push_back(micros() - device.commandTime);
+        device.commandTime = 0;
+    }
+    if (device.pumpOn && millis() - device.pumpStart >= FILL_DURATION) {
+        device.pumpOn = false;
+        device.filling = false;
+    }
+    advance(CONTROL_RUN_US);
+}
+
+static void serialTask() { advance(SERIAL_RUN_US); }
+static void displayTask() { advance(DISPLAY_RUN_US); }
+static void statusTask() { advance(STATUS_RUN_US); }
+
+// Один проход loop() из smart_pump_esp32.ino
+static void loopOnce() {
+    advance(LOOP_PASS_US);
+    uint32_t idleMs = scheduler.run();
+    if ((long)(millis() - device.buttonActiveUntil) < 0) {
+        device.buttonPolls++;
+        if (idleMs > 1) idleMs = 1;
+    }
+    SystemEvent evt;
+    if (queue.wait(evt, idleMs)) {
+        do {
+            processEvent(evt);
+        } while (queue.wait(evt, 0));
+    }
+}
+
+static uint32_t maxOf(const std::vector<uint32_t>& v) {
+    return v.empty() ? 0 : *std::max_element(v.begin(), v.end());
+}
+
+static uint32_t minOf(const std::vector<uint32_t>& v) {
+    return v.empty() ? 0 : *std::min_element(v.begin(), v.end());
+}
+
+static void testActuationLatency() {
+    setNow(1000);
+    queue.begin();
+    stubQueueWait() = waitHook;
+    scheduler.addTask("control", controlTask, CONTROL_TASK_PERIOD);
+    scheduler.addTask("serial", serialTask, SERIAL_TASK_PERIOD);
+    scheduler.addTask("display", displayTask, DISPLAY_TASK_PERIOD);
+    scheduler.addTask("status", statusTask, STATUS_TASK_PERIOD);
+
+    // 10 минут: команды MQTT и веба каждые 2-6 с, нажатия кнопки каждые 0.5-2 с,
+    // моменты случайные относительно сетки такта
+    std::mt19937 rng(9);
+    std::uniform_int_distribution<uint32_t> commandGap(2000000, 6000000);
+    std::uniform_int_distribution<uint32_t> buttonGap(500000, 2000000);
+    const uint32_t end = 600u * 1000000u;
+    for (uint32_t t = 1500000; t < end; t += commandGap(rng)) {
+        external.push_back({ t, (t / 7) % 2 ? EVT_MQTT_COMMAND : EVT_FILL, false });
+    }
+    for (uint32_t t = 1100000; t < end; t += buttonGap(rng)) {
+        external.push_back({ t, EVT_BUTTON_EDGE, true });
+    }
+    std::sort(external.begin(), external.end(),
+              [](const External& a, const External& b) { return a.at < b.at; });
+
+    while (micros() < end) loopOnce();
+
+    uint32_t worstTick = LOOP_PASS_US + CONTROL_RUN_US + SERIAL_RUN_US + DISPLAY_RUN_US + STATUS_RUN_US;
+    printf("  событий %lu, наливов %zu, отклонено (занято) %lu\n",
+           (unsigned long)queue.getPosted(), device.actuation.size(), (unsigned long)device.rejected);
+    printf("  post -> обработка: %lu..%lu мкс, команда -> pumpOn(): %lu..%lu мкс\n",
+           (unsigned long)minOf(device.dispatch), (unsigned long)maxOf(device.dispatch),
+           (unsigned long)minOf(device.actuation), (unsigned long)maxOf(device.actuation));
+
+    CHECK(nextExternal == external.size());
+    CHECK(queue.getDropped() == 0);
+    CHECK(queue.getPosted() == external.size());
+    CHECK(device.dispatch.size() == external.size());
+    CHECK(device.actuation.size() > 50);
+
+    // Событие обрабатывается, как только освободился цикл: не позже самого
+    // долгого прохода задач и без ожидания такта управления (20 мс)
+    CHECK(minOf(device.dispatch) == 0);
+    CHECK(maxOf(device.dispatch) <= worstTick);
+    CHECK(maxOf(device.dispatch) < CONTROL_TASK_PERIOD * 1000UL);
+    CHECK(queue.getMaxLatency() == maxOf(device.dispatch));
+
+    // Команда -> помпа: ход серво плюс не больше двух тактов (переход и
+    // такт, заметивший серво на месте) и одного долгого прохода задач
+    CHECK(minOf(device.actuation) >= SERVO_MOVE_TIME * 1000UL);
+    CHECK(maxOf(device.actuation) <= (SERVO_MOVE_TIME + 2 * CONTROL_TASK_PERIOD) * 1000UL + worstTick);
+
+    // Фронт кнопки включает частый опрос
+    CHECK(device.buttonPolls > 1000);
+    stubQueueWait() = nullptr;
+}
+
+static void testIsrFlood() {
+    // Дребезг: прерывания кладут события быстрее, чем цикл их забирает
+    EventQueue flood;
+    CHECK(!flood.postFromISR(EVT_BUTTON_EDGE));       // Очередь еще не создана
+    flood.begin();
+    uint32_t yieldsBefore = stubYieldsFromISR();
+    int accepted = 0;
+    for (int i = 0; i < EVENT_QUEUE_SIZE + 4; i++) {
+        if (flood.postFromISR(EVT_BUTTON_EDGE, i)) accepted++;
+    }
+    CHECK(accepted == EVENT_QUEUE_SIZE);
+    CHECK(flood.getPosted() == EVENT_QUEUE_SIZE);
+    CHECK(flood.getDropped() == 4);
+    CHECK(flood.getPending() == EVENT_QUEUE_SIZE);
+    CHECK(stubYieldsFromISR() - yieldsBefore == EVENT_QUEUE_SIZE);
+
+    // Порядок сохраняется, переполнение не портит принятые события
+    SystemEvent evt;
+    for (int i = 0; i < EVENT_QUEUE_SIZE; i++) {
+        CHECK(flood.wait(evt, 0) && evt.type == EVT_BUTTON_EDGE && evt.arg == i);
+    }
+    CHECK(!flood.wait(evt, 0));
+    CHECK(flood.post(EVT_STOP));
+    CHECK(flood.wait(evt, 0) && evt.type == EVT_STOP);
+}
+
+int main() {
+    RUN_TEST(testActuationLatency);
+    RUN_TEST(testIsrFlood);
+    return testSummary("event_latency");
+}
@@ -0,0 +1,294 @@
+// файл: test/test_fleet_sim.cpp
+// Парк помп на логике прошивки (tools/FleetSim.h) и брокере в памяти на виртуальном времени:
+// нагрузка и подтверждения, уникальные Client ID, отказ брокера и паузы переподключения
+
+#include "test.h"
+#include "../tools/FleetSim.h"
+
+#define LATENCY 5                      // Сеть в одну сторону (мс)
+#define MINUTE 60000ull
+
+static FleetSim::LinkFactory memoryLinks(SimBroker& broker) {
+    // Диспетчер стоит рядом с брокером: неисправности его не затрагивают
+    return [&broker](int device) { return broker.createLink(device < 0); };
+}
+
+static unsigned long outcome(const FleetStats& stats, const char* status) {
+    auto it = stats.outcomes.find(status);
+    return it == stats.outcomes.end() ? 0 : it->second;
+}
+
+/**
+ * Паузы между попытками каждой помпы: следующая попытка начинается через назначенную
+ * паузу (по часам помпы с уходом и шагом сетевой задачи), пауза - в границах backoffDelay()
+ */
+static void checkRetrySpacing(const FleetStats& stats, int devices, int driftPpm, int& checked) {
+    bool spacing = true;
+    bool bounds = true;
+    for (int device = 0; device < devices; device++) {
+        const SimAttempt* previous = nullptr;
+        for (const SimAttempt& attempt : stats.attempts) {
+            if (attempt.device != device) continue;
+            if (previous && previous->result != MQTT_FAIL_NONE) {
+                uint64_t gap = attempt.start - previous->end;
+                double drift = previous->retryDelay * driftPpm / 1e6;
+                if (gap + drift + 1 < previous->retryDelay ||
+                    gap > previous->retryDelay + drift + NETWORK_TASK_PERIOD + 1) {
+                    spacing = false;
+                }
+                uint32_t base = 2 * backoffDelay(previous->failures, MQTT_BACKOFF_MIN, MQTT_BACKOFF_MAX, 0);
+                if (previous->retryDelay < base / 2 || previous->retryDelay > base) bounds = false;
+                checked++;
+            }
+            previous = &attempt;
+        }
+    }
+    CHECK(spacing);
+    CHECK(bounds);
+}
+
+static void testFleetLoad() {
+    // 50 помп, 10 минут, 2 команды в секунду на парк, 5% повторов
+    SimBroker broker(LATENCY);
+    FleetConfig config;
+    config.devices = 50;
+    config.rate = 2;
+    config.repeat = 0.05;
+    config.seed = 11;
+    FleetSim fleet(config, memoryLinks(broker));
+
+    fleet.run(0, 10 * MINUTE);
+    fleet.getCommander()->stop();
+    fleet.run(10 * MINUTE, 14 * MINUTE);       // Полный чайник наливается почти 3 минуты
+    fleet.printReport(stdout, 840);
+
+    const FleetStats& stats = fleet.getStats();
+    CHECK(fleet.countConnected() == config.devices);
+    CHECK(stats.commandsSent > 1000);
+    CHECK(fleet.getUnanswered() == 0);
+    CHECK(stats.commandsReceived == stats.commandsSent + stats.repeatsSent);
+
+    // Каждая команда получила ровно один первый ответ, каждый повтор - duplicate
+    CHECK(stats.rtt.size() == stats.commandsSent);
+    CHECK(stats.repeatsSent > 20);
+    CHECK(outcome(stats, "duplicate") == stats.repeatsSent);
+    CHECK(outcome(stats, "accepted") > 100);
+    CHECK(outcome(stats, "rejected") > 0);      // Занята наливом или цель уже достигнута
+
+    // Налив завершен или остановлен; без ответа остаются только наливы, чей слот ожидания
+    // (MQTT_PENDING_COMMANDS) заняли команды, пришедшие во время налива
+    CHECK(outcome(stats, "accepted") ==
+          outcome(stats, "completed") + outcome(stats, "stopped") + stats.evictedAccepted);
+    CHECK(stats.evictedUnanswered == 0);
+
+    // Команда -> подтверждение: сеть туда и обратно, сетевая задача, такт управления,
+    // задача публикации; уход часов добавляет доли миллисекунды
+    double bound = 4 * LATENCY + NETWORK_TASK_PERIOD + CONTROL_TASK_PERIOD + PUBLISH_TASK_PERIOD + 2;
+    printf("  p95 %.0f мс, макс. %.0f мс, граница %.0f мс\n",
+           simPercentile(stats.rtt, 95), simPercentile(stats.rtt, 100), bound);
+    CHECK(simPercentile(stats.rtt, 100) <= bound);
+    CHECK(simPercentile(stats.rtt, 50) >= 4 * LATENCY);
+
+    // Брокер доставил диспетчеру все публикации, лишних подключений нет
+    bool delivered = true;
+    for (int leaf = 0; leaf < SIM_LEAF_COUNT; leaf++) {
+        if (stats.published[leaf] == 0 || stats.received[leaf] != stats.published[leaf]) delivered = false;
+    }
+    CHECK(delivered);
+    CHECK(broker.getTakeovers() == 0);
+    CHECK(stats.connects == (unsigned long)config.devices);
+    CHECK(stats.reconnects == 0);
+
+    unsigned long illegal = 0;
+    for (auto& pump : fleet.getPumps()) illegal += pump->getIllegalTransitions();
+    CHECK(illegal == 0);
+}
+
+static void testLinkDrops() {
+    // Обрывы Wi-Fi: в среднем два в минуту на помпу, команды идут все время
+    SimBroker broker(LATENCY);
+    FleetConfig config;
+    config.devices = 20;
+    config.rate = 1;
+    config.repeat = 0.05;
+    config.drops = 2;
+    config.seed = 23;
+    FleetSim fleet(config, memoryLinks(broker));
+
+    fleet.run(0, 5 * MINUTE);
+    fleet.getCommander()->stop();
+    fleet.run(5 * MINUTE, 9 * MINUTE);
+
+    const FleetStats& stats = fleet.getStats();
+    printf("  разрывов %lu, переподключений %lu, без подтверждения %zu\n",
+           stats.drops, stats.reconnects, fleet.getUnanswered());
+    CHECK(stats.drops > 100);
+    unsigned long offline = config.devices - fleet.countConnected();     // Оборвалось под конец
+    CHECK(stats.reconnects + offline == stats.drops);
+    CHECK(stats.failures[MQTT_FAIL_LOST] == stats.drops);
+
+    // Команды, пришедшие во время разрыва, брокер доставил после переподключения
+    CHECK(stats.commandsReceived == stats.commandsSent + stats.repeatsSent);
+    CHECK(fleet.getUnanswered() == stats.evictedUnanswered);
+    CHECK(outcome(stats, "duplicate") == stats.repeatsSent);
+
+    int checked = 0;
+    checkRetrySpacing(stats, config.devices, config.driftPpm, checked);
+    CHECK(checked == (int)stats.reconnects);
+}
+
+static void testSharedClientId() {
+    // Один Client ID на всех: брокер выкидывает прежнего владельца при каждом подключении
+    SimBroker sharedBroker(LATENCY);
+    FleetConfig config;
+    config.devices = 10;
+    config.rate = 0;
+    config.sharedClientId = true;
+    FleetSim shared(config, memoryLinks(sharedBroker));
+    shared.run(0, 2 * MINUTE);
+
+    SimBroker uniqueBroker(LATENCY);
+    config.sharedClientId = false;
+    FleetSim unique(config, memoryLinks(uniqueBroker));
+    unique.run(0, 2 * MINUTE);
+
+    printf("  общий Client ID: вытеснений %lu, подключений %lu; уникальные: %lu, %lu\n",
+           sharedBroker.getTakeovers(), shared.getStats().connects,
+           uniqueBroker.getTakeovers(), unique.getStats().connects);
+    CHECK(sharedBroker.getTakeovers() >= 10);
+    CHECK(shared.getStats().failures[MQTT_FAIL_LOST] >= 10);
+    CHECK(shared.countConnected() <= 1);
+    CHECK(uniqueBroker.getTakeovers() == 0);
+    CHECK(unique.countConnected() == config.devices);
+    CHECK(unique.getStats().connects == (unsigned long)config.devices);
+}
+
+static void testBrokerOutage() {
+    // Брокер недоступен 3 минуты (порт закрыт), команды в это время ждут у брокера
+    SimBroker broker(LATENCY);
+    FleetConfig config;
+    config.devices = 30;
+    config.rate = 0.5;
+    config.repeat = 0;
+    config.seed = 5;
+    FleetSim fleet(config, memoryLinks(broker));
+
+    const uint64_t outageStart = MINUTE;
+    const uint64_t outageEnd = 4 * MINUTE;
+    fleet.run(0, outageStart);
+    CHECK(fleet.countConnected() == config.devices);
+    unsigned long sentBefore = fleet.getStats().commandsSent;
+
+    broker.setFault(SIM_BROKER_REFUSED);
+    fleet.run(outageStart, outageEnd);
+    const FleetStats& stats = fleet.getStats();
+    CHECK(fleet.countConnected() == 0);
+    CHECK(stats.failures[MQTT_FAIL_LOST] == (unsigned long)config.devices);
+    CHECK(stats.failures[MQTT_FAIL_TCP] > (unsigned long)config.devices * 5);
+    CHECK(stats.commandsSent - sentBefore > 50);
+    CHECK(fleet.getUnanswered() >= stats.commandsSent - sentBefore);
+
+    // Через MQTT_BACKOFF_MAX после восстановления подключены все
+    broker.setFault(SIM_BROKER_OK);
+    uint64_t allBack = 0;
+    for (uint64_t now = outageEnd; now < outageEnd + 2 * MQTT_BACKOFF_MAX; now++) {
+        fleet.step(now);
+        if (!allBack && fleet.countConnected() == config.devices) allBack = now;
+    }
+    printf("  все подключились через %.1f с после восстановления\n", (allBack - outageEnd) / 1000.0);
+    CHECK(allBack > outageEnd);
+    CHECK(allBack - outageEnd <= MQTT_BACKOFF_MAX + NETWORK_TASK_PERIOD + 4 * LATENCY);
+
+    // Команды, отправленные во время отказа, брокер доставил после переподключения.
+    // Пачкой: у помпы с пятью и больше командами первые вытесняются из кольца
+    // ожидания (MQTT_PENDING_COMMANDS) раньше, чем задача публикации их подтвердит
+    fleet.getCommander()->stop();
+    fleet.run(outageEnd + 2 * MQTT_BACKOFF_MAX, outageEnd + 3 * MQTT_BACKOFF_MAX);
+    printf("  без подтверждения %zu из %lu (вытеснены до ответа: %lu)\n",
+           fleet.getUnanswered(), stats.commandsSent, stats.evictedUnanswered);
+    CHECK(stats.commandsReceived == stats.commandsSent);
+    CHECK(fleet.getUnanswered() == stats.evictedUnanswered);
+    CHECK(stats.reconnects == (unsigned long)config.devices);
+
+    // Неудачные попытки: отказ TCP за время обмена SYN/RST, паузы по backoffDelay()
+    bool refusedFast = true;
+    for (const SimAttempt& attempt : stats.attempts) {
+        if (attempt.result == MQTT_FAIL_TCP && attempt.end - attempt.start > 2 * LATENCY + NETWORK_TASK_PERIOD) {
+            refusedFast = false;
+        }
+    }
+    CHECK(refusedFast);
+    int checked = 0;
+    checkRetrySpacing(stats, config.devices, config.driftPpm, checked);
+    CHECK(checked > config.devices * 5);
+
+    // Счетчики помп по причинам сходятся с общими
+    unsigned long tcp = 0;
+    unsigned long lost = 0;
+    for (auto& pump : fleet.getPumps()) {
+        tcp += pump->getReconnect().getFailures(MQTT_FAIL_TCP);
+        lost += pump->getReconnect().getFailures(MQTT_FAIL_LOST);
+    }
+    CHECK(tcp == stats.failures[MQTT_FAIL_TCP]);
+    CHECK(lost == stats.failures[MQTT_FAIL_LOST]);
+}
+
+static void checkFault(SimBrokerFault fault, MqttFailReason reason, uint32_t latency) {
+    SimBroker broker(LATENCY);
+    broker.setFault(fault);
+    FleetConfig config;
+    config.devices = 8;
+    config.rate = 0;
+    config.seed = 3;
+    FleetSim fleet(config, memoryLinks(broker));
+    fleet.run(0, 3 * MINUTE);
+
+    const FleetStats& stats = fleet.getStats();
+    bool sameReason = !stats.attempts.empty();
+    bool sameLatency = true;
+    for (const SimAttempt& attempt : stats.attempts) {
+        if (attempt.result != reason) sameReason = false;
+        uint64_t took = attempt.end - attempt.start;
+        if (took < latency || took > latency + NETWORK_TASK_PERIOD) sameLatency = false;
+    }
+    CHECK(sameReason);
+    CHECK(sameLatency);
+    CHECK(stats.failures[reason] == stats.attempts.size());
+    CHECK(fleet.countConnected() == 0);
+
+    // Длительность попытки по часам помпы (MqttReconnect) - та же
+    for (auto& pump : fleet.getPumps()) {
+        CHECK(pump->getReconnect().getMaxLatency() <= latency + NETWORK_TASK_PERIOD + 1);
+        CHECK(pump->getReconnect().getLastFailReason() == reason);
+    }
+
+    int checked = 0;
+    checkRetrySpacing(stats, config.devices, config.driftPpm, checked);
+    CHECK(checked > 0);
+}
+
+static void testConnectFaults() {
+    checkFault(SIM_BROKER_REFUSED, MQTT_FAIL_TCP, 2 * LATENCY);
+    checkFault(SIM_BROKER_BLACKHOLE, MQTT_FAIL_TCP, MQTT_TCP_TIMEOUT);
+    checkFault(SIM_BROKER_SILENT, MQTT_FAIL_TIMEOUT, 2 * LATENCY + MQTT_CONNACK_TIMEOUT * 1000);
+    checkFault(SIM_BROKER_DENY, MQTT_FAIL_REFUSED, 4 * LATENCY);
+}
+
+static void testTopicFilters() {
+    CHECK(simTopicMatches("/devices/+/ack", "/devices/pump-02A1B2C30000/ack"));
+    CHECK(!simTopicMatches("/devices/+/ack", "/devices/pump/sub/ack"));
+    CHECK(!simTopicMatches("/devices/+/ack", "/devices/pump/acks"));
+    CHECK(simTopicMatches("/devices/#", "/devices/pump/telemetry"));
+    CHECK(simTopicMatches("/devices/pump/filling", "/devices/pump/filling"));
+    CHECK(!simTopicMatches("/devices/pump/filling", "/devices/pump/fill"));
+}
+
+int main() {
+    RUN_TEST(testTopicFilters);
+    RUN_TEST(testFleetLoad);
+    RUN_TEST(testLinkDrops);
+    RUN_TEST(testSharedClientId);
+    RUN_TEST(testBrokerOutage);
+    RUN_TEST(testConnectFaults);
+    return testSummary("fleet_sim");
+}
@@ -0,0 +1,120 @@
+// файл: test/test_flow_estimator.cpp
+// FlowEstimator на синтетических наливах: наклон, дисперсия, прогноз времени
+
+#include "test.h"
+#include "FlowEstimator.h"
+#include <random>
+
+#define SAMPLE_MS 12.5             // 80 SPS
+
+// Подать линейный налив rate г/с с шумом sigma от времени startMs
+static void feedRamp(FlowEstimator& flow, uint32_t startMs, double seconds, float base, float rate,
+                     float sigma, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> noise(0.0f, sigma > 0 ? sigma : 1.0f);
+    int samples = (int)(seconds * 1000.0 / SAMPLE_MS);
+    for (int i = 0; i < samples; i++) {
+        double t = i * SAMPLE_MS;
+        float w = base + rate * (float)(t / 1000.0) + (sigma > 0 ? noise(rng) : 0.0f);
+        flow.addSample(startMs + (uint32_t)t, w);
+    }
+}
+
+static void testNeedsSamples() {
+    FlowEstimator flow;
+    for (int i = 0; i < FLOW_MIN_SAMPLES - 1; i++) flow.addSample(i * 12, 100.0f + i);
+    CHECK(!flow.isValid());
+    CHECK(flow.getRate() == 0.0f);
+    CHECK(flow.getTimeToTarget(500.0f) == -1.0f);
+}
+
+static void testCleanRamp() {
+    FlowEstimator flow;
+    feedRamp(flow, 1000, 3.0, 800.0f, 40.0f, 0.0f, 1);
+    CHECK(flow.isValid());
+    CHECK_NEAR(flow.getRate(), 40.0, 1e-3);
+    CHECK_NEAR(flow.getRateVariance(), 0.0, 1e-4);   // Только ошибка округления float
+
+    // Последний вес ~ 800 + 40 * 2.9875 = 919.5; до 1119.5 г ровно 5 с
+    float last = 800.0f + 40.0f * (float)((int)(3000.0 / SAMPLE_MS) - 1) * (float)SAMPLE_MS / 1000.0f;
+    CHECK_NEAR(flow.getTimeToTarget(last + 200.0f), 5.0, 0.01);
+    CHECK(flow.getTimeToTarget(last - 10.0f) == 0.0f);
+}
+
+static void testNoisyRamp() {
+    // Шум 2 г (как после медианы): оценка несмещенная, а ее разброс по
+    // многим наливам совпадает с дисперсией, которую сообщает оценщик
+    const int runs = 400;
+    double sumError = 0, sumError2 = 0, sumReported = 0;
+    for (int run = 0; run < runs; run++) {
+        FlowEstimator flow;
+        feedRamp(flow, 5000, 4.0, 600.0f, 35.0f, 2.0f, run + 1);
+        double error = flow.getRate() - 35.0;
+        sumError += error;
+        sumError2 += error * error;
+        sumReported += flow.getRateVariance();
+    }
+    double bias = sumError / runs;
+    double empirical = sumError2 / runs - bias * bias;
+    double reported = sumReported / runs;
+
+    // Теория: sigma^2 / Sxx, Sxx ~ n * T^2 / 12 для окна T = 1.5 с
+    double n = 1500.0 / SAMPLE_MS;
+    double theory = 4.0 / (n * 1.5 * 1.5 / 12.0);
+    printf("  смещение %.3f г/с, разброс %.3f, оценщик %.3f, теория %.3f (г/с)^2\n",
+           bias, empirical, reported, theory);
+
+    CHECK(fabs(bias) < 4 * sqrt(theory / runs));
+    CHECK(reported > theory * 0.8 && reported < theory * 1.25);
+    CHECK(empirical > reported * 0.75 && empirical < reported * 1.33);
+}
+
+static void testFlowStops() {
+    // Налив остановился: через окно (1.5 с) наклон возвращается к нулю
+    FlowEstimator flow;
+    feedRamp(flow, 0, 2.0, 500.0f, 30.0f, 0.0f, 1);
+    CHECK_NEAR(flow.getRate(), 30.0, 1e-3);
+
+    float stopWeight = 500.0f + 30.0f * 1.9875f;
+    for (int i = 0; i < (int)(1600 / SAMPLE_MS); i++) {
+        flow.addSample(2000 + (uint32_t)(i * SAMPLE_MS), stopWeight);
+    }
+    CHECK_NEAR(flow.getRate(), 0.0, 1e-3);
+    CHECK(flow.getTimeToTarget(stopWeight + 100.0f) == -1.0f);
+}
+
+static void testRampAcrossWrap() {
+    // Переполнение millis() через ~49.7 суток не ломает оценку
+    FlowEstimator flow;
+    feedRamp(flow, 0xFFFFFFFFu - 1000u, 3.0, 700.0f, 25.0f, 0.0f, 1);
+    CHECK(flow.isValid());
+    CHECK_NEAR(flow.getRate(), 25.0, 1e-3);
+}
+
+static void testLongRunRebase() {
+    // Час работы: начало отсчета переносится, точность не теряется
+    FlowEstimator flow;
+    for (uint32_t t = 0; t < 3600u * 1000u; t += 50) flow.addSample(t, 900.0f);
+    feedRamp(flow, 3600u * 1000u, 2.0, 900.0f, 45.0f, 0.0f, 1);
+    CHECK_NEAR(flow.getRate(), 45.0, 1e-3);
+}
+
+static void testWindowCapacity() {
+    // Окно длиннее емкости: хранится не больше FLOW_MAX_SAMPLES отсчетов,
+    // оценка идет по последним из них
+    FlowEstimator flow(10000);
+    feedRamp(flow, 0, 5.0, 0.0f, 10.0f, 0.0f, 1);
+    feedRamp(flow, 5000, 2.0, 50.0f, 60.0f, 0.0f, 1);
+    CHECK_NEAR(flow.getRate(), 60.0, 1e-3);
+}
+
+int main() {
+    RUN_TEST(testNeedsSamples);
+    RUN_TEST(testCleanRamp);
+    RUN_TEST(testNoisyRamp);
+    RUN_TEST(testFlowStops);
+    RUN_TEST(testRampAcrossWrap);
+    RUN_TEST(testLongRunRebase);
+    RUN_TEST(testWindowCapacity);
+    return testSummary("flow_estimator");
+}
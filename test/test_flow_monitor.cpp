@@ -0,0 +1,102 @@
+// файл: test/test_flow_monitor.cpp
+// FlowMonitor на синтетических наливах: нет потока, бак пустеет, медленная заливка трубки
+
+#include "test.h"
+#include "FlowMonitor.h"
+#include <functional>
+#include <random>
+
+#define SAMPLE_MS 12.5             // 80 SPS
+#define NOISE_G 1.0f               // Шум веса после медианного фильтра
+
+struct Trip {
+    FlowCheck check;
+    unsigned long atMs;            // Время от включения помпы (0 - не сработал)
+};
+
+/**
+ * Прогнать налив длительностью seconds: weight(t) - вес в момент t (с) от включения помпы.
+ * Помпа включается через 1 с покоя (как после поворота серво)
+ */
+static Trip runFill(double seconds, const std::function<float(double)>& weight, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> noise(0.0f, NOISE_G);
+    FlowEstimator flow;
+    FlowMonitor monitor;
+
+    const unsigned long start = 100000;
+    int before = (int)(1000.0 / SAMPLE_MS);
+    int total = (int)(seconds * 1000.0 / SAMPLE_MS);
+    for (int i = -before; i < total; i++) {
+        double t = i * SAMPLE_MS / 1000.0;
+        stubMillis() = start + (long)(i * SAMPLE_MS);
+        flow.addSample(stubMillis(), weight(t < 0 ? 0 : t) + noise(rng));
+        if (i == 0) monitor.arm();
+        if (i < 0) continue;
+
+        FlowCheck check = monitor.update(flow);
+        if (check != FLOW_CHECK_OK) return { check, monitor.getArmedTime() };
+    }
+    return { FLOW_CHECK_OK, 0 };
+}
+
+static void testNoFlow() {
+    // Вода не пошла: срабатывание не раньше PRIME + CONFIRM и раньше запасного таймаута
+    for (unsigned seed = 1; seed <= 20; seed++) {
+        Trip trip = runFill(8.0, [](double) { return 900.0f; }, seed);
+        CHECK(trip.check == FLOW_CHECK_NO_FLOW);
+        CHECK(trip.atMs >= NO_FLOW_PRIME_TIME + NO_FLOW_CONFIRM_TIME);
+        CHECK(trip.atMs < NO_FLOW_TIMEOUT);
+    }
+}
+
+static void testSlowPrime() {
+    // Сухая трубка: вода доходит до чайника через 2.5 с, дальше 30 г/с -
+    // при прежних 1500 + 800 мс это было ложное "нет воды"
+    for (unsigned seed = 1; seed <= 20; seed++) {
+        Trip trip = runFill(20.0, [](double t) {
+            return 900.0f + (t > 2.5 ? 30.0f * (float)(t - 2.5) : 0.0f);
+        }, seed);
+        CHECK(trip.check == FLOW_CHECK_OK);
+    }
+}
+
+static void testReservoirEmpties() {
+    // Поток был и резко пропал: бак пуст, а не "нет воды"
+    Trip trip = runFill(15.0, [](double t) {
+        double pumping = t < 1.0 ? 0.0 : (t < 8.0 ? t - 1.0 : 7.0);
+        return 900.0f + 30.0f * (float)pumping;
+    }, 7);
+    CHECK(trip.check == FLOW_CHECK_DRY);
+    CHECK(trip.atMs > 8000 && trip.atMs < 8000 + 1500 + NO_FLOW_CONFIRM_TIME);
+}
+
+static void testFlowDecays() {
+    // Поток упал до 20% пика и держится - бак пустеет (воздух в заборе)
+    Trip trip = runFill(20.0, [](double t) {
+        if (t < 1.0) return 900.0f;
+        if (t < 8.0) return 900.0f + 30.0f * (float)(t - 1.0);
+        return 900.0f + 210.0f + 6.0f * (float)(t - 8.0);
+    }, 9);
+    CHECK(trip.check == FLOW_CHECK_DRY);
+    CHECK(trip.atMs > 8000 + DRY_CONFIRM_TIME && trip.atMs < 8000 + 1500 + DRY_CONFIRM_TIME + 500);
+}
+
+static void testSteadyFill() {
+    // Обычный налив 25 г/с с шумом: ни одного срабатывания за минуту
+    for (unsigned seed = 1; seed <= 5; seed++) {
+        Trip trip = runFill(60.0, [](double t) {
+            return 800.0f + (t > 1.0 ? 25.0f * (float)(t - 1.0) : 0.0f);
+        }, seed);
+        CHECK(trip.check == FLOW_CHECK_OK);
+    }
+}
+
+int main() {
+    RUN_TEST(testNoFlow);
+    RUN_TEST(testSlowPrime);
+    RUN_TEST(testReservoirEmpties);
+    RUN_TEST(testFlowDecays);
+    RUN_TEST(testSteadyFill);
+    return testSummary("flow_monitor");
+}
@@ -0,0 +1,157 @@
+// файл: test/test_json_writer.cpp
+// JsonWriter: экранирование, запятые и вложенность, переполнение буфера и сброс чанками
+
+#include "test.h"
+#include "JsonWriter.h"
+#include <string.h>
+#include <string>
+
+// Сброс в строку: имитирует отправку чанков HTTP ответа
+struct Chunks {
+    std::string text;
+    int count = 0;
+    size_t largest = 0;
+};
+
+static void collect(void* context, const char* data, size_t length) {
+    Chunks* chunks = (Chunks*)context;
+    chunks->text.append(data, length);
+    chunks->count++;
+    if (length > chunks->largest) chunks->largest = length;
+}
+
+// Документ, похожий на /api/status: строки с экранированием, числа, массивы
+static void writeSample(JsonWriter& json) {
+    json.beginObject();
+    json.field("state", "FILLING");
+    json.field("ssid", "Дом \"5G\"\\2");
+    json.field("weight", 1432.456, 1);
+    json.field("uptime", 81234UL);
+    json.field("ready", true);
+    json.beginArray("samples");
+    for (int i = 0; i < 40; i++) {
+        json.beginArray();
+        json.value(i * 100);
+        json.value(1400.0 + i, 1);
+        json.endArray();
+    }
+    json.endArray();
+    json.beginObject("tasks");
+    json.field("control", 20);
+    json.nullField("network");
+    json.endObject();
+    json.endObject();
+}
+
+static void testEscaping() {
+    char buf[128];
+    JsonWriter json(buf, sizeof(buf));
+    json.beginObject();
+    json.field("q\"k", "a\"b\\c");
+    json.field("ws", "l1\nl2\r\tx");
+    json.field("ctl", "\x01\x1f");
+    json.field("utf", "чайник");
+    json.field("none", (const char*)nullptr);
+    json.endObject();
+    CHECK(json.finish() == strlen(buf));
+    CHECK(strcmp(buf, "{\"q\\\"k\":\"a\\\"b\\\\c\",\"ws\":\"l1\\nl2\\r\\tx\","
+                      "\"ctl\":\"\\u0001\\u001f\",\"utf\":\"чайник\",\"none\":null}") == 0);
+}
+
+static void testNumbersAndStructure() {
+    char buf[128];
+    JsonWriter json(buf, sizeof(buf));
+    json.beginObject();
+    json.field("f", 12.345, 1);
+    json.field("nan", (double)NAN);
+    json.field("inf", (double)INFINITY, 1);
+    json.field("neg", -5);
+    json.beginArray("a");
+    json.beginArray();
+    json.endArray();
+    json.beginObject();
+    json.endObject();
+    json.value("x");
+    json.endArray();
+    json.endObject();
+    CHECK(json.finish() > 0);
+    CHECK(strcmp(buf, "{\"f\":12.3,\"nan\":null,\"inf\":null,\"neg\":-5,\"a\":[[],{},\"x\"]}") == 0);
+}
+
+static void testTruncation() {
+    // Ровно по размеру: 7 символов и нулевой байт
+    char exact[8];
+    JsonWriter fits(exact, sizeof(exact));
+    fits.beginObject();
+    fits.field("a", 1);
+    fits.endObject();
+    CHECK(fits.finish() == 7);
+    CHECK(strcmp(exact, "{\"a\":1}") == 0);
+
+    // На байт меньше - переполнение, а не обрезанный JSON
+    char small[7];
+    JsonWriter cut(small, sizeof(small));
+    cut.beginObject();
+    cut.field("a", 1);
+    cut.endObject();
+    CHECK(cut.overflowed());
+    CHECK(cut.finish() == 0);
+    CHECK(small[0] == '\0');
+
+    // Переполнение в середине экранирования тоже не оставляет текста
+    char tiny[10];
+    JsonWriter escaped(tiny, sizeof(tiny));
+    escaped.beginObject();
+    escaped.field("k", "\"\"\"\"");
+    escaped.endObject();
+    CHECK(escaped.finish() == 0);
+    CHECK(tiny[0] == '\0');
+
+    // Буфер меньше двух байт непригоден
+    char one[1];
+    JsonWriter none(one, sizeof(one));
+    CHECK(none.overflowed());
+}
+
+static void testDepthLimit() {
+    char buf[128];
+    JsonWriter json(buf, sizeof(buf));
+    for (int i = 0; i <= JSON_WRITER_DEPTH; i++) json.beginArray();
+    CHECK(json.overflowed());
+    CHECK(json.finish() == 0);
+}
+
+static void testChunkedFlush() {
+    // Эталон - целиком в большом буфере
+    char whole[2048];
+    JsonWriter reference(whole, sizeof(whole));
+    writeSample(reference);
+    size_t length = reference.finish();
+    CHECK(length > 500);
+
+    // Через окно 32 байта - тот же текст, без переполнения, чанки не больше окна
+    char window[32];
+    Chunks chunks;
+    JsonWriter json(window, sizeof(window), collect, &chunks);
+    writeSample(json);
+    CHECK(!json.overflowed());
+    CHECK(json.finish() == length);
+    CHECK(chunks.text == std::string(whole));
+    CHECK(chunks.count >= (int)(length / sizeof(window)));
+    CHECK(chunks.largest <= sizeof(window));
+
+    // Пустой остаток не сбрасывается лишним чанком
+    Chunks single;
+    JsonWriter empty(window, sizeof(window), collect, &single);
+    CHECK(empty.finish() == 0);
+    CHECK(single.count == 0);
+}
+
+int main() {
+    RUN_TEST(testEscaping);
+    RUN_TEST(testNumbersAndStructure);
+    RUN_TEST(testTruncation);
+    RUN_TEST(testDepthLimit);
+    RUN_TEST(testChunkedFlush);
+    return testSummary("json_writer");
+}
@@ -0,0 +1,154 @@
+// файл: test/test_level_quantizer.cpp
+// Уровень воды для MQTT: шум у порогов не вызывает серию публикаций,
+// границы гистерезиса и удержания, подавленные выбросы
+
+#include "test.h"
+#include "config.h"
+#include "LevelQuantizer.h"
+#include <random>
+
+#define TRACE_PERIOD 100               // Публикация уровня воды - раз в 100 мс
+#define TRACE_SAMPLES 6000             // 10 минут
+#define TRACE_NOISE 8.0f               // СКО шума объема (мл)
+
+static const float THRESHOLDS[2] = { WATER_LEVEL_EMPTY, WATER_LEVEL_LOW };
+
+// Прежний расчет: уровень по порогам без гистерезиса и удержания
+static int oldWaterState(float volumeML) {
+    if (volumeML < WATER_LEVEL_EMPTY) return 0;
+    if (volumeML <= WATER_LEVEL_LOW) return 1;
+    return 2;
+}
+
+struct Publishes {
+    uint32_t before = 0;
+    uint32_t after = 0;
+};
+
+// Публикации как в publishWaterState(): только при смене уровня, первая - всегда
+static Publishes replayNoisyTrace(float center, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> noise(0.0f, TRACE_NOISE);
+    LevelQuantizer<3> quantizer(THRESHOLDS, WATER_LEVEL_HYSTERESIS, WATER_LEVEL_DWELL);
+
+    Publishes count;
+    int lastOld = -1;
+    int lastNew = -1;
+    for (uint32_t i = 0; i < TRACE_SAMPLES; i++) {
+        float volume = center + noise(rng);
+        int oldState = oldWaterState(volume);
+        int newState = quantizer.update(volume, i * TRACE_PERIOD);
+        if (oldState != lastOld) { count.before++; lastOld = oldState; }
+        if (newState != lastNew) { count.after++; lastNew = newState; }
+    }
+    return count;
+}
+
+static void testNoisyTraces() {
+    Publishes empty = replayNoisyTrace(495.0f, 1);
+    Publishes low = replayNoisyTrace(1003.0f, 2);
+    printf("  около 495 мл: %u публикаций -> %u, около 1003 мл: %u -> %u\n",
+           empty.before, empty.after, low.before, low.after);
+
+    // Шум 8 мл у порога: прежний расчет публикует больше трети отсчетов
+    CHECK(empty.before > TRACE_SAMPLES / 3);
+    CHECK(low.before > TRACE_SAMPLES / 3);
+    CHECK(empty.after == 1);
+    CHECK(low.after == 1);
+}
+
+static void testFillRamp() {
+    // Налив 400 -> 1200 мл за 40 с с тем же шумом: ровно два перехода
+    std::mt19937 rng(3);
+    std::normal_distribution<float> noise(0.0f, TRACE_NOISE);
+    LevelQuantizer<3> quantizer(THRESHOLDS, WATER_LEVEL_HYSTERESIS, WATER_LEVEL_DWELL);
+
+    int levels[3] = { 0, 0, 0 };
+    int last = -1;
+    int published = 0;
+    uint32_t now = 0;
+    for (int i = 0; i <= 400; i++, now += TRACE_PERIOD) {
+        int level = quantizer.update(400.0f + 2.0f * i + noise(rng), now);
+        if (level != last) { published++; last = level; }
+    }
+    for (int i = 0; i < 50; i++, now += TRACE_PERIOD) {     // Отстоялся на 1200 мл
+        int level = quantizer.update(1200.0f + noise(rng), now);
+        levels[level]++;
+        if (level != last) { published++; last = level; }
+    }
+    CHECK(quantizer.getChanges() == 2);
+    CHECK(published == 3);                 // Первое значение и два перехода
+    CHECK(levels[2] == 50);
+}
+
+static void testHysteresisEdges() {
+    LevelQuantizer<3> q(THRESHOLDS, WATER_LEVEL_HYSTERESIS, 0);    // Без удержания
+
+    CHECK(q.update(700.0f, 0) == 1);
+
+    // Вверх - только от порога + гистерезис
+    CHECK(q.update(WATER_LEVEL_LOW + WATER_LEVEL_HYSTERESIS - 0.5f, 1) == 1);
+    CHECK(q.update(WATER_LEVEL_LOW + WATER_LEVEL_HYSTERESIS, 2) == 2);
+
+    // Вниз - только ниже порог - гистерезис
+    CHECK(q.update(WATER_LEVEL_LOW - WATER_LEVEL_HYSTERESIS, 3) == 2);
+    CHECK(q.update(WATER_LEVEL_LOW - WATER_LEVEL_HYSTERESIS - 0.5f, 4) == 1);
+
+    // Внутри полосы уровень не меняется ни в одну сторону
+    CHECK(q.update(WATER_LEVEL_EMPTY - WATER_LEVEL_HYSTERESIS, 5) == 1);
+    CHECK(q.update(WATER_LEVEL_EMPTY - WATER_LEVEL_HYSTERESIS - 0.5f, 6) == 0);
+    CHECK(q.update(WATER_LEVEL_EMPTY + WATER_LEVEL_HYSTERESIS - 0.5f, 7) == 0);
+
+    // Скачок через оба порога - сразу на крайний уровень
+    CHECK(q.update(1500.0f, 8) == 2);
+    CHECK(q.update(0.0f, 9) == 0);
+    CHECK(q.getChanges() == 5);
+    CHECK(q.getSuppressed() == 0);
+}
+
+static void testDwellEdges() {
+    LevelQuantizer<3> q(THRESHOLDS, WATER_LEVEL_HYSTERESIS, WATER_LEVEL_DWELL);
+    CHECK(q.update(700.0f, 1000) == 1);
+
+    // Новый уровень принимается ровно через WATER_LEVEL_DWELL
+    CHECK(q.update(1100.0f, 2000) == 1);
+    CHECK(q.update(1100.0f, 2000 + WATER_LEVEL_DWELL - 1) == 1);
+    CHECK(q.update(1100.0f, 2000 + WATER_LEVEL_DWELL) == 2);
+    CHECK(q.getChanges() == 1);
+
+    // Выброс короче удержания подавлен и учтен
+    uint32_t t = 10000;
+    CHECK(q.update(700.0f, t) == 2);
+    CHECK(q.update(700.0f, t + WATER_LEVEL_DWELL - 100) == 2);
+    CHECK(q.update(1100.0f, t + WATER_LEVEL_DWELL - 50) == 2);
+    CHECK(q.getSuppressed() == 1);
+    CHECK(q.getChanges() == 1);
+
+    // Смена кандидата начинает удержание заново: 700 -> 300 мл
+    t = 20000;
+    CHECK(q.update(700.0f, t) == 2);
+    CHECK(q.update(300.0f, t + 1500) == 2);
+    CHECK(q.getSuppressed() == 2);
+    CHECK(q.update(300.0f, t + 1500 + WATER_LEVEL_DWELL - 1) == 2);
+    CHECK(q.update(300.0f, t + 1500 + WATER_LEVEL_DWELL) == 0);
+
+    // После reset() (чайник сняли и вернули) - уровень сразу
+    q.reset();
+    CHECK(q.update(1100.0f, t + 5000) == 2);
+    CHECK(q.getLevel() == 2);
+    CHECK(q.getChanges() == 2);
+
+    // Переход millis() через ноль не ломает удержание
+    q.reset();
+    CHECK(q.update(700.0f, 0xFFFFFF00u) == 1);
+    CHECK(q.update(1100.0f, 0xFFFFFF80u) == 1);
+    CHECK(q.update(1100.0f, 0xFFFFFF80u + WATER_LEVEL_DWELL) == 2);
+}
+
+int main() {
+    RUN_TEST(testNoisyTraces);
+    RUN_TEST(testFillRamp);
+    RUN_TEST(testHysteresisEdges);
+    RUN_TEST(testDwellEdges);
+    return testSummary("level_quantizer");
+}
@@ -0,0 +1,240 @@
+// файл: test/test_mqtt_command.cpp
+// Команды MQTT: разбор кода и идентификатора, отсев повторов, маршруты - без обращений к куче
+
+#include "test.h"
+#include "MqttCommand.h"
+#include <new>
+#include <stdlib.h>
+
+// Счетчик выделений: разбор идет в обработчике сообщения, куча там запрещена
+static size_t heapAllocations = 0;
+
+void* operator new(size_t size) {
+    heapAllocations++;
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](size_t size) {
+    heapAllocations++;
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+static bool parse(const char* text, int& mode, char* id) {
+    return mqttParseFillingCommand((const uint8_t*)text, strlen(text), mode, id);
+}
+
+static void testParseUnsigned() {
+    int value = -1;
+    CHECK(mqttParseUnsigned((const uint8_t*)"7", 1, value) && value == 7);
+    CHECK(mqttParseUnsigned((const uint8_t*)" 42\r\n", 5, value) && value == 42);
+    CHECK(mqttParseUnsigned((const uint8_t*)"999999999", 9, value) && value == 999999999);
+    CHECK(!mqttParseUnsigned((const uint8_t*)"1000000000", 10, value));  // Больше 9 цифр
+    CHECK(!mqttParseUnsigned((const uint8_t*)"", 0, value));
+    CHECK(!mqttParseUnsigned((const uint8_t*)"  ", 2, value));
+    CHECK(!mqttParseUnsigned((const uint8_t*)"-1", 2, value));
+    CHECK(!mqttParseUnsigned((const uint8_t*)"2a", 2, value));
+    CHECK(!mqttParseUnsigned((const uint8_t*)"1 2", 3, value));
+    // Длина, а не нуль в конце: payload MQTT не завершается нулем
+    CHECK(mqttParseUnsigned((const uint8_t*)"35", 1, value) && value == 3);
+}
+
+static void testParseCommand() {
+    int mode;
+    char id[MQTT_COMMAND_ID_MAX];
+
+    CHECK(parse("2", mode, id) && mode == 2 && id[0] == '\0');
+    CHECK(parse("8:order-17", mode, id) && mode == 8 && strcmp(id, "order-17") == 0);
+    CHECK(parse(" 3 : a_B-9 ", mode, id) && mode == 3 && strcmp(id, "a_B-9") == 0);
+    CHECK(parse("1:0123456789abcdef", mode, id) && strcmp(id, "0123456789abcdef") == 0);
+
+    // Неверный код: код разобран (для подтверждения), но команда отклоняется
+    CHECK(!parse("0", mode, id));
+    CHECK(!parse("9:x", mode, id) && mode == 9);
+    CHECK(!parse("", mode, id));
+    CHECK(!parse(":x", mode, id));
+    CHECK(!parse("two", mode, id));
+
+    // Неверный идентификатор: пустой, длинный, чужие символы - id пуст
+    CHECK(!parse("2:", mode, id) && id[0] == '\0');
+    CHECK(!parse("2:0123456789abcdefg", mode, id) && id[0] == '\0');
+    CHECK(!parse("2:a\"b", mode, id) && id[0] == '\0');
+    CHECK(!parse("2:a:b", mode, id) && id[0] == '\0');
+    CHECK(!parse("2:чай", mode, id) && id[0] == '\0');
+}
+
+static void testRecentIds() {
+    RecentCommandIds recent;
+    CHECK(!recent.contains(""));           // Пустые слоты не совпадают с командой без id
+    recent.remember("a");
+    CHECK(recent.contains("a"));
+    CHECK(!recent.contains("b"));
+
+    // Кольцо: девятый идентификатор вытесняет первый
+    char id[MQTT_COMMAND_ID_MAX];
+    for (int i = 0; i < MQTT_RECENT_IDS; i++) {
+        snprintf(id, sizeof(id), "id%d", i);
+        recent.remember(id);
+    }
+    CHECK(!recent.contains("a"));
+    CHECK(recent.contains("id0") && recent.contains("id7"));
+
+    // Восстановление из флеша: те же строки и голова
+    RecentCommandIds restored;
+    memcpy(restored.storage(), recent.storage(), RecentCommandIds::storageSize());
+    restored.restore(recent.getHead() + MQTT_RECENT_IDS);   // Голова приводится в диапазон
+    CHECK(restored.getHead() == recent.getHead());
+    CHECK(restored.contains("id7"));
+    restored.remember("next");
+    CHECK(!restored.contains("id0"));
+}
+
+// Исполнитель: принимает команды, пока очередь не полна
+struct Executor {
+    bool queueFull = false;
+    int executed = 0;
+    int lastMode = 0;
+
+    bool operator()(int mode, const char*) {
+        if (queueFull) return false;
+        executed++;
+        lastMode = mode;
+        return true;
+    }
+};
+
+static MqttCommandStatus accept(const char* text, RecentCommandIds& recent, Executor& executor) {
+    int mode;
+    char id[MQTT_COMMAND_ID_MAX];
+    return mqttAcceptFillingCommand((const uint8_t*)text, strlen(text), recent, mode, id,
+                                    [&executor](int m, const char* commandId) {
+                                        return executor(m, commandId);
+                                    });
+}
+
+static void testAcceptAndDuplicate() {
+    RecentCommandIds recent;
+    Executor executor;
+    CHECK(accept("2:order-17", recent, executor) == MQTT_COMMAND_ACCEPTED);
+    CHECK(accept("2:order-17", recent, executor) == MQTT_COMMAND_DUPLICATE);
+    CHECK(executor.executed == 1);
+
+    // Без идентификатора повторы не отсеиваются
+    CHECK(accept("8", recent, executor) == MQTT_COMMAND_ACCEPTED);
+    CHECK(accept("8", recent, executor) == MQTT_COMMAND_ACCEPTED);
+    CHECK(executor.executed == 3 && executor.lastMode == 8);
+
+    CHECK(accept("2:bad id", recent, executor) == MQTT_COMMAND_INVALID);
+    CHECK(executor.executed == 3);
+}
+
+static void testRejectedRetryRuns() {
+    // Очередь событий полна: команда отклонена, ее id не запомнен
+    RecentCommandIds recent;
+    Executor executor;
+    executor.queueFull = true;
+    CHECK(accept("3:retry-1", recent, executor) == MQTT_COMMAND_REJECTED);
+    CHECK(!recent.contains("retry-1"));
+
+    // Отправитель повторяет с тем же id - налив выполняется, а не "duplicate"
+    executor.queueFull = false;
+    CHECK(accept("3:retry-1", recent, executor) == MQTT_COMMAND_ACCEPTED);
+    CHECK(executor.executed == 1 && executor.lastMode == 3);
+    CHECK(accept("3:retry-1", recent, executor) == MQTT_COMMAND_DUPLICATE);
+}
+
+static void testFormatAck() {
+    char out[96];
+    CHECK(mqttFormatAck(out, sizeof(out), "order-17", 2, "accepted", 1234) > 0);
+    CHECK(strcmp(out, "{\"id\":\"order-17\",\"mode\":2,\"status\":\"accepted\",\"t\":1234}") == 0);
+    size_t length = mqttFormatAck(out, sizeof(out), "", 9, "completed", 5, 499.6f);
+    CHECK(strcmp(out, "{\"id\":\"\",\"mode\":9,\"status\":\"completed\",\"t\":5,\"volume\":500}") == 0);
+    CHECK(length == strlen(out));
+
+    // Не помещается - 0, обрезанный JSON не отправляется
+    char small[40];
+    CHECK(mqttFormatAck(small, sizeof(small), "order-17", 2, "accepted", 1234) == 0);
+    CHECK(mqttFormatAck(out, 53, "", 9, "completed", 5, 499.6f) == 0);
+}
+
+// Маршрут как в MQTTManager: обработчик - указатель на функцию
+struct Route {
+    const char* topic;
+    size_t length;
+    int handler;
+};
+
+static void testMatchRoute() {
+    static const char filling[] = "/devices/pump/filling";
+    static const char config[] = "/devices/pump/config";
+    Route routes[] = {
+        { filling, strlen(filling), 1 },
+        { config, strlen(config), 2 },
+    };
+    const Route* route = mqttMatchRoute(routes, 2, "/devices/pump/filling");
+    CHECK(route && route->handler == 1);
+    route = mqttMatchRoute(routes, 2, "/devices/pump/config");
+    CHECK(route && route->handler == 2);
+    CHECK(mqttMatchRoute(routes, 2, "/devices/pump/fillin") == nullptr);     // Префикс
+    CHECK(mqttMatchRoute(routes, 2, "/devices/pump/filling/x") == nullptr);  // Длиннее
+    CHECK(mqttMatchRoute(routes, 2, "/devices/pump/fillinG") == nullptr);    // Та же длина
+    CHECK(mqttMatchRoute(routes, 0, "/devices/pump/filling") == nullptr);
+}
+
+static void testNoHeap() {
+    // Весь путь сообщения: маршрут, разбор, отсев повторов и передача
+    static const char filling[] = "/devices/pump/filling";
+    Route routes[] = { { filling, strlen(filling), 1 } };
+    static const char* payloads[] = {
+        "1", "7:abc", "8:order-17", " 2 ", "9", "2:bad id", "3:0123456789abcdefXYZ", ""
+    };
+    RecentCommandIds recent;
+    Executor executor;
+    char id[MQTT_COMMAND_ID_MAX];
+    int mode = 0;
+
+    size_t before = heapAllocations;
+    int matched = 0;
+    for (int i = 0; i < 10000; i++) {
+        const char* payload = payloads[i % 8];
+        if (mqttMatchRoute(routes, 1, filling)) matched++;
+        if (i % 3 == 0) {
+            snprintf(id, sizeof(id), "%d:n%d", 1 + i % 8, i);
+            accept(id, recent, executor);
+        } else {
+            accept(payload, recent, executor);
+        }
+        mqttParseFillingCommand((const uint8_t*)payload, strlen(payload), mode, id);
+    }
+    size_t allocations = heapAllocations - before;
+    printf("  10000 сообщений: %zu выделений памяти, выполнено %d команд\n",
+           allocations, executor.executed);
+    CHECK(matched == 10000);
+    CHECK(executor.executed > 3000);
+    CHECK(allocations == 0);
+
+    // Счетчик работает: иначе проверка выше ничего не доказывает
+    char* volatile probe = new char[16];
+    CHECK(heapAllocations == before + 1);
+    delete[] probe;
+}
+
+int main() {
+    RUN_TEST(testParseUnsigned);
+    RUN_TEST(testParseCommand);
+    RUN_TEST(testRecentIds);
+    RUN_TEST(testAcceptAndDuplicate);
+    RUN_TEST(testRejectedRetryRuns);
+    RUN_TEST(testFormatAck);
+    RUN_TEST(testMatchRoute);
+    RUN_TEST(testNoHeap);
+    return testSummary("mqtt_command");
+}
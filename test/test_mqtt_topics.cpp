@@ -0,0 +1,76 @@
+// файл: test/test_mqtt_topics.cpp
+// Имя устройства, Client ID и топики MQTT: формат, MAC и переполнение буфера
+
+#include "test.h"
+#include "MqttTopics.h"
+
+// MQTT_ID_MAX и OUTBOX_TOPIC_MAX (MQTTManager.h и MqttOutbox.h тянут за собой WiFi и Preferences)
+#define ID_MAX 32
+#define TOPIC_MAX 64
+
+static void testMacHex() {
+    // ESP.getEfuseMac(): первый байт MAC - младший байт числа
+    char mac[MQTT_MAC_HEX_SIZE];
+    mqttMacHex(0x0000F6E5D4C3B2A1ull, mac);
+    CHECK(strcmp(mac, "A1B2C3D4E5F6") == 0);
+    mqttMacHex(0xFFFF000000000001ull, mac);   // Старшие два байта не входят в MAC
+    CHECK(strcmp(mac, "010000000000") == 0);
+}
+
+static void testDefaultNames() {
+    char mac[MQTT_MAC_HEX_SIZE];
+    mqttMacHex(0x0000F6E5D4C3B2A1ull, mac);
+
+    // По умолчанию топики без MAC, как в прежних версиях
+    char device[ID_MAX];
+    CHECK(strcmp(MQTT_DEVICE_NAME, "pump") == 0);
+    CHECK(mqttDeviceName(device, sizeof(device), MQTT_DEVICE_NAME, nullptr));
+    CHECK(strcmp(device, "pump") == 0);
+
+    char topic[TOPIC_MAX];
+    CHECK(mqttTopic(topic, sizeof(topic), MQTT_TOPIC_ROOT, device, "filling"));
+    CHECK(strcmp(topic, "/devices/pump/filling") == 0);
+
+    // Client ID - всегда с MAC
+    char clientId[ID_MAX];
+    CHECK(mqttDeviceName(clientId, sizeof(clientId), MQTT_CLIENT_PREFIX, mac));
+    CHECK(strcmp(clientId, "smartpump-A1B2C3D4E5F6") == 0);
+}
+
+static void testPerMacNames() {
+    // MQTT_DEVICE_NAME_PER_MAC: свои топики у каждой помпы
+    char macA[MQTT_MAC_HEX_SIZE], macB[MQTT_MAC_HEX_SIZE];
+    mqttMacHex(0x0000F6E5D4C3B2A1ull, macA);
+    mqttMacHex(0x0000F6E5D4C3B2A2ull, macB);
+
+    char deviceA[ID_MAX], deviceB[ID_MAX];
+    CHECK(mqttDeviceName(deviceA, sizeof(deviceA), MQTT_DEVICE_NAME, macA));
+    CHECK(mqttDeviceName(deviceB, sizeof(deviceB), MQTT_DEVICE_NAME, macB));
+    CHECK(strcmp(deviceA, "pump-A1B2C3D4E5F6") == 0);
+    CHECK(strcmp(deviceA, deviceB) != 0);
+
+    // Самый длинный топик помещается в запись очереди
+    char topic[TOPIC_MAX];
+    CHECK(mqttTopic(topic, sizeof(topic), MQTT_TOPIC_ROOT, deviceA, "water_level"));
+    CHECK(strcmp(topic, "/devices/pump-A1B2C3D4E5F6/water_level") == 0);
+}
+
+static void testOverflow() {
+    // Не помещается - false и обрезанная, но завершенная нулем строка
+    char small[12];
+    CHECK(!mqttTopic(small, sizeof(small), "/devices", "pump", "water_level"));
+    CHECK(strlen(small) == sizeof(small) - 1);
+
+    char name[8];
+    CHECK(!mqttDeviceName(name, sizeof(name), "pump", "A1B2C3D4E5F6"));
+    CHECK(strcmp(name, "pump-A1") == 0);
+    CHECK(mqttDeviceName(name, sizeof(name), "pump", nullptr));
+}
+
+int main() {
+    RUN_TEST(testMacHex);
+    RUN_TEST(testDefaultNames);
+    RUN_TEST(testPerMacNames);
+    RUN_TEST(testOverflow);
+    return testSummary("mqtt_topics");
+}
@@ -0,0 +1,179 @@
+// файл: test/test_overshoot_model.cpp
+// Модель перелива на тысячах наливов с шумом потока и задержкой воды в трубке:
+// итоговая ошибка меньше и стабильнее, чем с постоянным порогом WEIGHT_HYST
+
+#include "test.h"
+#include "OvershootModel.h"
+#include <EEPROM.h>
+#include <random>
+
+// Помпа и трубка: перелив = вода в трубке + поток за время задержки фильтра
+#define SIM_TUBE_WATER 6.0f            // г
+#define SIM_LAG_START 0.8f             // Задержка (с) у новой трубки...
+#define SIM_LAG_END 1.0f               // ...и после износа к концу серии
+#define SIM_FLOW_MIN 12.0f             // Скорость потока от налива к наливу (г/с)
+#define SIM_FLOW_MAX 35.0f
+#define SIM_TICK 0.02f                 // Такт управления (с)
+#define SIM_FILLS 5000
+#define SIM_WARMUP 50                  // Наливы, пока модель обучается, не сравниваем
+
+struct ErrorStats {
+    uint32_t count = 0;
+    double mean = 0;
+    double m2 = 0;
+
+    void add(double x) {
+        count++;
+        double delta = x - mean;
+        mean += delta / count;
+        m2 += delta * (x - mean);
+    }
+
+    double stdDev() const { return count > 1 ? sqrt(m2 / (count - 1)) : 0; }
+};
+
+/**
+ * Серия наливов: useModel - выключение по прогнозу модели, иначе за WEIGHT_HYST до цели
+ * Весы и оценка потока шумят, поток внутри налива плавает, перелив тоже
+ */
+static ErrorStats simulate(OvershootModel& model, bool useModel, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> flowDist(SIM_FLOW_MIN, SIM_FLOW_MAX);
+    std::uniform_real_distribution<float> targetDist(200.0f, 1500.0f);
+    std::normal_distribution<float> flowJitter(0.0f, 0.6f);     // Пульсации помпы (г/с)
+    std::normal_distribution<float> flowNoise(0.0f, 0.8f);      // Ошибка оценки потока (г/с)
+    std::normal_distribution<float> scaleNoise(0.0f, 0.4f);     // Шум весов (г)
+    std::normal_distribution<float> tailNoise(0.0f, 1.0f);      // Разброс перелива (г)
+
+    ErrorStats stats;
+    for (int fill = 0; fill < SIM_FILLS; fill++) {
+        float lag = SIM_LAG_START + (SIM_LAG_END - SIM_LAG_START) * fill / SIM_FILLS;
+        float pumpFlow = flowDist(rng);
+        float target = targetDist(rng);
+        float weight = 0;
+        float measuredFlow = 0;
+        float measured = 0;
+
+        // Налив по тактам до порога выключения
+        for (;;) {
+            float flow = pumpFlow + flowJitter(rng);
+            weight += flow * SIM_TICK;
+            measured = weight + scaleNoise(rng);
+            measuredFlow = flow + flowNoise(rng);
+            float cutoff = target - (useModel ? model.predict(measuredFlow) : WEIGHT_HYST);
+            if (measured >= cutoff) break;
+        }
+
+        // После выключения: вода в трубке и задержка при последней скорости
+        float settled = weight + SIM_TUBE_WATER + pumpFlow * lag + tailNoise(rng);
+        float settledMeasured = settled + scaleNoise(rng);
+        float error = settledMeasured - target;
+        if (fill >= SIM_WARMUP) stats.add(error);
+
+        if (useModel) {
+            model.learn(measuredFlow, settledMeasured - measured, error);
+            model.saveToEEPROM(EEPROM_OVERSHOOT_ADDR);
+        }
+    }
+    return stats;
+}
+
+static void testModelBeatsFixedHysteresis() {
+    OvershootModel fixed;
+    OvershootModel learned;
+    ErrorStats baseline = simulate(fixed, false, 5);
+    ErrorStats model = simulate(learned, true, 5);
+
+    printf("  WEIGHT_HYST: ошибка %.1f ± %.1f г, модель: %.2f ± %.2f г (%u наливов)\n",
+           baseline.mean, baseline.stdDev(), model.mean, model.stdDev(), model.count);
+
+    // Постоянный порог недоливает на медленном потоке и переливает на быстром
+    CHECK(baseline.mean > 5.0);
+    CHECK(baseline.stdDev() > 4.0);
+
+    // Модель убирает смещение и зависимость от потока, остается шум и
+    // доля такта: порог пересекается между отсчетами весов
+    CHECK(fabs(model.mean) < 1.0);
+    CHECK(fabs(model.mean) < fabs(baseline.mean) / 5);
+    CHECK(model.stdDev() < baseline.stdDev() / 2);
+
+    // Своя статистика модели (с наливами до обучения) - того же порядка
+    CHECK(learned.isTrained());
+    CHECK(learned.getFills() == SIM_FILLS);
+    CHECK(fabs(learned.getErrorMean()) < 1.0);
+    CHECK(learned.getErrorStdDev() < baseline.stdDev() / 2);
+
+    // Прогноз следит за износом: задержка к концу серии SIM_LAG_END
+    CHECK_NEAR(learned.predict(20.0f), SIM_TUBE_WATER + 20.0f * SIM_LAG_END, 1.5);
+    CHECK_NEAR(learned.predict(30.0f), SIM_TUBE_WATER + 30.0f * SIM_LAG_END, 1.5);
+}
+
+static void testUntrainedAndLimits() {
+    OvershootModel model;
+    CHECK(!model.isTrained());
+    CHECK(model.predict(25.0f) == WEIGHT_HYST);
+
+    // Одна и та же скорость: наклон не определен - средний перелив
+    for (int i = 0; i < OVERSHOOT_MIN_FILLS; i++) model.learn(20.0f, 24.0f, 0.0f);
+    CHECK(model.isTrained());
+    CHECK_NEAR(model.predict(5.0f), 24.0, 0.01);
+    CHECK_NEAR(model.predict(40.0f), 24.0, 0.01);
+
+    // Прогноз ограничен OVERSHOOT_MAX и нулем
+    model.reset();
+    for (int i = 0; i < 10; i++) model.learn(10.0f + i, 10.0f * (10.0f + i) - 90.0f, 0.0f);
+    CHECK(model.predict(100.0f) == OVERSHOOT_MAX);
+    CHECK(model.predict(0.0f) == 0.0f);
+}
+
+static void testEepromPersistence() {
+    stubMillis() = 0;
+    uint32_t commitsBefore = EEPROM.getCommits();
+
+    // Во флеш - раз в OVERSHOOT_COMMIT_FILLS наливов, остальное ждет паузы
+    OvershootModel model;
+    for (int i = 0; i < 25; i++) {
+        model.learn(15.0f + i % 10, 20.0f + i % 10, 0.5f);
+        model.saveToEEPROM(EEPROM_OVERSHOOT_ADDR);
+    }
+    CHECK(EEPROM.getCommits() - commitsBefore == 2);
+    CHECK(model.getUncommittedFills() == 5);
+    CHECK(!model.commitToEEPROM(EEPROM_OVERSHOOT_ADDR));
+    stubMillis() += OVERSHOOT_COMMIT_IDLE;
+    CHECK(model.commitToEEPROM(EEPROM_OVERSHOOT_ADDR));
+    CHECK(model.getUncommittedFills() == 0);
+    CHECK(!model.commitToEEPROM(EEPROM_OVERSHOOT_ADDR, true));   // Нечего писать
+
+    // После перезагрузки - та же модель
+    EEPROM.reboot();
+    OvershootModel restored;
+    restored.loadFromEEPROM(EEPROM_OVERSHOOT_ADDR);
+    CHECK(restored.getFills() == 25);
+    CHECK_NEAR(restored.predict(22.0f), model.predict(22.0f), 0.001);
+    CHECK_NEAR(restored.getErrorMean(), 0.5, 0.001);
+
+    // Незаписанные наливы теряются при внезапной перезагрузке
+    model.learn(20.0f, 25.0f, 0.0f);
+    model.saveToEEPROM(EEPROM_OVERSHOOT_ADDR);
+    EEPROM.reboot();
+    restored.loadFromEEPROM(EEPROM_OVERSHOOT_ADDR);
+    CHECK(restored.getFills() == 25);
+
+    // Чужие данные - модель сбрасывается на гистерезис
+    EEPROM.data()[EEPROM_OVERSHOOT_ADDR] = 0;
+    restored.loadFromEEPROM(EEPROM_OVERSHOOT_ADDR);
+    CHECK(restored.getFills() == 0);
+    CHECK(restored.predict(22.0f) == WEIGHT_HYST);
+
+    // Адрес за пределами EEPROM_SIZE - не пишем
+    uint32_t commits = EEPROM.getCommits();
+    model.commitToEEPROM(EEPROM_SIZE - 4, true);
+    CHECK(EEPROM.getCommits() == commits);
+}
+
+int main() {
+    RUN_TEST(testModelBeatsFixedHysteresis);
+    RUN_TEST(testUntrainedAndLimits);
+    RUN_TEST(testEepromPersistence);
+    return testSummary("overshoot_model");
+}
@@ -0,0 +1,130 @@
+// файл: test/test_sampling_ring.cpp
+// Поток отсчетов HX711 (80 SPS) через SpscRingBuffer: без потерь и с ограниченной задержкой
+
+#include "test.h"
+#include "SpscRingBuffer.h"
+#include <thread>
+
+// Те же параметры, что в Scale.h (Scale.h тянет за собой FreeRTOS)
+#define RING_SIZE 64
+#define BATCH_SIZE 16
+#define SAMPLE_PERIOD_US 12500      // 80 SPS
+#define CONTROL_PERIOD_US 20000     // CONTROL_TASK_PERIOD
+
+struct Sample {
+    uint32_t timeUs;
+    uint32_t seq;
+};
+
+/**
+ * Виртуальные часы: производитель кладет отсчет каждые 12.5 мс, потребитель
+ * забирает пачками раз в такт управления. Каждый сотый такт затягивается
+ * на stallUs (медленная команда из Serial, запись во флеш)
+ */
+static void simulate(uint32_t stallUs, uint32_t& maxLatencyUs, uint32_t& received, uint32_t& dropped,
+                     bool& ordered) {
+    SpscRingBuffer<Sample, RING_SIZE> ring;
+    const uint32_t duration = 60u * 1000000u;   // 60 с
+
+    uint32_t nextSample = 0;
+    uint32_t nextConsume = CONTROL_PERIOD_US;
+    uint32_t seq = 0;
+    uint32_t expected = 0;
+    uint32_t tick = 0;
+    maxLatencyUs = 0;
+    received = 0;
+    ordered = true;
+
+    while (nextSample < duration || nextConsume < duration) {
+        if (nextSample <= nextConsume) {
+            Sample s = { nextSample, seq++ };
+            ring.push(s);
+            nextSample += SAMPLE_PERIOD_US;
+            continue;
+        }
+
+        Sample batch[BATCH_SIZE];
+        size_t count;
+        while ((count = ring.popBatch(batch, BATCH_SIZE)) > 0) {
+            for (size_t i = 0; i < count; i++) {
+                if (batch[i].seq != expected++) ordered = false;
+                uint32_t latency = nextConsume - batch[i].timeUs;
+                if (latency > maxLatencyUs) maxLatencyUs = latency;
+                received++;
+            }
+        }
+        tick++;
+        nextConsume += CONTROL_PERIOD_US + (tick % 100 == 0 ? stallUs : 0);
+    }
+
+    // Отсчеты после последнего такта (задержка в них не учитывается)
+    Sample rest;
+    while (ring.pop(rest)) {
+        if (rest.seq != expected++) ordered = false;
+        received++;
+    }
+    dropped = ring.getDropped();
+}
+
+static void testSteadyStream() {
+    uint32_t maxLatency, received, dropped;
+    bool ordered;
+    simulate(0, maxLatency, received, dropped, ordered);
+
+    CHECK(dropped == 0);
+    CHECK(ordered);
+    CHECK(received == 60u * 80u);
+    // Отсчет ждет не дольше одного такта управления
+    CHECK(maxLatency <= CONTROL_PERIOD_US);
+}
+
+static void testStalledConsumer() {
+    // Буфер на 64 отсчета = 0.8 с: задержка такта на 500 мс не теряет отсчетов
+    uint32_t maxLatency, received, dropped;
+    bool ordered;
+    simulate(500000, maxLatency, received, dropped, ordered);
+
+    CHECK(dropped == 0);
+    CHECK(ordered);
+    CHECK(maxLatency <= CONTROL_PERIOD_US + 500000);
+
+    // Задержка дольше емкости буфера - потери есть и учитываются
+    simulate(1000000, maxLatency, received, dropped, ordered);
+    CHECK(dropped > 0);
+    CHECK(received + dropped == 60u * 80u);
+}
+
+static void testThreads() {
+    // Настоящие потоки: порядок и целостность при конкурентном доступе
+    static SpscRingBuffer<Sample, RING_SIZE> ring;
+    const uint32_t total = 2000000;
+    bool ordered = true;
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < total; i++) {
+            Sample s = { 0, i };
+            while (!ring.push(s)) std::this_thread::yield();
+        }
+    });
+
+    uint32_t expected = 0;
+    Sample batch[BATCH_SIZE];
+    while (expected < total) {
+        size_t count = ring.popBatch(batch, BATCH_SIZE);
+        for (size_t i = 0; i < count; i++) {
+            if (batch[i].seq != expected++) ordered = false;
+        }
+        if (count == 0) std::this_thread::yield();
+    }
+    producer.join();
+
+    CHECK(ordered);
+    CHECK(ring.isEmpty());
+}
+
+int main() {
+    RUN_TEST(testSteadyStream);
+    RUN_TEST(testStalledConsumer);
+    RUN_TEST(testThreads);
+    return testSummary("sampling_ring");
+}
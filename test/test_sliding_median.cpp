@@ -0,0 +1,128 @@
+// файл: test/test_sliding_median.cpp
+// SlidingMedian против эталона (копия окна + сортировка) и замер ns/отсчет
+
+#include "test.h"
+#include "SlidingMedian.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+// Эталон и прежний способ из Scale::update(): копия окна и сортировка вставками
+template <size_t N>
+class SortedCopyMedian {
+private:
+    float window[N];
+    size_t head = 0;
+    size_t count = 0;
+
+public:
+    float push(float value) {
+        window[(head + count) % N] = value;
+        if (count < N) count++;
+        else head = (head + 1) % N;
+
+        float sorted[N];
+        for (size_t i = 0; i < count; i++) sorted[i] = window[(head + i) % N];
+        for (size_t i = 1; i < count; i++) {
+            float key = sorted[i];
+            size_t j = i;
+            while (j > 0 && sorted[j - 1] > key) {
+                sorted[j] = sorted[j - 1];
+                j--;
+            }
+            sorted[j] = key;
+        }
+        return sorted[count / 2];
+    }
+};
+
+template <size_t N>
+static void checkAgainstReference(unsigned seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> noise(0.0f, 3.0f);
+    std::uniform_int_distribution<int> spike(0, 50);
+
+    SlidingMedian<float, N> median;
+    std::vector<float> history;
+    bool same = true;
+    bool bounds = true;
+
+    for (int i = 0; i < 5000; i++) {
+        // Шум, ступени, выбросы и повторяющиеся значения
+        float value = (i / 700) * 250.0f + noise(rng);
+        if (spike(rng) == 0) value += 800.0f;
+        if (i % 13 == 0) value = 100.0f;
+        history.push_back(value);
+
+        float got = median.push(value);
+
+        size_t n = std::min(history.size(), N);
+        std::vector<float> ref(history.end() - n, history.end());
+        std::sort(ref.begin(), ref.end());
+        if (got != ref[n / 2]) same = false;
+        if (median.minimum() != ref.front() || median.maximum() != ref.back()) bounds = false;
+    }
+    CHECK(same);
+    CHECK(bounds);
+    CHECK(median.isFull());
+}
+
+static void testMatchesReference() {
+    checkAgainstReference<1>(1);
+    checkAgainstReference<2>(2);
+    checkAgainstReference<5>(3);
+    checkAgainstReference<15>(4);
+    checkAgainstReference<21>(5);
+    checkAgainstReference<63>(6);
+}
+
+static void testPartialWindowAndReset() {
+    SlidingMedian<int, 5> median;
+    CHECK(median.median() == 0);
+    CHECK(median.push(10) == 10);
+    CHECK(median.push(30) == 30);      // Окно {10, 30}: берется верхняя из двух
+    CHECK(median.push(20) == 20);
+    CHECK(median.size() == 3);
+    median.reset();
+    CHECK(median.size() == 0);
+    CHECK(median.push(7) == 7);
+}
+
+template <typename Filter>
+static double nsPerSample(const std::vector<float>& input) {
+    Filter filter;
+    volatile float sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (float v : input) sink = filter.push(v);
+    auto end = std::chrono::steady_clock::now();
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(end - start).count() / input.size();
+}
+
+template <size_t N>
+static void benchmark(const std::vector<float>& input) {
+    double incremental = nsPerSample<SlidingMedian<float, N>>(input);
+    double sorted = nsPerSample<SortedCopyMedian<N>>(input);
+    printf("  окно %2zu: инкрементальная %7.1f нс/отсчет, копия+сортировка %7.1f нс/отсчет\n",
+           N, incremental, sorted);
+}
+
+static void testBenchmark() {
+    std::mt19937 rng(42);
+    std::normal_distribution<float> noise(1000.0f, 5.0f);
+    std::vector<float> input(200000);
+    for (float& v : input) v = noise(rng);
+
+    benchmark<5>(input);
+    benchmark<15>(input);
+    benchmark<31>(input);
+    benchmark<63>(input);
+}
+
+int main() {
+    RUN_TEST(testMatchesReference);
+    RUN_TEST(testPartialWindowAndReset);
+    RUN_TEST(testBenchmark);
+    return testSummary("sliding_median");
+}
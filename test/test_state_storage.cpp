@@ -0,0 +1,144 @@
+// файл: test/test_state_storage.cpp
+// Пересоздание состояний автомата на месте (StateStorage.h): переходы не обращаются к куче
+
+#include "test.h"
+#include "StateStorage.h"
+#include "FlowMonitor.h"
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+
+// Счетчик выделений: смена состояния идет в такте управления, куча там запрещена
+static size_t heapAllocations = 0;
+
+void* operator new(size_t size) {
+    heapAllocations++;
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](size_t size) {
+    heapAllocations++;
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+static int constructed = 0;
+static int destroyed = 0;
+
+// Состояния того же устройства, что в StateMachine.h: виртуальная база,
+// параметры конструктора и монитор потока внутри налива
+enum TestErrorType { TERR_NONE, TERR_NO_FLOW, TERR_TIMEOUT };
+
+class TestState {
+public:
+    TestState() { constructed++; }
+    virtual ~TestState() { destroyed++; }
+    virtual const char* getName() = 0;
+    virtual bool isFillingState() { return false; }
+    unsigned long enteredAt = 0;     // Поле, которое состояние портит за время работы
+};
+
+class TestIdle : public TestState {
+public:
+    const char* getName() override { return "IDLE"; }
+};
+
+class TestFilling : public TestState {
+public:
+    float targetWeight;
+    FlowMonitor flowMonitor;
+    TestFilling(float target = 0) : targetWeight(target) {}
+    const char* getName() override { return "FILLING"; }
+    bool isFillingState() override { return true; }
+};
+
+class TestError : public TestState {
+public:
+    TestErrorType error;
+    TestError(TestErrorType err = TERR_NONE) : error(err) {}
+    const char* getName() override { return "ERROR"; }
+};
+
+// Автомат в миниатюре: состояния - поля, переход пересоздает целевое, как resetState()
+struct TestMachine {
+    TestIdle idleState;
+    TestFilling fillingState;
+    TestError errorState;
+    TestState* currentState = &idleState;
+
+    void transition(TestState* next, float fillTarget, TestErrorType error) {
+        if (next == &idleState) rebuildState(idleState);
+        else if (next == &fillingState) rebuildState(fillingState, fillTarget);
+        else if (next == &errorState) rebuildState(errorState, error);
+        currentState = next;
+        currentState->enteredAt = 1;
+    }
+};
+
+static void testRebuildResetsObject() {
+    TestMachine machine;
+    TestFilling* before = &machine.fillingState;
+
+    machine.fillingState.flowMonitor.arm();
+    machine.fillingState.enteredAt = 12345;
+    int built = constructed, gone = destroyed;
+    rebuildState(machine.fillingState, 850.0f);
+
+    // Тот же адрес, новые параметры, поля и монитор - как после конструктора
+    CHECK(&machine.fillingState == before);
+    CHECK_NEAR(machine.fillingState.targetWeight, 850.0, 1e-6);
+    CHECK(machine.fillingState.enteredAt == 0);
+    CHECK(!machine.fillingState.flowMonitor.isArmed());
+    CHECK(constructed == built + 1 && destroyed == gone + 1);
+
+    // Виртуальные вызовы через указатель на базу идут в пересозданный объект
+    TestState* state = &machine.fillingState;
+    CHECK(strcmp(state->getName(), "FILLING") == 0);
+    CHECK(state->isFillingState());
+
+    // Ошибка -> ошибка: код меняется, объект тот же
+    rebuildState(machine.errorState, TERR_NO_FLOW);
+    rebuildState(machine.errorState, TERR_TIMEOUT);
+    CHECK(machine.errorState.error == TERR_TIMEOUT);
+    CHECK(strcmp(((TestState*)&machine.errorState)->getName(), "ERROR") == 0);
+}
+
+static void testNoHeap() {
+    TestMachine machine;
+    TestState* states[] = {&machine.idleState, &machine.fillingState, &machine.idleState,
+                           &machine.errorState, &machine.idleState};
+    const char* names[] = {"IDLE", "FILLING", "IDLE", "ERROR", "IDLE"};
+
+    size_t before = heapAllocations;
+    int built = constructed, gone = destroyed;
+    int named = 0;
+    for (int i = 0; i < 100000; i++) {
+        int k = i % 5;
+        machine.transition(states[k], 100.0f + k, (TestErrorType)(1 + i % 2));
+        if (strcmp(machine.currentState->getName(), names[k]) == 0) named++;
+    }
+    size_t allocations = heapAllocations - before;
+    printf("  100000 переходов: %zu выделений памяти\n", allocations);
+    CHECK(allocations == 0);
+    CHECK(named == 100000);
+    CHECK(constructed - built == 100000 && destroyed - gone == 100000);
+
+    // Счетчик работает: иначе проверка выше ничего не доказывает
+    char* volatile probe = new char[16];
+    CHECK(heapAllocations == before + 1);
+    delete[] probe;
+}
+
+int main() {
+    RUN_TEST(testRebuildResetsObject);
+    RUN_TEST(testNoHeap);
+    return testSummary("state_storage");
+}
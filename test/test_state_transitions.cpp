@@ -0,0 +1,55 @@
+// файл: test/test_state_transitions.cpp
+// Матрица переходов: каждая пара состояний разрешена или запрещена как задумано
+
+#include "test.h"
+#include "StateTransitions.h"
+
+static const char* NAMES[] = {"INIT", "IDLE", "FILLING", "CALIBRATION", "ERROR"};
+
+// Ожидаемые переходы, выписанные независимо от таблицы автомата
+static bool expected(SystemState from, SystemState to) {
+    if (to == ST_INIT) return false;                    // В INIT не возвращаются
+    if (to == ST_ERROR) return true;                    // Ошибка возможна отовсюду
+    switch (from) {
+        case ST_INIT:
+        case ST_IDLE:        return true;               // Старт и ожидание - куда угодно
+        case ST_FILLING:
+        case ST_CALIBRATION: return to == ST_IDLE;      // Только завершение
+        case ST_ERROR:       return false;              // Только перезагрузкой
+    }
+    return false;
+}
+
+static void testEveryPair() {
+    int allowed = 0;
+    for (int from = 0; from < STATE_COUNT; from++) {
+        for (int to = 0; to < STATE_COUNT; to++) {
+            bool want = expected((SystemState)from, (SystemState)to);
+            bool got = isTransitionAllowed((SystemState)from, (SystemState)to);
+            if (got != want) {
+                printf("  %s -> %s: %s, ожидалось %s\n", NAMES[from], NAMES[to],
+                       got ? "разрешен" : "запрещен", want ? "разрешен" : "запрещен");
+            }
+            CHECK(got == want);
+            if (got) allowed++;
+        }
+    }
+    CHECK(allowed == 13);
+}
+
+static void testOutOfRange() {
+    SystemState unknown = (SystemState)STATE_COUNT;
+    SystemState negative = (SystemState)-1;
+    for (int s = 0; s < STATE_COUNT; s++) {
+        CHECK(!isTransitionAllowed(unknown, (SystemState)s));
+        CHECK(!isTransitionAllowed((SystemState)s, unknown));
+        CHECK(!isTransitionAllowed(negative, (SystemState)s));
+        CHECK(!isTransitionAllowed((SystemState)s, negative));
+    }
+}
+
+int main() {
+    RUN_TEST(testEveryPair);
+    RUN_TEST(testOutOfRange);
+    return testSummary("state_transitions");
+}
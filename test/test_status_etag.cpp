@@ -0,0 +1,164 @@
+// файл: test/test_status_etag.cpp
+// ETag /api/status: опрос при неподвижном чайнике получает 304, изменения - новый документ
+
+#include "test.h"
+#include "StatusETag.h"
+#include "SystemSnapshot.h"
+#include "FlowEstimator.h"
+#include "JsonWriter.h"
+#include <random>
+#include <string>
+
+static const char* STATE_NAMES[] = {"INIT", "IDLE", "FILLING", "CALIBRATION", "ERROR"};
+
+// Поля снимка так же, как WebDashboard::writeStatusView (без Wi-Fi и MQTT)
+static uint32_t hashView(const SystemSnapshot& snap) {
+    char window[STATUS_HASH_WINDOW];
+    uint32_t hash = STATUS_HASH_SEED;
+    JsonWriter json(window, sizeof(window), statusHashChunk, &hash);
+    json.beginObject();
+    json.field("version", snap.version);
+    json.field("currentWeight", snap.currentWeight);
+    json.field("emptyWeight", snap.emptyWeight);
+    json.field("waterVolume", snap.waterVolume);
+    json.field("systemState", STATE_NAMES[snap.state]);
+    json.field("error", errorName(snap.error));
+    json.field("flowRate", snap.flowRate);
+    json.field("flowVariance", snap.flowVariance, 3);
+    json.field("timeToTarget", snap.timeToTarget, 1);
+    json.field("kettlePresent", snap.kettlePresent);
+    json.field("calibrationFactor", snap.calibrationFactor, 6);
+    json.endObject();
+    json.finish();
+    return hash;
+}
+
+// Устройство: снимки автомата и обработчик /api/status
+struct Device {
+    std::mt19937 rng{1};
+    std::normal_distribution<float> noise{0.0f, 0.15f};
+    FlowEstimator flow;
+    SystemSnapshot versioned;       // StateMachine::lastSnapshot
+    SystemSnapshot statusSnapshot;  // WebDashboard::statusSnapshot
+    StatusETag etag;
+    uint32_t sampleMs = 0;          // Время отсчетов HX711
+    unsigned long nowMs = 0;        // millis(): такт 20 мс
+    float weight = 1300.0f;
+    bool kettle = true;
+
+    Device(uint32_t boot) {
+        memset(&versioned, 0, sizeof(versioned));
+        memset(&statusSnapshot, 0, sizeof(statusSnapshot));
+        etag.begin(boot);
+    }
+
+    // Такт управления 20 мс: 4 отсчета 80 SPS и новый снимок
+    SystemSnapshot tick() {
+        float measured = 0;
+        for (int i = 0; i < 4; i++, sampleMs += 12) {
+            measured = (kettle ? weight : 0.0f) + noise(rng);
+            flow.addSample(sampleMs, measured);
+        }
+        SystemSnapshot s;
+        memset(&s, 0, sizeof(s));
+        s.state = ST_IDLE;
+        s.scaleReady = true;
+        s.kettlePresent = kettle;
+        s.calibrationDone = true;
+        s.currentWeight = measured;
+        s.emptyWeight = 800.0f;
+        s.waterVolume = kettle ? measured - 800.0f : 0;
+        s.calibrationFactor = 0.42f;
+        s.flowVariance = flow.getRateVariance();
+        s.flowRate = snapshotFlowRate(flow.getRate(), s.flowVariance);
+        s.timeToTarget = -1;
+        nowMs += 20;
+        s.timestamp = nowMs;
+        snapshotAssignVersion(s, versioned);
+        return s;
+    }
+
+    // Опрос с If-None-Match: true - ответ 304
+    bool poll(const SystemSnapshot& snap, std::string& clientETag) {
+        if (snap.version != statusSnapshot.version) statusSnapshot = snap;
+        etag.update(hashView(statusSnapshot), nowMs, STATUS_ETAG_MAX_AGE);
+        if (etag.matches(clientETag.c_str())) return true;
+        clientETag = etag.c_str();
+        return false;
+    }
+};
+
+static void testStillKettleNotModified() {
+    // Дашборд опрашивает раз в секунду, чайник стоит 10 минут
+    Device device(0x1234);
+    std::string clientETag;
+    uint32_t full = 0, notModified = 0;
+    bool secondPoll = false;
+    for (int second = 0; second < 600; second++) {
+        SystemSnapshot snap;
+        for (int t = 0; t < 50; t++) snap = device.tick();
+        bool cached = device.poll(snap, clientETag);
+        if (second == 1) secondPoll = cached;
+        if (cached) notModified++;
+        else full++;
+    }
+    printf("  за 10 минут: %lu полных ответов, %lu ответов 304\n",
+           (unsigned long)full, (unsigned long)notModified);
+    CHECK(secondPoll);             // Два опроса подряд: второй - 304
+    CHECK(full <= 600 / (STATUS_ETAG_MAX_AGE / 1000) + 3);   // Раз в минуту + редкие выбросы шума
+}
+
+static void testChangesSendDocument() {
+    Device device(0x1234);
+    std::string clientETag;
+    SystemSnapshot snap = device.tick();
+    CHECK(!device.poll(snap, clientETag));
+    CHECK(device.poll(device.tick(), clientETag));
+
+    // Сняли чайник - новый документ, потом снова 304
+    device.kettle = false;
+    for (int t = 0; t < 50; t++) snap = device.tick();
+    CHECK(!device.poll(snap, clientETag));
+    CHECK(device.poll(device.tick(), clientETag));
+
+    // Долили 5 г
+    device.kettle = true;
+    device.weight += 5.0f;
+    for (int t = 0; t < 50; t++) snap = device.tick();
+    CHECK(!device.poll(snap, clientETag));
+}
+
+static void testETagFormat() {
+    StatusETag etag;
+    etag.begin(0xA1B2C3D4);
+    CHECK(!etag.matches(""));                    // До первой выдачи ничего не совпадает
+    CHECK(etag.update(0xDEADBEEF, 0, 60000));
+    CHECK(strcmp(etag.c_str(), "W/\"a1b2c3d4-deadbeef-1\"") == 0);
+    CHECK(etag.matches("W/\"a1b2c3d4-deadbeef-1\""));
+    CHECK(!etag.matches(nullptr));
+
+    // Тот же хеш - тот же ETag, пока не истек срок
+    CHECK(!etag.update(0xDEADBEEF, 59999, 60000));
+    CHECK(etag.update(0xDEADBEEF, 60000, 60000));
+    CHECK(strcmp(etag.c_str(), "W/\"a1b2c3d4-deadbeef-2\"") == 0);
+
+    // После перезагрузки ETag другой даже при тех же полях
+    StatusETag rebooted;
+    rebooted.begin(0x0BADF00D);
+    rebooted.update(0xDEADBEEF, 0, 60000);
+    CHECK(!rebooted.matches("W/\"a1b2c3d4-deadbeef-1\""));
+
+    // Хеш по кускам (окно JsonWriter) равен хешу целиком
+    const char* text = "{\"currentWeight\":1300.12}";
+    uint32_t whole = statusHash(STATUS_HASH_SEED, text, strlen(text));
+    uint32_t parts = statusHash(STATUS_HASH_SEED, text, 7);
+    parts = statusHash(parts, text + 7, strlen(text) - 7);
+    CHECK(whole == parts);
+}
+
+int main() {
+    RUN_TEST(testStillKettleNotModified);
+    RUN_TEST(testChangesSendDocument);
+    RUN_TEST(testETagFormat);
+    return testSummary("status_etag");
+}
@@ -0,0 +1,121 @@
+// файл: test/test_system_snapshot.cpp
+// Версия снимка: шум датчика ее не меняет, реальные изменения - меняют
+
+#include "test.h"
+#include "SystemSnapshot.h"
+#include "FlowEstimator.h"
+#include <random>
+
+// Снимок покоя: чайник стоит, помпа выключена
+static SystemSnapshot idleSnapshot(float weight, float flow, float variance) {
+    SystemSnapshot s;
+    memset(&s, 0, sizeof(s));
+    s.state = ST_IDLE;
+    s.scaleReady = true;
+    s.kettlePresent = true;
+    s.calibrationDone = true;
+    s.currentWeight = weight;
+    s.emptyWeight = 800.0f;
+    s.waterVolume = weight - 800.0f;
+    s.calibrationFactor = 0.42f;
+    s.flowRate = flow;
+    s.flowVariance = variance;
+    s.timeToTarget = -1;
+    return s;
+}
+
+static void testStillKettleKeepsVersion() {
+    // 10 минут тактов по 20 мс (4 отсчета 80 SPS на такт): шум веса после
+    // медианы 0.15 г, поток - настоящая оценка FlowEstimator по этому шуму
+    std::mt19937 rng(1);
+    std::normal_distribution<float> noise(0.0f, 0.15f);
+    FlowEstimator flow;
+
+    SystemSnapshot versioned;
+    memset(&versioned, 0, sizeof(versioned));
+    uint32_t changes = 0;
+    uint32_t sampleMs = 0;
+    for (int tick = 0; tick < 30000; tick++) {
+        float weight = 0;
+        for (int i = 0; i < 4; i++, sampleMs += 12) {
+            weight = 1300.0f + noise(rng);
+            flow.addSample(sampleMs, weight);
+        }
+        float variance = flow.getRateVariance();
+        SystemSnapshot s = idleSnapshot(weight, snapshotFlowRate(flow.getRate(), variance), variance);
+        if (snapshotAssignVersion(s, versioned)) changes++;
+    }
+    printf("  смен версии за 10 минут покоя: %lu\n", (unsigned long)changes);
+    CHECK(changes <= 3);           // Первый снимок и редкие выбросы шума за 1 г
+}
+
+static void testSlowDriftChangesPerStep() {
+    // Испарение/дрейф 0.01 г за такт: 10 г за 1000 тактов - около 10 версий
+    SystemSnapshot versioned;
+    memset(&versioned, 0, sizeof(versioned));
+    uint32_t changes = 0;
+    for (int tick = 0; tick < 1000; tick++) {
+        SystemSnapshot s = idleSnapshot(1300.0f - tick * 0.01f, 0, 0);
+        if (snapshotAssignVersion(s, versioned)) changes++;
+    }
+    CHECK(changes >= 10 && changes <= 11);
+}
+
+static void testRealChanges() {
+    SystemSnapshot versioned;
+    memset(&versioned, 0, sizeof(versioned));
+    SystemSnapshot s = idleSnapshot(1300.0f, 0, 0);
+    snapshotAssignVersion(s, versioned);
+    uint32_t version = s.version;
+
+    // Дисперсия потока в версию не входит
+    s = idleSnapshot(1300.0f, 0, 5.0f);
+    CHECK(!snapshotAssignVersion(s, versioned));
+    CHECK(s.version == version);
+
+    // Сняли чайник
+    s = idleSnapshot(1300.0f, 0, 0);
+    s.kettlePresent = false;
+    CHECK(snapshotAssignVersion(s, versioned));
+    CHECK(s.version == version + 1);
+
+    // Поток на шаг 0.1 г/с
+    SystemSnapshot flowing = s;
+    flowing.flowRate = 0.1f;
+    CHECK(snapshotAssignVersion(flowing, versioned));
+
+    // Налив начался: цель и состояние
+    SystemSnapshot filling = flowing;
+    filling.state = ST_FILLING;
+    filling.fillTarget = 1550.0f;
+    CHECK(snapshotAssignVersion(filling, versioned));
+
+    // Время до цели меняется на секунду
+    SystemSnapshot eta = filling;
+    eta.timeToTarget = versioned.timeToTarget + 0.5f;
+    CHECK(!snapshotAssignVersion(eta, versioned));
+    eta.timeToTarget = versioned.timeToTarget + 1.0f;
+    CHECK(snapshotAssignVersion(eta, versioned));
+}
+
+static void testFillingChangesOften() {
+    // Налив 30 г/с при такте 20 мс: +0.6 г за такт, версия - примерно через такт
+    SystemSnapshot versioned;
+    memset(&versioned, 0, sizeof(versioned));
+    uint32_t changes = 0;
+    for (int tick = 0; tick < 250; tick++) {
+        SystemSnapshot s = idleSnapshot(1000.0f + tick * 0.6f, 30.0f, 0.1f);
+        s.state = ST_FILLING;
+        s.pumpOn = true;
+        if (snapshotAssignVersion(s, versioned)) changes++;
+    }
+    CHECK(changes >= 120 && changes <= 130);   // 150 г с шагом 1 г, округление вниз до пар тактов
+}
+
+int main() {
+    RUN_TEST(testStillKettleKeepsVersion);
+    RUN_TEST(testSlowDriftChangesPerStep);
+    RUN_TEST(testRealChanges);
+    RUN_TEST(testFillingChangesOften);
+    return testSummary("system_snapshot");
+}
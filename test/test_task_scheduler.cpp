@@ -0,0 +1,134 @@
+// файл: test/test_task_scheduler.cpp
+// TaskScheduler на виртуальных часах: учет опозданий (jitter), промахов дедлайна и сброса
+
+#include "test.h"
+#include "TaskScheduler.h"
+
+// Длительность задач в текущем сценарии (мкс): задача "выполняется", двигая часы
+static uint32_t controlCost = 0;
+static uint32_t networkCost = 0;
+static uint32_t controlRuns = 0;
+
+static void controlTask() {
+    controlRuns++;
+    stubMicros() += controlCost;
+}
+
+static void networkTask() {
+    stubMicros() += networkCost;
+}
+
+// Основной цикл: проход планировщика и сон до следующей задачи
+static void runFor(TaskScheduler& scheduler, uint32_t durationUs) {
+    unsigned long end = stubMicros() + durationUs;
+    while (stubMicros() < end) {
+        uint32_t idleMs = scheduler.run();
+        // Сон в loop() - с точностью до миллисекунды, как vTaskDelay
+        stubMicros() += idleMs ? idleMs * 1000UL : 100;
+    }
+}
+
+static void reset(unsigned long startUs) {
+    stubMicros() = startUs;
+    controlCost = 200;
+    networkCost = 0;
+    controlRuns = 0;
+}
+
+static void testIdleGrid() {
+    // Только управление: запуски точно по сетке 20 мс, без опозданий
+    reset(0);
+    TaskScheduler scheduler;
+    scheduler.addTask("control", controlTask, CONTROL_TASK_PERIOD);
+    runFor(scheduler, 1000000);
+
+    const ScheduledTask& control = scheduler.getTask(0);
+    CHECK(control.runs == 1000 / CONTROL_TASK_PERIOD);
+    CHECK(control.maxJitter == 0);
+    CHECK(control.misses == 0);
+    CHECK(scheduler.getAverageRunTime(0) == 200);
+}
+
+static void testSharedLoopLateness() {
+    // Сеть в том же цикле (как до переноса на ядро 0): медленный HTTP-ответ
+    // 30 мс задерживает такт управления, и это видно в jitter и промахах
+    reset(0);
+    networkCost = 30000;
+    TaskScheduler scheduler;
+    scheduler.addTask("network", networkTask, 100);
+    scheduler.addTask("control", controlTask, CONTROL_TASK_PERIOD);
+    runFor(scheduler, 2000000);
+
+    const ScheduledTask& control = scheduler.getTask(1);
+    printf("  общий цикл: опоздание управления до %lu мкс, промахов %lu из %lu\n",
+           (unsigned long)control.maxJitter, (unsigned long)control.misses, (unsigned long)control.runs);
+    CHECK(control.maxJitter >= 30000 - CONTROL_TASK_PERIOD * 1000UL);
+    CHECK(control.maxJitter <= 30000);
+    CHECK(control.misses > 0);
+}
+
+static void testSeparateLoops() {
+    // Сеть в своем планировщике на другом ядре: у управления своя сетка,
+    // нагрузка сети на опоздание управления не влияет
+    reset(0);
+    networkCost = 30000;
+    TaskScheduler control;
+    control.addTask("control", controlTask, CONTROL_TASK_PERIOD);
+    runFor(control, 2000000);
+
+    CHECK(control.getTask(0).maxJitter == 0);
+    CHECK(control.getTask(0).misses == 0);
+}
+
+static void testNoCatchUpBurst() {
+    // Задача застряла на 5 периодов: пропущенные запуски не догоняются подряд
+    reset(0);
+    TaskScheduler scheduler;
+    scheduler.addTask("control", controlTask, CONTROL_TASK_PERIOD);
+    scheduler.run();
+    stubMicros() += 5 * CONTROL_TASK_PERIOD * 1000UL;
+    uint32_t before = controlRuns;
+    scheduler.run();
+    scheduler.run();
+    CHECK(controlRuns == before + 1);
+    CHECK(scheduler.getTask(0).misses == 1);
+}
+
+static void testRequestReset() {
+    // Сброс из другой задачи выполняется в начале следующего прохода
+    reset(0);
+    networkCost = 30000;
+    TaskScheduler scheduler;
+    scheduler.addTask("network", networkTask, 100);
+    scheduler.addTask("control", controlTask, CONTROL_TASK_PERIOD);
+    runFor(scheduler, 500000);
+    CHECK(scheduler.getTask(1).maxJitter > 0);
+
+    scheduler.requestReset();
+    CHECK(scheduler.getTask(1).runs > 0);        // До прохода статистика на месте
+    networkCost = 0;
+    runFor(scheduler, 500000);
+    CHECK(scheduler.getTask(1).runs > 0);
+    CHECK(scheduler.getTask(1).maxJitter == 0);  // Учтены только запуски после сброса
+    CHECK(scheduler.getTask(1).misses == 0);
+}
+
+static void testMicrosWrap() {
+    // Переполнение micros() через ~71 минуту не ломает сетку
+    reset(0xFFFFFFFFUL - 50000);
+    TaskScheduler scheduler;
+    scheduler.addTask("control", controlTask, CONTROL_TASK_PERIOD);
+    runFor(scheduler, 200000);
+    CHECK(controlRuns == 200 / CONTROL_TASK_PERIOD);
+    CHECK(scheduler.getTask(0).maxJitter == 0);
+}
+
+int main() {
+    RUN_TEST(testIdleGrid);
+    RUN_TEST(testSharedLoopLateness);
+    RUN_TEST(testSeparateLoops);
+    RUN_TEST(testNoCatchUpBurst);
+    RUN_TEST(testRequestReset);
+    RUN_TEST(testMicrosWrap);
+    return testSummary("task_scheduler");
+}
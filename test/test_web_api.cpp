@@ -0,0 +1,172 @@
+// файл: test/test_web_api.cpp
+// Команды HTTP API по снимку: неверные параметры, минимум, нет чайника, занято, полная очередь
+
+#include "test.h"
+#include "WebApi.h"
+#include <string.h>
+
+// Снимок: IDLE, готовые весы, чайник 800 г с 300 мл воды
+static SystemSnapshot idleSnapshot() {
+    SystemSnapshot snap;
+    memset(&snap, 0, sizeof(snap));
+    snap.version = 1;
+    snap.state = ST_IDLE;
+    snap.scaleReady = true;
+    snap.kettlePresent = true;
+    snap.emptyWeight = 800.0f;
+    snap.currentWeight = 1100.0f;
+    return snap;
+}
+
+// Очередь событий: принимает, пока не заполнена
+struct Queue {
+    bool full = false;
+    int posted = 0;
+    float lastTarget = -1.0f;
+};
+
+static ApiResult fill(const char* cups, const char* full, const char* ml,
+                      const SystemSnapshot& snap, Queue& queue) {
+    return apiFill(cups, full, ml, snap, [&queue](float target) {
+        if (queue.full) return false;
+        queue.posted++;
+        queue.lastTarget = target;
+        return true;
+    });
+}
+
+static bool isError(const ApiResult& result, int code, const char* error) {
+    return result.code == code && result.error && strcmp(result.error, error) == 0;
+}
+
+static void testParseIntArg() {
+    int value = -1;
+    CHECK(parseIntArg("2", value) && value == 2);
+    CHECK(parseIntArg("-7", value) && value == -7);
+    CHECK(parseIntArg("1700", value) && value == 1700);
+    CHECK(!parseIntArg(nullptr, value));
+    CHECK(!parseIntArg("", value));
+    CHECK(!parseIntArg("2abc", value));
+    CHECK(!parseIntArg("1.5", value));
+    CHECK(!parseIntArg("2 ", value));
+    CHECK(!parseIntArg("abc", value));
+    CHECK(!parseIntArg("99999999999999999999", value));   // ERANGE
+    CHECK(!parseIntArg("4294967296", value));             // Больше int
+    CHECK(value == 1700);                                 // При ошибке значение не меняется
+}
+
+static void testBadArguments() {
+    SystemSnapshot snap = idleSnapshot();
+    Queue queue;
+    CHECK(isError(fill(nullptr, nullptr, nullptr, snap, queue), 400, "bad_request"));
+    CHECK(isError(fill("2abc", nullptr, nullptr, snap, queue), 400, "bad_request"));
+    CHECK(isError(fill("", nullptr, nullptr, snap, queue), 400, "bad_request"));
+    CHECK(isError(fill("0", nullptr, nullptr, snap, queue), 400, "bad_request"));
+    CHECK(isError(fill("7", nullptr, nullptr, snap, queue), 400, "bad_request"));   // Полный - через full=1
+    CHECK(isError(fill(nullptr, "2", nullptr, snap, queue), 400, "bad_request"));
+    CHECK(isError(fill(nullptr, "1x", nullptr, snap, queue), 400, "bad_request"));
+    CHECK(isError(fill(nullptr, nullptr, "1701", snap, queue), 400, "bad_request"));
+    CHECK(isError(fill(nullptr, nullptr, "1e3", snap, queue), 400, "bad_request"));
+    // cups важнее остальных: неверный cups не заменяется верным ml
+    CHECK(isError(fill("x", nullptr, "1000", snap, queue), 400, "bad_request"));
+    CHECK(queue.posted == 0);
+}
+
+static void testBelowMinimum() {
+    SystemSnapshot snap = idleSnapshot();
+    Queue queue;
+    CHECK(isError(fill(nullptr, nullptr, "49", snap, queue), 400, "bad_request"));
+    CHECK(isError(fill(nullptr, nullptr, "-50", snap, queue), 400, "bad_request"));
+
+    // Ровно минимум - проверка по воде в чайнике: 50 мл при 300 мл уже есть
+    ApiResult reached = fill(nullptr, nullptr, "50", snap, queue);
+    CHECK(isError(reached, 409, "target_reached"));
+    CHECK_NEAR(reached.target, 850.0, 0.01);
+    CHECK(queue.posted == 0);
+
+    // Цель в пределах 10 г от текущего веса - тоже достигнута
+    snap.currentWeight = 841.0f;
+    CHECK(isError(fill(nullptr, nullptr, "50", snap, queue), 409, "target_reached"));
+    snap.currentWeight = 839.0f;
+    ApiResult ok = fill(nullptr, nullptr, "50", snap, queue);
+    CHECK(ok.code == 202 && ok.error == nullptr);
+    CHECK(queue.posted == 1);
+}
+
+static void testNoKettle() {
+    SystemSnapshot snap = idleSnapshot();
+    Queue queue;
+    snap.kettlePresent = false;
+    CHECK(isError(fill("2", nullptr, nullptr, snap, queue), 409, "no_kettle"));
+    snap.kettlePresent = true;
+    snap.scaleReady = false;
+    CHECK(isError(fill(nullptr, "1", nullptr, snap, queue), 409, "no_kettle"));
+    CHECK(queue.posted == 0);
+}
+
+static void testBusy() {
+    Queue queue;
+    const SystemState busy[] = {ST_FILLING, ST_CALIBRATION, ST_ERROR, ST_INIT};
+    for (SystemState state : busy) {
+        SystemSnapshot snap = idleSnapshot();
+        snap.state = state;
+        CHECK(isError(fill("3", nullptr, nullptr, snap, queue), 409, "busy"));
+        CHECK(isError(apiCalibrate(snap, [] { return true; }), 409, "busy"));
+        if (state != ST_FILLING) CHECK(isError(apiStop(snap, [] { return true; }), 409, "not_filling"));
+    }
+    // Занято важнее, чем нет чайника
+    SystemSnapshot snap = idleSnapshot();
+    snap.state = ST_FILLING;
+    snap.kettlePresent = false;
+    CHECK(isError(fill("3", nullptr, nullptr, snap, queue), 409, "busy"));
+    CHECK(queue.posted == 0);
+}
+
+static void testQueueFull() {
+    SystemSnapshot snap = idleSnapshot();
+    Queue queue;
+    queue.full = true;
+    CHECK(isError(fill("4", nullptr, nullptr, snap, queue), 503, "queue_full"));
+    CHECK(isError(apiCalibrate(snap, [] { return false; }), 503, "queue_full"));
+    snap.state = ST_FILLING;
+    CHECK(isError(apiStop(snap, [] { return false; }), 503, "queue_full"));
+    CHECK(queue.posted == 0);
+}
+
+static void testAccepted() {
+    SystemSnapshot snap = idleSnapshot();
+    Queue queue;
+
+    // cups=4 - как команда MQTT 4: 1000 мл в чайнике
+    ApiResult result = fill("4", nullptr, nullptr, snap, queue);
+    CHECK(result.code == 202 && result.error == nullptr);
+    CHECK_NEAR(result.target, 1800.0, 0.01);
+    CHECK_NEAR(queue.lastTarget, 1800.0, 0.01);
+
+    // cups=1 при воде ниже минимума - до минимума
+    fill("1", nullptr, nullptr, snap, queue);
+    CHECK_NEAR(queue.lastTarget, 800.0 + MIN_WATER_LEVEL, 0.01);
+
+    // full=1 и ml= - до уровня воды, не больше полного чайника
+    fill(nullptr, "1", nullptr, snap, queue);
+    CHECK_NEAR(queue.lastTarget, 800.0 + FULL_WATER_LEVEL, 0.01);
+    fill(nullptr, nullptr, "1700", snap, queue);
+    CHECK_NEAR(queue.lastTarget, 800.0 + FULL_WATER_LEVEL, 0.01);
+    CHECK(queue.posted == 4);
+
+    // Остановка идущего налива и калибровка
+    CHECK(apiCalibrate(snap, [] { return true; }).code == 202);
+    snap.state = ST_FILLING;
+    CHECK(apiStop(snap, [] { return true; }).code == 202);
+}
+
+int main() {
+    RUN_TEST(testParseIntArg);
+    RUN_TEST(testBadArguments);
+    RUN_TEST(testBelowMinimum);
+    RUN_TEST(testNoKettle);
+    RUN_TEST(testBusy);
+    RUN_TEST(testQueueFull);
+    RUN_TEST(testAccepted);
+    return testSummary("web_api");
+}
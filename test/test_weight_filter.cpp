@@ -0,0 +1,183 @@
+// файл: test/test_weight_filter.cpp
+// Ступени WeightFilter.h: реакция на ступеньку и выбросы, пропускная способность
+
+#include "test.h"
+#include "WeightFilter.h"
+#include <chrono>
+#include <random>
+#include <vector>
+
+// Цепочка по умолчанию из Scale.h (окно 21 = 250 мс при 80 SPS)
+typedef FilterChain<Clamp<>, JumpReject<500, 8>, Median<21>> DefaultChain;
+
+// Номер отсчета, на котором выход впервые вошел в полосу +-band вокруг target
+template <typename Filter>
+static int settleIndex(Filter& filter, const std::vector<float>& input, float target, float band) {
+    for (size_t i = 0; i < input.size(); i++) {
+        float grams = input[i];
+        if (filter.apply(grams) && fabsf(grams - target) <= band) return (int)i;
+    }
+    return -1;
+}
+
+static void testClamp() {
+    Clamp<> clamp;
+    float grams = -12.0f;
+    CHECK(clamp.apply(grams));
+    CHECK(grams == 0.0f);
+    grams = 5.0f;
+    clamp.apply(grams);
+    CHECK(grams == 5.0f);
+}
+
+static void testJumpReject() {
+    JumpReject<500, 3> jump;
+    float grams = 1000.0f;
+    CHECK(jump.apply(grams));
+
+    // Одиночный скачок отброшен
+    grams = 2000.0f;
+    CHECK(!jump.apply(grams));
+    grams = 1010.0f;
+    CHECK(jump.apply(grams));
+
+    // Устойчивый новый уровень (сняли чайник) принимается на третьем отсчете
+    float level = 100.0f;
+    grams = level; CHECK(!jump.apply(grams));
+    grams = level; CHECK(!jump.apply(grams));
+    grams = level; CHECK(jump.apply(grams));
+    grams = level + 5; CHECK(jump.apply(grams));
+}
+
+static void testHampel() {
+    HampelReject<9, 30, 5> hampel;
+    std::mt19937 rng(7);
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+
+    int acceptedNoise = 0;
+    for (int i = 0; i < 200; i++) {
+        float grams = 1000.0f + noise(rng);
+        if (hampel.apply(grams)) acceptedNoise++;
+    }
+    // Шум внутри порога (минимум 5 г) не отбрасывается
+    CHECK(acceptedNoise == 200);
+
+    float spike = 1300.0f;
+    CHECK(!hampel.apply(spike));
+
+    // Устойчивая ступенька принимается примерно через половину окна
+    int acceptedAt = -1;
+    for (int i = 0; i < 20 && acceptedAt < 0; i++) {
+        float grams = 1500.0f;
+        if (hampel.apply(grams)) acceptedAt = i;
+    }
+    CHECK(acceptedAt >= 3 && acceptedAt <= 5);
+}
+
+static void testMedianStep() {
+    // Ступенька: выход переходит на новый уровень ровно через половину окна
+    Median<21> median;
+    std::vector<float> input(100, 500.0f);
+    input.insert(input.end(), 100, 1500.0f);
+    CHECK(settleIndex(median, input, 1500.0f, 0.5f) == 100 + 10);
+}
+
+static void testMedianOutliers() {
+    // Выбросы до 10 отсчетов подряд (125 мс) в окне 21 на выход не проходят
+    Median<21> median;
+    float maxDeviation = 0;
+    for (int i = 0; i < 400; i++) {
+        float grams = (i % 50 >= 30 && i % 50 < 40) ? 3000.0f : 1000.0f;
+        median.apply(grams);
+        if (i >= 20 && fabsf(grams - 1000.0f) > maxDeviation) maxDeviation = fabsf(grams - 1000.0f);
+    }
+    CHECK(maxDeviation == 0.0f);
+}
+
+static void testIIRAndDeadband() {
+    // alpha = 0.2: после n отсчетов остаток ступеньки (0.8)^n
+    IIR<200> iir;
+    float grams = 0;
+    iir.apply(grams);
+    for (int i = 0; i < 10; i++) {
+        grams = 100.0f;
+        iir.apply(grams);
+    }
+    CHECK_NEAR(grams, 100.0f * (1.0 - pow(0.8, 10)), 1e-3);
+
+    Deadband<50> deadband;
+    grams = 100.0f; deadband.apply(grams);
+    grams = 100.4f; deadband.apply(grams);
+    CHECK(grams == 100.0f);
+    grams = 100.6f; deadband.apply(grams);
+    CHECK_NEAR(grams, 100.6f, 1e-6);
+}
+
+static void testDefaultChain() {
+    DefaultChain chain;
+    std::vector<float> input;
+    std::mt19937 rng(11);
+    std::normal_distribution<float> noise(0.0f, 2.0f);
+
+    // Пустой чайник, одиночные выбросы, потом налив ступенькой
+    for (int i = 0; i < 200; i++) input.push_back(800.0f + noise(rng) + (i % 37 == 0 ? 900.0f : 0.0f));
+    for (int i = 0; i < 200; i++) input.push_back(1200.0f + noise(rng));
+
+    float maxBefore = 0;
+    DefaultChain probe;
+    for (int i = 0; i < 200; i++) {
+        float grams = input[i];
+        if (probe.apply(grams) && i > 20 && fabsf(grams - 800.0f) > maxBefore) maxBefore = fabsf(grams - 800.0f);
+    }
+    CHECK(maxBefore < 6.0f);
+    CHECK(settleIndex(chain, input, 1200.0f, 6.0f) <= 200 + 12);
+
+    // Отрицательный шум без чайника обрезается до нуля
+    DefaultChain empty;
+    float grams = -3.0f;
+    CHECK(empty.apply(grams));
+    CHECK(grams == 0.0f);
+}
+
+template <typename Stage>
+static void throughput(const char* name, const std::vector<float>& input) {
+    Stage stage;
+    volatile float sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (float v : input) {
+        float grams = v;
+        stage.apply(grams);
+        sink = grams;
+    }
+    auto end = std::chrono::steady_clock::now();
+    (void)sink;
+    printf("  %-28s %7.1f нс/отсчет\n", name,
+           std::chrono::duration<double, std::nano>(end - start).count() / input.size());
+}
+
+static void testThroughput() {
+    std::mt19937 rng(3);
+    std::normal_distribution<float> noise(1000.0f, 3.0f);
+    std::vector<float> input(200000);
+    for (float& v : input) v = noise(rng);
+
+    throughput<Clamp<>>("Clamp", input);
+    throughput<JumpReject<500, 8>>("JumpReject<500,8>", input);
+    throughput<HampelReject<9>>("HampelReject<9>", input);
+    throughput<Median<21>>("Median<21>", input);
+    throughput<IIR<200>>("IIR<200>", input);
+    throughput<Deadband<50>>("Deadband<50>", input);
+    throughput<DefaultChain>("цепочка по умолчанию", input);
+}
+
+int main() {
+    RUN_TEST(testClamp);
+    RUN_TEST(testJumpReject);
+    RUN_TEST(testHampel);
+    RUN_TEST(testMedianStep);
+    RUN_TEST(testMedianOutliers);
+    RUN_TEST(testIIRAndDeadband);
+    RUN_TEST(testDefaultChain);
+    RUN_TEST(testThroughput);
+    return testSummary("weight_filter");
+}
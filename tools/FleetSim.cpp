@@ -0,0 +1,864 @@
+// файл: tools/FleetSim.cpp
+// Реализация имитатора парка помп (tools/FleetSim.h)
+
+#include "FleetSim.h"
+#include "JsonWriter.h"
+#include <algorithm>
+#include <math.h>
+
+const char* const SIM_LEAF_NAMES[SIM_LEAF_COUNT] = { "telemetry", "water_level", "kettle", "ack" };
+
+static const float WATER_THRESHOLDS[2] = { WATER_LEVEL_EMPTY, WATER_LEVEL_LOW };
+
+bool simTopicMatches(const char* filter, const char* topic) {
+    while (*filter) {
+        if (*filter == '#') return true;
+        if (*filter == '+') {
+            while (*topic && *topic != '/') topic++;
+            filter++;
+            continue;
+        }
+        if (*filter != *topic) return false;
+        filter++;
+        topic++;
+    }
+    return *topic == '\0';
+}
+
+// ==================== БРОКЕР В ПАМЯТИ ====================
+/**
+ * Соединение с брокером в памяти
+ * Исход попытки решается в connect() по неисправности брокера и наступает через
+ * время, которое заняла бы такая попытка по сети
+ */
+class SimMemoryLink : public SimLink {
+public:
+    SimMemoryLink(SimBroker& owner, bool immune)
+        : broker(owner), exempt(immune), status(SIM_LINK_DOWN), failReason(MQTT_FAIL_NONE),
+          readyAt(0), connectResult(MQTT_FAIL_NONE), clean(true), now(0) {}
+
+    ~SimMemoryLink() override {
+        if (status == SIM_LINK_UP) broker.detach(this);
+    }
+
+    void connect(const char* id, bool cleanSession, uint64_t at) override {
+        if (status == SIM_LINK_UP) broker.detach(this);
+        clientId = id;
+        clean = cleanSession;
+        now = at;
+        inbox.clear();
+        status = SIM_LINK_CONNECTING;
+        failReason = MQTT_FAIL_NONE;
+
+        uint64_t roundTrip = 2 * broker.oneWay;
+        switch (exempt ? SIM_BROKER_OK : broker.fault) {
+            case SIM_BROKER_OK:
+                connectResult = MQTT_FAIL_NONE;
+                readyAt = at + 2 * roundTrip;                  // SYN/SYN-ACK и CONNECT/CONNACK
+                break;
+            case SIM_BROKER_REFUSED:
+                connectResult = MQTT_FAIL_TCP;                 // RST на SYN
+                readyAt = at + roundTrip;
+                break;
+            case SIM_BROKER_BLACKHOLE:
+                connectResult = MQTT_FAIL_TCP;
+                readyAt = at + MQTT_TCP_TIMEOUT;
+                break;
+            case SIM_BROKER_SILENT:
+                connectResult = MQTT_FAIL_TIMEOUT;
+                readyAt = at + roundTrip + MQTT_CONNACK_TIMEOUT * 1000;
+                break;
+            case SIM_BROKER_DENY:
+                connectResult = MQTT_FAIL_REFUSED;
+                readyAt = at + 2 * roundTrip;
+                break;
+        }
+    }
+
+    SimLinkStatus poll(uint64_t at) override {
+        now = at;
+        if (status == SIM_LINK_CONNECTING && at >= readyAt) {
+            if (connectResult == MQTT_FAIL_NONE) {
+                status = SIM_LINK_UP;
+                broker.attach(this, at);
+            } else {
+                status = SIM_LINK_DOWN;
+                failReason = connectResult;
+            }
+        }
+
+        // Обработчик может публиковать и даже оборвать связь: сообщение снимаем до вызова
+        while (status == SIM_LINK_UP && !inbox.empty() && inbox.front().at <= at) {
+            SimBroker::Message message = std::move(inbox.front());
+            inbox.pop_front();
+            deliver(message.topic.c_str(), (const uint8_t*)message.payload.data(),
+                    (unsigned int)message.payload.size());
+        }
+        return status;
+    }
+
+    MqttFailReason getFailReason() const override { return failReason; }
+
+    bool subscribe(const char* filter, uint8_t qos) override {
+        if (status != SIM_LINK_UP) return false;
+        SimBroker::Session& session = broker.sessions[clientId];
+        for (auto& subscription : session.subscriptions) {
+            if (subscription.first == filter) {
+                subscription.second = qos;
+                return true;
+            }
+        }
+        session.subscriptions.emplace_back(filter, qos);
+        return true;
+    }
+
+    bool publish(const char* topic, const char* payload, uint8_t qos) override {
+        if (status != SIM_LINK_UP) return false;
+        broker.route(topic, payload, qos, now);
+        return true;
+    }
+
+    void drop() override {
+        if (status == SIM_LINK_UP) broker.detach(this);
+        kick();
+    }
+
+    /** Соединение разорвано брокером (вытеснение или неисправность) */
+    void kick() {
+        if (status == SIM_LINK_DOWN) return;
+        status = SIM_LINK_DOWN;
+        failReason = MQTT_FAIL_LOST;
+        inbox.clear();
+    }
+
+    bool isExempt() const { return exempt; }
+
+private:
+    friend class SimBroker;
+
+    SimBroker& broker;
+    bool exempt;
+    SimLinkStatus status;
+    MqttFailReason failReason;
+    uint64_t readyAt;
+    MqttFailReason connectResult;
+    std::string clientId;
+    bool clean;
+    uint64_t now;
+    std::deque<SimBroker::Message> inbox;
+};
+
+std::unique_ptr<SimLink> SimBroker::createLink(bool exempt) {
+    return std::unique_ptr<SimLink>(new SimMemoryLink(*this, exempt));
+}
+
+void SimBroker::setFault(SimBrokerFault newFault) {
+    fault = newFault;
+    if (fault == SIM_BROKER_OK) return;
+
+    // Брокер перестал отвечать: подключенные клиенты видят разрыв
+    for (auto& entry : sessions) {
+        SimMemoryLink* link = entry.second.link;
+        if (!link || link->isExempt()) continue;
+        entry.second.link = nullptr;
+        link->kick();
+    }
+}
+
+void SimBroker::attach(SimMemoryLink* link, uint64_t now) {
+    Session& session = sessions[link->clientId];
+
+    // Client ID занят: прежний клиент отключается (MQTT 3.1.1, 3.1.4-2)
+    if (session.link && session.link != link) {
+        takeovers++;
+        session.link->kick();
+    }
+    if (link->clean) {
+        session.subscriptions.clear();
+        session.offline.clear();
+    }
+    session.clean = link->clean;
+    session.link = link;
+
+    // Сообщения QoS 1, пришедшие без клиента
+    for (Message& message : session.offline) {
+        message.at = now + oneWay;
+        link->inbox.push_back(std::move(message));
+    }
+    session.offline.clear();
+}
+
+void SimBroker::detach(SimMemoryLink* link) {
+    auto it = sessions.find(link->clientId);
+    if (it == sessions.end() || it->second.link != link) return;
+    it->second.link = nullptr;
+    if (it->second.clean) sessions.erase(it);
+}
+
+void SimBroker::route(const std::string& topic, const std::string& payload, uint8_t qos, uint64_t now) {
+    for (auto& entry : sessions) {
+        Session& session = entry.second;
+        for (const auto& subscription : session.subscriptions) {
+            if (!simTopicMatches(subscription.first.c_str(), topic.c_str())) continue;
+
+            uint8_t granted = std::min(qos, subscription.second);
+            if (session.link) {
+                session.link->inbox.push_back({ now + 2 * oneWay, topic, payload, granted });
+            } else if (granted > 0) {
+                session.offline.push_back({ 0, topic, payload, granted });
+            }
+            break;     // Одна копия на клиента, даже если совпало несколько фильтров
+        }
+    }
+}
+
+// ==================== ПОМПА ====================
+SimPump::SimPump(int deviceIndex, const FleetConfig& fleetConfig, FleetStats& fleetStats,
+                 std::unique_ptr<SimLink> brokerLink)
+    : index(deviceIndex), config(fleetConfig), stats(fleetStats), link(std::move(brokerLink)),
+      rng(fleetConfig.seed * 7919u + deviceIndex),
+      lastNetworkTime(0), connState(MQTT_CONN_DISCONNECTED), attemptStart(0),
+      pendingHead(0), nextTag(1), outboxDropped(0),
+      state(ST_IDLE), transitionPending(false), nextState(ST_IDLE), illegalTransitions(0),
+      activeTag(0), stopRequested(false), fillTarget(0), fillStart(0), servoStart(0),
+      pumpOn(false), flow(0), kettle(true), kettleBackAt(0), drinkAfter(0), useAt(0), useScheduled(false),
+      waterLevel(WATER_THRESHOLDS, WATER_LEVEL_HYSTERESIS, WATER_LEVEL_DWELL),
+      lastWaterState(-1), lastKettle(-1), lastTelemetry(0), sampledWeight(-1), sampledState(ST_INIT),
+      sampledKettle(false), sampleCount(0) {
+    // Часы: каждая помпа загружена в свое время, у четверти millis() скоро перейдет через ноль
+    std::uniform_int_distribution<uint32_t> boot(0, 3600000);
+    bootOffset = boot(rng);
+    if (index % 4 == 3) bootOffset = 0u - 30000u - bootOffset / 60;
+    driftPpm = config.driftPpm > 0 ?
+               std::uniform_int_distribution<int>(-config.driftPpm, config.driftPpm)(rng) : 0;
+
+    std::uniform_real_distribution<float> flowDist(SIM_FLOW_MIN, SIM_FLOW_MAX);
+    std::uniform_real_distribution<float> waterDist(0.0f, FULL_WATER_LEVEL);
+    pumpFlow = flowDist(rng);
+    weight = SIM_EMPTY_WEIGHT + waterDist(rng);
+
+    // Имена и топики - как MQTTManager::buildTopics()
+    char macHex[MQTT_MAC_HEX_SIZE];
+    uint64_t mac = 0x020000000000ull | (0xA1B2C30000ull + index);   // Локально администрируемый
+    uint64_t efuseMac = 0;
+    for (int i = 0; i < 6; i++) efuseMac |= ((mac >> (8 * (5 - i))) & 0xFF) << (8 * i);
+    mqttMacHex(efuseMac, macHex);
+    mqttDeviceName(deviceName, sizeof(deviceName), MQTT_DEVICE_NAME, macHex);
+    if (config.sharedClientId) {
+        mqttDeviceName(clientId, sizeof(clientId), MQTT_CLIENT_PREFIX, nullptr);
+    } else {
+        mqttDeviceName(clientId, sizeof(clientId), MQTT_CLIENT_PREFIX, macHex);
+    }
+    for (int leaf = 0; leaf < SIM_LEAF_COUNT; leaf++) {
+        mqttTopic(topics[leaf], sizeof(topics[leaf]), config.root.c_str(), deviceName, SIM_LEAF_NAMES[leaf]);
+    }
+    mqttTopic(fillingTopic, sizeof(fillingTopic), config.root.c_str(), deviceName, "filling");
+    routes[0].topic = fillingTopic;
+    routes[0].length = strlen(fillingTopic);
+    memset(pending, 0, sizeof(pending));
+
+    link->setHandler(onMessage, this);
+
+    // Первые задачи и первая попытка подключения - вразброс после включения
+    uint32_t now = millis(0);
+    nextNetwork = now + rng() % NETWORK_TASK_PERIOD;
+    nextControl = now + rng() % CONTROL_TASK_PERIOD;
+    nextPublish = now + rng() % PUBLISH_TASK_PERIOD;
+    reconnect.postpone(now, rng() % SIM_BOOT_SPREAD);
+}
+
+uint32_t SimPump::millis(uint64_t now) const {
+    return bootOffset + (uint32_t)now + (uint32_t)((int64_t)now * driftPpm / 1000000);
+}
+
+void SimPump::step(uint64_t simNow) {
+    uint32_t now = millis(simNow);
+
+    // Задачи прошивки: срок по своим часам, при отставании - один запуск и новый отсчет
+    if ((int32_t)(now - nextNetwork) >= 0) {
+        networkTask(now, simNow);
+        nextNetwork = (int32_t)(now - nextNetwork) < NETWORK_TASK_PERIOD ?
+                      nextNetwork + NETWORK_TASK_PERIOD : now + NETWORK_TASK_PERIOD;
+    }
+    if ((int32_t)(now - nextControl) >= 0) {
+        controlTask(now);
+        nextControl = (int32_t)(now - nextControl) < CONTROL_TASK_PERIOD ?
+                      nextControl + CONTROL_TASK_PERIOD : now + CONTROL_TASK_PERIOD;
+    }
+    if ((int32_t)(now - nextPublish) >= 0) {
+        publishTask(now);
+        nextPublish = (int32_t)(now - nextPublish) < PUBLISH_TASK_PERIOD ?
+                      nextPublish + PUBLISH_TASK_PERIOD : now + PUBLISH_TASK_PERIOD;
+    }
+}
+
+// ==================== СЕТЕВАЯ ЗАДАЧА ====================
+void SimPump::networkTask(uint32_t now, uint64_t simNow) {
+    // Как MQTTManager::loop(): входящие доставляются внутри poll()
+    lastNetworkTime = now;
+    SimLinkStatus status = link->poll(simNow);
+
+    switch (connState) {
+        case MQTT_CONN_DISCONNECTED:
+            if (!reconnect.isDue(now)) break;
+            reconnect.beginAttempt(now);
+            attemptStart = simNow;
+            connState = MQTT_CONN_CONNECTING;
+            link->connect(clientId, false, simNow);   // Постоянная сессия: команды ждут разрыва
+            break;
+
+        case MQTT_CONN_CONNECTING:
+        case MQTT_CONN_ESTABLISHED:
+            if (status == SIM_LINK_CONNECTING) break;
+            reconnect.attemptFinished(now);
+            if (status == SIM_LINK_UP) {
+                reconnect.succeeded();
+                if (reconnect.getSuccesses() > 1) stats.reconnects++;
+                stats.connects++;
+                recordAttempt(attemptStart, simNow, MQTT_FAIL_NONE, 0);
+                connState = MQTT_CONN_CONNECTED;
+                link->subscribe(fillingTopic, 1);
+
+                // Состояние после (пере)подключения публикуется заново
+                lastWaterState = -1;
+                lastKettle = -1;
+                drainOutbox();
+            } else {
+                MqttFailReason reason = link->getFailReason();
+                uint32_t delayMs = reconnect.failed(reason, now, rng());
+                stats.failures[reason]++;
+                recordAttempt(attemptStart, simNow, reason, delayMs);
+                connState = MQTT_CONN_DISCONNECTED;
+            }
+            break;
+
+        case MQTT_CONN_CONNECTED:
+            if (status != SIM_LINK_UP) {
+                uint32_t delayMs = reconnect.failed(MQTT_FAIL_LOST, now, rng());
+                stats.failures[MQTT_FAIL_LOST]++;
+                stats.drops++;
+                recordAttempt(simNow, simNow, MQTT_FAIL_LOST, delayMs);
+                connState = MQTT_CONN_DISCONNECTED;
+                break;
+            }
+            drainOutbox();
+            break;
+    }
+
+    // Подтверждения из обработчика сообщения - после выхода из него (как flushQueuedAcks())
+    for (const QueuedAck& ack : queuedAcks) {
+        publishAck(ack.id, ack.mode, ack.status, ack.timestamp, -1);
+    }
+    queuedAcks.clear();
+}
+
+void SimPump::recordAttempt(uint64_t start, uint64_t end, MqttFailReason result, uint32_t delayMs) {
+    SimAttempt attempt;
+    attempt.device = index;
+    attempt.start = start;
+    attempt.end = end;
+    attempt.result = result;
+    attempt.failures = reconnect.getConsecutiveFailures();
+    attempt.retryDelay = delayMs;
+    stats.attempts.push_back(attempt);
+}
+
+void SimPump::onMessage(void* context, const char* topic, const uint8_t* payload, unsigned int length) {
+    SimPump* self = (SimPump*)context;
+    if (mqttMatchRoute(self->routes, 1, topic)) {
+        self->handleFillingCommand(payload, length);
+    }
+}
+
+void SimPump::handleFillingCommand(const uint8_t* payload, unsigned int length) {
+    // Тот же прием, что в MQTTManager::handleFillingCommand()
+    stats.commandsReceived++;
+    char id[MQTT_COMMAND_ID_MAX];
+    int mode;
+    MqttCommandStatus status = mqttAcceptFillingCommand(payload, length, recentIds, mode, id,
+        [this](int m, const char* commandId) { return dispatch(m, commandId); });
+
+    const char* ackStatus = nullptr;
+    switch (status) {
+        case MQTT_COMMAND_ACCEPTED: break;
+        case MQTT_COMMAND_INVALID: ackStatus = "rejected"; break;
+        case MQTT_COMMAND_DUPLICATE: ackStatus = "duplicate"; break;
+        case MQTT_COMMAND_REJECTED: ackStatus = "rejected"; break;
+    }
+    if (ackStatus && queuedAcks.size() < SIM_ACK_QUEUE) {
+        QueuedAck ack;
+        memcpy(ack.id, id, sizeof(ack.id));
+        ack.mode = mode;
+        ack.status = ackStatus;
+        ack.timestamp = lastNetworkTime;
+        queuedAcks.push_back(ack);
+    }
+}
+
+bool SimPump::dispatch(int mode, const char* id) {
+    if (events.size() >= SIM_EVENT_QUEUE) return false;
+
+    uint16_t tag = nextTag++;
+    if (nextTag == 0) nextTag = 1;
+    // Кольцо как в dispatchFillingCommand(): ответы на вытесненную команду не публикуются
+    Pending& slot = pending[pendingHead];
+    pendingHead = (pendingHead + 1) % SIM_PENDING_COMMANDS;
+    if (slot.tag != 0) {
+        if (slot.answered) stats.evictedAccepted++;
+        else stats.evictedUnanswered++;
+    }
+    slot.tag = tag;
+    slot.mode = mode;
+    slot.answered = false;
+    memcpy(slot.id, id, sizeof(slot.id));
+
+    events.push_back({ mode, tag });
+    return true;
+}
+
+// ==================== УПРАВЛЕНИЕ ====================
+void SimPump::scheduleTransition(SystemState to) {
+    if (!isTransitionAllowed(transitionPending ? nextState : state, to)) {
+        illegalTransitions++;
+        return;
+    }
+    nextState = to;
+    transitionPending = true;
+}
+
+void SimPump::handleCommand(int mode, uint16_t tag, uint32_t now) {
+    // Те же проверки, что в StateMachine::handleMqttCommand()
+    SystemState checkState = transitionPending ? nextState : state;
+    bool accepted = false;
+    if (mode == CMD_STOP) {
+        if (checkState == ST_FILLING) {
+            stopRequested = true;
+            accepted = true;
+        }
+    } else {
+        float target = commandFillTarget(mode, weight, SIM_EMPTY_WEIGHT);
+        if (target >= 0 && checkFill(checkState, kettle, weight, SIM_EMPTY_WEIGHT, target) == FILL_CHECK_OK) {
+            scheduleTransition(ST_FILLING);
+            fillTarget = target;
+            fillStart = weight;
+            servoStart = now;
+            stopRequested = false;
+            accepted = true;
+        }
+    }
+
+    pushResult(tag, accepted ? "accepted" : "rejected", now, !accepted);
+    if (accepted && mode != CMD_STOP) {
+        activeTag = tag;
+    } else if (accepted) {
+        pushResult(tag, "completed", now, true);
+    }
+}
+
+void SimPump::pushResult(uint16_t tag, const char* status, uint32_t now, bool withVolume) {
+    results.push_back({ tag, status, now, withVolume ? volume() : -1.0f });
+}
+
+void SimPump::controlTask(uint32_t now) {
+    if (transitionPending) {
+        state = nextState;
+        transitionPending = false;
+    }
+
+    while (!events.empty()) {
+        handleCommand(events.front().mode, events.front().tag, now);
+        events.pop_front();
+    }
+
+    if (state == ST_FILLING) {
+        // Помпа включается, когда серво дошло до чайника
+        if (!pumpOn && now - servoStart >= SERVO_MOVE_TIME) pumpOn = true;
+        flow = pumpOn ? pumpFlow : 0;
+        weight += flow * CONTROL_TASK_PERIOD / 1000.0f;
+
+        const char* outcome = nullptr;
+        if (stopRequested) outcome = "stopped";
+        else if (weight >= fillTarget) outcome = "completed";
+        if (outcome) {
+            pumpOn = false;
+            flow = 0;
+            scheduleTransition(ST_IDLE);
+            if (activeTag) pushResult(activeTag, outcome, now, true);
+            activeTag = 0;
+            stopRequested = false;
+
+            // Через некоторое время чайник снимут, чтобы налить чаю
+            useAt = now + 10000 + rng() % 50000;
+            useScheduled = true;
+        }
+        return;
+    }
+
+    // Чайник снимают, выпивают часть воды и возвращают
+    if (useScheduled && state == ST_IDLE && (int32_t)(now - useAt) >= 0) {
+        useScheduled = false;
+        kettle = false;
+        std::uniform_real_distribution<float> drunk(0.2f, 0.9f);
+        drinkAfter = volume() * (1.0f - drunk(rng));
+        weight = 0;
+        kettleBackAt = now + 5000 + rng() % 15000;
+    }
+    if (!kettle && (int32_t)(now - kettleBackAt) >= 0) {
+        kettle = true;
+        weight = SIM_EMPTY_WEIGHT + drinkAfter;
+    }
+}
+
+// ==================== ПУБЛИКАЦИЯ ====================
+void SimPump::publishTask(uint32_t now) {
+    processResults();
+    publishWaterState(now);
+    publishKettleState();
+    publishTelemetry(now);
+}
+
+void SimPump::processResults() {
+    while (!results.empty()) {
+        Result result = results.front();
+        results.pop_front();
+
+        Pending* slot = nullptr;
+        for (Pending& candidate : pending) {
+            if (candidate.tag == result.tag) slot = &candidate;
+        }
+        if (!slot) continue;
+
+        publishAck(slot->id, slot->mode, result.status, result.timestamp, result.volume);
+        if (strcmp(result.status, "accepted") == 0) slot->answered = true;
+        else slot->tag = 0;
+    }
+}
+
+void SimPump::publishAck(const char* id, int mode, const char* status, uint32_t timestamp, float volumeML) {
+    if (id[0] == '\0') return;      // Команда без идентификатора не подтверждается
+    char payload[128];
+    if (mqttFormatAck(payload, sizeof(payload), id, mode, status, timestamp, volumeML) == 0) return;
+    publishState(SIM_LEAF_ACK, payload);
+}
+
+void SimPump::publishWaterState(uint32_t now) {
+    int level = 0;
+    if (kettle) {
+        level = waterLevel.update(volume(), now);
+    } else {
+        waterLevel.reset();
+    }
+    if (level == lastWaterState) return;
+
+    char payload[4];
+    snprintf(payload, sizeof(payload), "%d", level);
+    publishState(SIM_LEAF_WATER_LEVEL, payload);
+    lastWaterState = level;
+}
+
+void SimPump::publishKettleState() {
+    int value = kettle ? 1 : 0;
+    if (value == lastKettle) return;
+
+    char payload[4];
+    snprintf(payload, sizeof(payload), "%d", value);
+    publishState(SIM_LEAF_KETTLE, payload);
+    lastKettle = value;
+}
+
+void SimPump::publishTelemetry(uint32_t now) {
+    // Сэмпл - как sampleTelemetry(): во время налива каждый, в покое - заметные изменения
+    bool changed = state == ST_FILLING || state != sampledState || kettle != sampledKettle ||
+                   fabsf(weight - sampledWeight) >= SIM_TELEMETRY_STEP;
+    if (changed) {
+        sampledState = state;
+        sampledKettle = kettle;
+        sampledWeight = weight;
+        if (sampleCount == SIM_TELEMETRY_SAMPLES) {
+            memmove(&samples[0], &samples[1], (SIM_TELEMETRY_SAMPLES - 1) * sizeof(Sample));
+            sampleCount--;
+        }
+        samples[sampleCount++] = { now, weight, flow };
+    }
+
+    uint32_t interval = state == ST_FILLING ? MQTT_TELEMETRY_FAST_INTERVAL : MQTT_PUBLISH_INTERVAL;
+    if (now - lastTelemetry < interval || sampleCount == 0) return;
+
+    // Телеметрия без связи не копится
+    if (!isConnected()) {
+        sampleCount = 0;
+        return;
+    }
+
+    static const char* stateNames[] = {"INIT", "IDLE", "FILLING", "CALIBRATION", "ERROR"};
+    char buffer[SIM_TELEMETRY_JSON];
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginObject();
+    json.field("t", (unsigned long)now);
+    json.field("state", stateNames[state]);
+    json.field("weight", weight, 1);
+    json.field("volume", volume(), 0);
+    json.field("flow", flow, 1);
+    json.field("pump", pumpOn ? 1 : 0);
+    json.field("kettle", kettle ? 1 : 0);
+    if (state == ST_FILLING) json.field("target", fillTarget, 0);
+    json.beginArray("samples");
+    for (uint8_t i = 0; i < sampleCount; i++) {
+        json.beginArray();
+        json.value((unsigned long)(now - samples[i].timestamp));
+        json.value(samples[i].weight, 1);
+        json.value(samples[i].flow, 1);
+        json.endArray();
+    }
+    json.endArray();
+    json.endObject();
+
+    lastTelemetry = now;
+    sampleCount = 0;
+    if (json.finish() > 0) publishNow(SIM_LEAF_TELEMETRY, buffer);
+}
+
+void SimPump::publishState(SimLeaf leaf, const char* payload) {
+    // Как MQTTManager::publishState(): пока очередь не пуста, новые сообщения идут за ней
+    if (isConnected() && outbox.empty() && publishNow(leaf, payload)) return;
+
+    if (outbox.size() == SIM_OUTBOX) {
+        outbox.pop_front();
+        outboxDropped++;
+    }
+    outbox.push_back({ leaf, payload });
+}
+
+bool SimPump::publishNow(SimLeaf leaf, const char* payload) {
+    if (!link->publish(topics[leaf], payload, 0)) return false;
+    stats.published[leaf]++;
+    return true;
+}
+
+void SimPump::drainOutbox() {
+    while (!outbox.empty() && isConnected()) {
+        if (!publishNow(outbox.front().leaf, outbox.front().payload.c_str())) break;
+        outbox.pop_front();
+    }
+}
+
+// ==================== ДИСПЕТЧЕР ====================
+/** Строковое поле "name":"value" из плоского JSON подтверждения */
+static std::string jsonStringField(const char* json, unsigned int length, const char* name) {
+    std::string text(json, length);
+    std::string key = std::string("\"") + name + "\":\"";
+    size_t start = text.find(key);
+    if (start == std::string::npos) return std::string();
+    start += key.size();
+    size_t end = text.find('"', start);
+    return end == std::string::npos ? std::string() : text.substr(start, end - start);
+}
+
+SimCommander::SimCommander(const FleetConfig& fleetConfig, FleetStats& fleetStats,
+                           std::unique_ptr<SimLink> brokerLink)
+    : config(fleetConfig), stats(fleetStats), link(std::move(brokerLink)), rng(fleetConfig.seed),
+      connecting(false), subscribed(false), stopped(false), nextAttempt(0), nextCommand(0), now(0), nextId(1) {
+    link->setHandler(onMessage, this);
+}
+
+void SimCommander::step(uint64_t at, std::vector<std::unique_ptr<SimPump>>& pumps) {
+    now = at;
+    SimLinkStatus status = link->poll(at);
+
+    if (status == SIM_LINK_DOWN) {
+        subscribed = false;
+        if (connecting) {
+            connecting = false;
+            nextAttempt = at + 1000;
+        }
+        if (at >= nextAttempt) {
+            char clientId[32];
+            snprintf(clientId, sizeof(clientId), "fleet-commander-%u", (unsigned)config.seed);
+            link->connect(clientId, true, at);
+            connecting = true;
+        }
+        return;
+    }
+    if (status == SIM_LINK_CONNECTING) return;
+
+    if (!subscribed) {
+        static const char* leaves[] = { "ack", "telemetry", "water_level", "kettle" };
+        for (const char* leaf : leaves) {
+            std::string filter = config.root + "/+/" + leaf;
+            link->subscribe(filter.c_str(), strcmp(leaf, "ack") == 0 ? 1 : 0);
+        }
+        subscribed = true;
+        connecting = false;
+
+        // Первые команды - когда помпы успели подключиться и подписаться:
+        // без подписки брокер команду не сохранит
+        if (nextCommand == 0) nextCommand = at + 2 * SIM_BOOT_SPREAD;
+    }
+
+    while (!stopped && config.rate > 0 && at >= nextCommand) {
+        send(pumps);
+        std::exponential_distribution<double> gap(config.rate / 1000.0);
+        nextCommand += (uint64_t)gap(rng) + 1;
+    }
+}
+
+void SimCommander::send(std::vector<std::unique_ptr<SimPump>>& pumps) {
+    // Повтор - принятая команда с тем же id (автоматика не дождалась подтверждения)
+    if (!lastTopic.empty() && std::uniform_real_distribution<double>(0, 1)(rng) < config.repeat) {
+        link->publish(lastTopic.c_str(), lastPayload.c_str(), 1);
+        stats.repeatsSent++;
+        return;
+    }
+
+    // Налив чаще всего - одна-две кружки, иногда полный чайник или СТОП
+    static const int modes[] = { CMD_ONE_CUP, CMD_TWO_CUPS, CMD_FOUR_CUPS, CMD_FULL, CMD_STOP };
+    static const double weights[] = { 6, 2, 1, 1, 1 };
+    std::discrete_distribution<int> pick(std::begin(weights), std::end(weights));
+    int mode = modes[pick(rng)];
+
+    SimPump& pump = *pumps[rng() % pumps.size()];
+    char id[MQTT_COMMAND_ID_MAX];
+    char payload[40];
+    snprintf(id, sizeof(id), "c%lu", nextId++);
+    snprintf(payload, sizeof(payload), "%d:%s", mode, id);
+
+    Command& command = sent[id];
+    command.sentAt = now;
+    command.topic = pump.getFillingTopic();
+    command.payload = payload;
+    stats.commandsSent++;
+    link->publish(command.topic.c_str(), payload, 1);
+}
+
+void SimCommander::onMessage(void* context, const char* topic, const uint8_t* payload, unsigned int length) {
+    SimCommander* self = (SimCommander*)context;
+    const char* leaf = strrchr(topic, '/');
+    leaf = leaf ? leaf + 1 : topic;
+    for (int i = 0; i < SIM_LEAF_COUNT; i++) {
+        if (strcmp(leaf, SIM_LEAF_NAMES[i]) == 0) self->stats.received[i]++;
+    }
+    if (strcmp(leaf, "ack") == 0) self->handleAck((const char*)payload, length);
+}
+
+void SimCommander::handleAck(const char* payload, unsigned int length) {
+    std::string id = jsonStringField(payload, length, "id");
+    std::string status = jsonStringField(payload, length, "status");
+    stats.outcomes[status]++;
+
+    auto it = sent.find(id);
+    if (it != sent.end()) {
+        stats.rtt.push_back((double)(now - it->second.sentAt));
+        if (status == "accepted") {
+            lastTopic = it->second.topic;
+            lastPayload = it->second.payload;
+        }
+        sent.erase(it);
+    }
+
+    if (status == "accepted") {
+        accepted[id] = now;
+    } else {
+        auto started = accepted.find(id);
+        if (started != accepted.end()) {
+            if (status != "duplicate") {
+                stats.fillTimes.push_back((now - started->second) / 1000.0);
+                accepted.erase(started);
+            }
+        }
+    }
+}
+
+// ==================== ПАРК ====================
+FleetSim::FleetSim(const FleetConfig& fleetConfig, LinkFactory factory)
+    : config(fleetConfig), rng(fleetConfig.seed ^ 0x5eed) {
+    for (int i = 0; i < config.devices; i++) {
+        pumps.emplace_back(new SimPump(i, config, stats, factory(i)));
+        nextDrop.push_back(scheduleDrop(0));
+    }
+    if (config.rate > 0) commander.reset(new SimCommander(config, stats, factory(-1)));
+}
+
+uint64_t FleetSim::scheduleDrop(uint64_t now) {
+    if (config.drops <= 0) return UINT64_MAX;
+    std::exponential_distribution<double> gap(config.drops / 60000.0);
+    return now + (uint64_t)gap(rng) + 1;
+}
+
+void FleetSim::step(uint64_t now) {
+    for (size_t i = 0; i < pumps.size(); i++) {
+        pumps[i]->step(now);
+        if (now >= nextDrop[i]) {
+            if (pumps[i]->isConnected()) pumps[i]->dropLink();
+            nextDrop[i] = scheduleDrop(now);
+        }
+    }
+    if (commander) commander->step(now, pumps);
+}
+
+void FleetSim::run(uint64_t from, uint64_t to) {
+    for (uint64_t now = from; now < to; now++) step(now);
+}
+
+int FleetSim::countConnected() const {
+    int count = 0;
+    for (const auto& pump : pumps) {
+        if (pump->isConnected()) count++;
+    }
+    return count;
+}
+
+double simPercentile(std::vector<double> values, double p) {
+    if (values.empty()) return 0;
+    std::sort(values.begin(), values.end());
+    size_t k = (size_t)((values.size() - 1) * p / 100.0 + 0.5);
+    return values[std::min(k, values.size() - 1)];
+}
+
+void FleetSim::printReport(FILE* out, double seconds) const {
+    fprintf(out, "\n=== ПАРК: %zu помп, %.0f с ===\n", pumps.size(), seconds);
+    fprintf(out, "  команд отправлено %lu (повторов %lu), доставлено %lu, без подтверждения %zu\n",
+            stats.commandsSent, stats.repeatsSent, stats.commandsReceived, getUnanswered());
+    fprintf(out, "  вытеснено из ожидания подтверждения: до ответа %lu, до завершения налива %lu\n",
+            stats.evictedUnanswered, stats.evictedAccepted);
+    fprintf(out, "  задержка команда -> подтверждение: p50 %.1f мс, p95 %.1f мс, макс. %.1f мс (%zu замеров)\n",
+            simPercentile(stats.rtt, 50), simPercentile(stats.rtt, 95), simPercentile(stats.rtt, 100),
+            stats.rtt.size());
+    if (!stats.fillTimes.empty()) {
+        fprintf(out, "  налив accepted -> завершение: p50 %.1f с, макс. %.1f с\n",
+                simPercentile(stats.fillTimes, 50), simPercentile(stats.fillTimes, 100));
+    }
+    fprintf(out, "  исходы:");
+    const char* separator = " ";
+    for (const auto& outcome : stats.outcomes) {
+        fprintf(out, "%s%s %lu", separator, outcome.first.c_str(), outcome.second);
+        separator = ", ";
+    }
+    fprintf(out, "\n");
+
+    fprintf(out, "  %-12s %10s %10s %10s %12s\n", "топик", "отправлено", "получено", "в секунду", "на помпу/с");
+    unsigned long totalSent = 0;
+    unsigned long totalReceived = 0;
+    double devices = pumps.empty() ? 1 : (double)pumps.size();
+    for (int leaf = 0; leaf < SIM_LEAF_COUNT; leaf++) {
+        totalSent += stats.published[leaf];
+        totalReceived += stats.received[leaf];
+        fprintf(out, "  %-12s %10lu %10lu %10.1f %12.2f\n", SIM_LEAF_NAMES[leaf], stats.published[leaf],
+                stats.received[leaf], stats.published[leaf] / seconds, stats.published[leaf] / seconds / devices);
+    }
+    fprintf(out, "  %-12s %10lu %10lu %10.1f %12.2f\n", "всего", totalSent, totalReceived,
+            totalSent / seconds, totalSent / seconds / devices);
+
+    unsigned long outboxDropped = 0;
+    unsigned long illegal = 0;
+    for (const auto& pump : pumps) {
+        outboxDropped += pump->getOutboxDropped();
+        illegal += pump->getIllegalTransitions();
+    }
+    fprintf(out, "  подключений %lu, разрывов %lu, переподключений %lu, вытеснено из очереди %lu, "
+            "запрещенных переходов %lu\n", stats.connects, stats.drops, stats.reconnects, outboxDropped, illegal);
+    fprintf(out, "  неудачные подключения:");
+    for (int reason = MQTT_FAIL_DNS; reason < MQTT_FAIL_REASON_COUNT; reason++) {
+        fprintf(out, " %s %lu", mqttFailReasonName((MqttFailReason)reason), stats.failures[reason]);
+    }
+    fprintf(out, "\n");
+}
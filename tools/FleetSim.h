@@ -0,0 +1,448 @@
+// файл: tools/FleetSim.h
+// Имитатор парка помп на хосте: помпа на логике прошивки, брокер в памяти, диспетчер команд
+// Из прошивки берутся имена и топики (MqttTopics.h), разбор, отсев повторов и подтверждения
+// команд (MqttCommand.h), цели и проверки налива (FillCommand.h), переходы автомата
+// (StateTransitions.h), уровень воды (LevelQuantizer.h), телеметрия (JsonWriter) и учет
+// переподключений (MqttReconnect.h). Каждая помпа идет по своим часам (момент загрузки и уход
+// кварца), задачи выполняются с периодами прошивки. Связь с брокером - через SimLink: брокер в
+// памяти на виртуальном времени (test/test_fleet_sim.cpp) или TCP к настоящему брокеру
+// (tools/fleet_sim.cpp)
+
+#ifndef FLEET_SIM_H
+#define FLEET_SIM_H
+
+#include "config.h"
+#include "MqttTopics.h"
+#include "MqttCommand.h"
+#include "MqttReconnect.h"
+#include "FillCommand.h"
+#include "StateTransitions.h"
+#include "LevelQuantizer.h"
+#include <stdio.h>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ==================== ВНУТРЕННИЕ КОНСТАНТЫ ====================
+#define SIM_EMPTY_WEIGHT 800.0f        // Вес пустого чайника (г)
+#define SIM_FLOW_MIN 10.0f             // Поток помпы (г/с), у каждой помпы свой
+#define SIM_FLOW_MAX 14.0f
+#define SIM_OUTBOX 64                  // Сообщений, ждущих подключения (как очередь во флеше)
+#define SIM_BOOT_SPREAD 1000           // Первая попытка подключения - в пределах этого времени (мс)
+#define SIM_EVENT_QUEUE 16             // Как EVENT_QUEUE_SIZE
+#define SIM_PENDING_COMMANDS 4         // Как MQTT_PENDING_COMMANDS
+#define SIM_ACK_QUEUE 4                // Как MQTT_ACK_QUEUE
+#define SIM_TELEMETRY_SAMPLES 10       // Как TELEMETRY_SAMPLES
+#define SIM_TELEMETRY_JSON 448         // Как TELEMETRY_JSON_MAX
+#define SIM_TELEMETRY_STEP 1.0f        // Как TELEMETRY_WEIGHT_STEP
+#define SIM_LEAF_COUNT 4
+
+// Топики помпы, которые считает статистика
+enum SimLeaf : uint8_t { SIM_LEAF_TELEMETRY, SIM_LEAF_WATER_LEVEL, SIM_LEAF_KETTLE, SIM_LEAF_ACK };
+
+extern const char* const SIM_LEAF_NAMES[SIM_LEAF_COUNT];
+
+// ==================== СВЯЗЬ С БРОКЕРОМ ====================
+enum SimLinkStatus : uint8_t {
+    SIM_LINK_DOWN,              // Не подключены (причина - getFailReason())
+    SIM_LINK_CONNECTING,        // Идут DNS/TCP/CONNECT
+    SIM_LINK_UP
+};
+
+/**
+ * Соединение одного клиента с брокером
+ * Все шаги неблокирующие: connect() только начинает подключение,
+ * poll() продвигает его, доставляет входящие и замечает разрыв
+ * Время - общее время имитации (мс)
+ */
+class SimLink {
+public:
+    typedef void (*MessageHandler)(void* context, const char* topic,
+                                   const uint8_t* payload, unsigned int length);
+
+    SimLink() : handler(nullptr), handlerContext(nullptr) {}
+    virtual ~SimLink() {}
+
+    void setHandler(MessageHandler fn, void* context) {
+        handler = fn;
+        handlerContext = context;
+    }
+
+    /** @param cleanSession - false: брокер хранит подписки и QoS 1 на время разрыва */
+    virtual void connect(const char* clientId, bool cleanSession, uint64_t now) = 0;
+    virtual SimLinkStatus poll(uint64_t now) = 0;
+    virtual MqttFailReason getFailReason() const = 0;
+    virtual bool subscribe(const char* filter, uint8_t qos) = 0;
+    virtual bool publish(const char* topic, const char* payload, uint8_t qos) = 0;
+
+    /** Обрыв без DISCONNECT: следующий poll() вернет SIM_LINK_DOWN с MQTT_FAIL_LOST */
+    virtual void drop() = 0;
+
+protected:
+    void deliver(const char* topic, const uint8_t* payload, unsigned int length) {
+        if (handler) handler(handlerContext, topic, payload, length);
+    }
+
+private:
+    MessageHandler handler;
+    void* handlerContext;
+};
+
+/** Соответствие топика фильтру подписки с + и # */
+bool simTopicMatches(const char* filter, const char* topic);
+
+// ==================== БРОКЕР В ПАМЯТИ ====================
+/**
+ * Неисправность брокера: как выглядит попытка подключения
+ */
+enum SimBrokerFault : uint8_t {
+    SIM_BROKER_OK,
+    SIM_BROKER_REFUSED,         // Порт закрыт: TCP отклоняется сразу
+    SIM_BROKER_BLACKHOLE,       // Пакеты теряются: TCP не устанавливается за MQTT_TCP_TIMEOUT
+    SIM_BROKER_SILENT,          // TCP есть, CONNACK нет: ожидание MQTT_CONNACK_TIMEOUT
+    SIM_BROKER_DENY             // CONNACK с отказом (неверные логин/пароль)
+};
+
+class SimMemoryLink;
+
+/**
+ * Брокер MQTT в памяти
+ * - Постоянные сессии: подписки и сообщения QoS 1 ждут переподключения клиента
+ * - Client ID уникален: подключение с занятым ID отключает прежнего клиента
+ * - Задержка сети в одну сторону - oneWayMs, порядок сообщений сохраняется
+ * - Неисправность (setFault) рвет работающие соединения и меняет исход новых попыток
+ */
+class SimBroker {
+public:
+    explicit SimBroker(uint32_t oneWayMs = 5) : oneWay(oneWayMs), fault(SIM_BROKER_OK), takeovers(0) {}
+
+    void setFault(SimBrokerFault newFault);
+    SimBrokerFault getFault() const { return fault; }
+    uint32_t getOneWay() const { return oneWay; }
+    unsigned long getTakeovers() const { return takeovers; }
+
+    /** @param exempt - соединение не затрагивают неисправности (диспетчер рядом с брокером) */
+    std::unique_ptr<SimLink> createLink(bool exempt = false);
+
+private:
+    friend class SimMemoryLink;
+
+    struct Message {
+        uint64_t at;               // Когда дойдет до клиента
+        std::string topic;
+        std::string payload;
+        uint8_t qos;
+    };
+
+    struct Session {
+        std::vector<std::pair<std::string, uint8_t>> subscriptions;
+        std::deque<Message> offline;   // QoS 1, пришедшие без клиента
+        SimMemoryLink* link = nullptr; // Подключенный клиент
+        bool clean = true;             // Сессия удаляется при отключении
+    };
+
+    uint32_t oneWay;
+    SimBrokerFault fault;
+    unsigned long takeovers;
+    std::map<std::string, Session> sessions;
+
+    void attach(SimMemoryLink* link, uint64_t now);
+    void detach(SimMemoryLink* link);
+    void route(const std::string& topic, const std::string& payload, uint8_t qos, uint64_t now);
+};
+
+// ==================== ПОМПА ====================
+/**
+ * Запись о попытке подключения или разрыве (для проверки пауз между попытками)
+ */
+struct SimAttempt {
+    int device;
+    uint64_t start;            // Время имитации начала попытки (у разрыва - момент разрыва)
+    uint64_t end;
+    MqttFailReason result;     // MQTT_FAIL_NONE - подключились
+    uint32_t failures;         // Неудач подряд после попытки
+    uint32_t retryDelay;       // Назначенная пауза до следующей попытки (мс по часам помпы)
+};
+
+struct FleetConfig;
+struct FleetStats;
+
+/**
+ * Виртуальная помпа
+ * - Задачи по своим часам с периодами прошивки: сеть (NETWORK_TASK_PERIOD),
+ *   управление (CONTROL_TASK_PERIOD), публикация (PUBLISH_TASK_PERIOD)
+ * - Команда проверяется сразу (как handleEvent), переход выполняет такт управления,
+ *   помпа включается после хода серво, результат публикует задача публикации
+ * - Чайник: налив с потоком помпы, затем чайник снимают, выпивают часть воды и возвращают
+ */
+class SimPump {
+public:
+    SimPump(int index, const FleetConfig& config, FleetStats& stats, std::unique_ptr<SimLink> link);
+
+    void step(uint64_t now);
+
+    /** Часы помпы: момент загрузки и уход кварца */
+    uint32_t millis(uint64_t now) const;
+
+    const char* getClientId() const { return clientId; }
+    const char* getFillingTopic() const { return fillingTopic; }
+    bool isConnected() const { return connState == MQTT_CONN_CONNECTED; }
+    const MqttReconnect& getReconnect() const { return reconnect; }
+    SystemState getState() const { return state; }
+    unsigned long getIllegalTransitions() const { return illegalTransitions; }
+    unsigned long getOutboxDropped() const { return outboxDropped; }
+
+    /** Обрыв связи (имитация потери Wi-Fi) */
+    void dropLink() { link->drop(); }
+
+private:
+    struct Pending {
+        uint16_t tag;              // 0 - слот свободен
+        int mode;
+        bool answered;             // accepted уже отправлено, ждем завершения налива
+        char id[MQTT_COMMAND_ID_MAX];
+    };
+
+    struct Command {
+        int mode;
+        uint16_t tag;
+    };
+
+    struct Result {
+        uint16_t tag;
+        const char* status;
+        uint32_t timestamp;
+        float volume;              // Меньше 0 - без поля volume
+    };
+
+    struct QueuedAck {
+        char id[MQTT_COMMAND_ID_MAX];
+        int mode;
+        const char* status;
+        uint32_t timestamp;
+    };
+
+    struct Queued {
+        SimLeaf leaf;
+        std::string payload;
+    };
+
+    struct Sample {
+        uint32_t timestamp;
+        float weight;
+        float flow;
+    };
+
+    int index;
+    const FleetConfig& config;
+    FleetStats& stats;
+    std::unique_ptr<SimLink> link;
+    std::mt19937 rng;
+
+    // Часы
+    uint32_t bootOffset;
+    int32_t driftPpm;
+    uint32_t nextNetwork;
+    uint32_t nextControl;
+    uint32_t nextPublish;
+    uint32_t lastNetworkTime;
+
+    // Имена и топики (как MQTTManager::buildTopics)
+    char deviceName[32];
+    char clientId[32];
+    char topics[SIM_LEAF_COUNT][96];
+    char fillingTopic[96];
+    struct Route {
+        const char* topic;
+        size_t length;
+    } routes[1];
+
+    // Подключение
+    MqttConnState connState;
+    MqttReconnect reconnect;
+    uint64_t attemptStart;
+
+    // Команды
+    RecentCommandIds recentIds;
+    Pending pending[SIM_PENDING_COMMANDS];
+    uint8_t pendingHead;
+    uint16_t nextTag;
+    std::deque<Command> events;        // Очередь событий задачи управления
+    std::deque<Result> results;
+    std::vector<QueuedAck> queuedAcks;
+    std::deque<Queued> outbox;
+    unsigned long outboxDropped;
+
+    // Автомат и чайник
+    SystemState state;
+    bool transitionPending;
+    SystemState nextState;
+    unsigned long illegalTransitions;
+    uint16_t activeTag;
+    bool stopRequested;
+    float fillTarget;
+    float fillStart;
+    uint32_t servoStart;
+    bool pumpOn;
+    float pumpFlow;            // Поток этой помпы (г/с)
+    float flow;                // Текущий поток (г/с)
+    float weight;              // Вес на весах (г)
+    bool kettle;
+    uint32_t kettleBackAt;     // Когда вернут снятый чайник
+    float drinkAfter;          // Сколько воды останется в вернувшемся чайнике (мл)
+    uint32_t useAt;            // Когда снимут чайник после налива
+    bool useScheduled;
+
+    // Публикации
+    LevelQuantizer<3> waterLevel;
+    int lastWaterState;
+    int lastKettle;
+    uint32_t lastTelemetry;
+    float sampledWeight;
+    SystemState sampledState;
+    bool sampledKettle;
+    uint8_t sampleCount;
+    Sample samples[SIM_TELEMETRY_SAMPLES];
+
+    void networkTask(uint32_t now, uint64_t simNow);
+    void controlTask(uint32_t now);
+    void publishTask(uint32_t now);
+
+    static void onMessage(void* context, const char* topic, const uint8_t* payload, unsigned int length);
+    void handleFillingCommand(const uint8_t* payload, unsigned int length);
+    bool dispatch(int mode, const char* id);
+    void handleCommand(int mode, uint16_t tag, uint32_t now);
+    void pushResult(uint16_t tag, const char* status, uint32_t now, bool withVolume);
+    void scheduleTransition(SystemState to);
+    void processResults();
+
+    void publishAck(const char* id, int mode, const char* status, uint32_t timestamp, float volumeML);
+    void publishState(SimLeaf leaf, const char* payload);
+    bool publishNow(SimLeaf leaf, const char* payload);
+    void drainOutbox();
+    void publishWaterState(uint32_t now);
+    void publishKettleState();
+    void publishTelemetry(uint32_t now);
+    void recordAttempt(uint64_t start, uint64_t end, MqttFailReason result, uint32_t delayMs);
+    float volume() const { return kettle && weight > SIM_EMPTY_WEIGHT ? weight - SIM_EMPTY_WEIGHT : 0; }
+};
+
+// ==================== ДИСПЕТЧЕР ====================
+/**
+ * Автоматика на стороне сервера: шлет команды случайным помпам с QoS 1,
+ * часть - повтор последней принятой команды с тем же id (помпа должна ответить
+ * duplicate), слушает подтверждения и публикации всех помп
+ */
+class SimCommander {
+public:
+    SimCommander(const FleetConfig& config, FleetStats& stats, std::unique_ptr<SimLink> link);
+
+    void step(uint64_t now, std::vector<std::unique_ptr<SimPump>>& pumps);
+    bool isReady() const { return subscribed; }
+
+    /** Больше не слать команды (ответы на отправленные продолжают приходить) */
+    void stop() { stopped = true; }
+    size_t getUnanswered() const { return sent.size(); }
+
+private:
+    struct Command {
+        uint64_t sentAt;
+        std::string topic;
+        std::string payload;
+    };
+
+    const FleetConfig& config;
+    FleetStats& stats;
+    std::unique_ptr<SimLink> link;
+    std::mt19937 rng;
+    bool connecting;
+    bool subscribed;
+    bool stopped;
+    uint64_t nextAttempt;
+    uint64_t nextCommand;
+    uint64_t now;
+    unsigned long nextId;
+    std::string lastTopic;                               // Последняя принятая команда - для повторов
+    std::string lastPayload;
+    std::unordered_map<std::string, Command> sent;       // Команды без ответа по id
+    std::unordered_map<std::string, uint64_t> accepted;  // id -> когда пришло accepted
+
+    static void onMessage(void* context, const char* topic, const uint8_t* payload, unsigned int length);
+    void handleAck(const char* payload, unsigned int length);
+    void send(std::vector<std::unique_ptr<SimPump>>& pumps);
+};
+
+// ==================== ПАРК ====================
+struct FleetConfig {
+    int devices = 20;
+    double rate = 2;               // Команд в секунду на весь парк (0 - без диспетчера)
+    double repeat = 0.05;          // Доля команд, отправленных повторно с тем же id
+    double drops = 0;              // Обрывов связи на помпу в минуту
+    uint32_t seed = 1;
+    int driftPpm = 100;            // Уход часов помп: до +-driftPpm
+    bool sharedClientId = false;   // Все помпы с одним Client ID (как до уникальных ID)
+    std::string root = MQTT_TOPIC_ROOT;
+};
+
+struct FleetStats {
+    unsigned long published[SIM_LEAF_COUNT] = {};   // Отправлено помпами
+    unsigned long received[SIM_LEAF_COUNT] = {};    // Получено диспетчером через брокер
+    std::map<std::string, unsigned long> outcomes;  // Статус подтверждения -> число
+    std::vector<double> rtt;                        // Команда -> первое подтверждение (мс)
+    std::vector<double> fillTimes;                  // accepted -> завершение налива (с)
+    std::vector<SimAttempt> attempts;
+    unsigned long commandsSent = 0;
+    unsigned long repeatsSent = 0;
+    unsigned long commandsReceived = 0;             // Доставлено помпам (с повторами)
+    unsigned long evictedUnanswered = 0;            // Слот ожидания вытеснен до первого ответа
+    unsigned long evictedAccepted = 0;              // ...после accepted, до завершения налива
+    unsigned long connects = 0;
+    unsigned long reconnects = 0;
+    unsigned long drops = 0;                        // Разрывов работающего соединения
+    unsigned long failures[MQTT_FAIL_REASON_COUNT] = {};
+};
+
+/**
+ * Парк помп и диспетчер
+ * Соединения (SimLink) создает фабрика: device >= 0 - помпа, -1 - диспетчер
+ */
+class FleetSim {
+public:
+    typedef std::function<std::unique_ptr<SimLink>(int device)> LinkFactory;
+
+    FleetSim(const FleetConfig& config, LinkFactory factory);
+
+    /** Один шаг общего времени: все помпы выполняют задачи, срок которых наступил по их часам */
+    void step(uint64_t now);
+
+    /** Прогон на виртуальном времени с шагом 1 мс */
+    void run(uint64_t from, uint64_t to);
+
+    const FleetStats& getStats() const { return stats; }
+    std::vector<std::unique_ptr<SimPump>>& getPumps() { return pumps; }
+    SimCommander* getCommander() { return commander.get(); }
+    size_t getUnanswered() const { return commander ? commander->getUnanswered() : 0; }
+    int countConnected() const;
+
+    void printReport(FILE* out, double seconds) const;
+
+private:
+    FleetConfig config;
+    FleetStats stats;
+    std::vector<std::unique_ptr<SimPump>> pumps;
+    std::unique_ptr<SimCommander> commander;
+    std::mt19937 rng;
+    std::vector<uint64_t> nextDrop;
+
+    uint64_t scheduleDrop(uint64_t now);
+};
+
+/** Значение перцентиля p (0-100) */
+double simPercentile(std::vector<double> values, double p);
+
+#endif
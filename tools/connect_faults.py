@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+# файл: tools/connect_faults.py
+# Подключение к брокеру при отказах сети: причины неудач, длительность попыток и паузы
+# между ними - на логике прошивки (MqttReconnect.h, Backoff.h) через имитатор парка
+#
+# Запуск (нужен только g++ и Linux, брокер не нужен):
+#     python3 tools/connect_faults.py
+#
+# Для каждого сценария поднимается локальный порт, к нему подключаются помпы
+# test/build/fleet_sim --trace (собирается через make -C test build/fleet_sim):
+#   refused   - порт закрыт: TCP отклоняется сразу            -> tcp, доли мс
+#   blackhole - очередь accept() заполнена, SYN теряются      -> tcp, MQTT_TCP_TIMEOUT
+#   silent    - TCP принимается, CONNACK не приходит          -> timeout, MQTT_CONNACK_TIMEOUT
+#   deny      - CONNACK с кодом 5 (не авторизован)             -> refused, доли мс
+# Проверяется: у каждой попытки ожидаемая причина и длительность, следующая попытка -
+# через назначенную паузу, пауза - в границах backoffDelay() для числа неудач подряд,
+# счетчики неудач в отчете совпадают с попытками. Код выхода 1 - есть нарушения.
+
+import argparse
+import os
+import re
+import socket
+import subprocess
+import sys
+import threading
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Допуски по настоящим часам: шаг сетевой задачи добавляется отдельно
+SLACK_MS = 40                   # Планирование процесса и опрос раз в 1 мс
+DRIFT_PPM = 100                 # FleetConfig::driftPpm по умолчанию
+
+
+def read_define(path, name):
+    with open(os.path.join(ROOT, path), encoding='utf-8') as f:
+        match = re.search(r'#define\s+%s\s+(\d+)' % name, f.read())
+    if not match:
+        sys.exit('%s: нет #define %s' % (path, name))
+    return int(match.group(1))
+
+
+BACKOFF_MIN = read_define('MqttReconnect.h', 'MQTT_BACKOFF_MIN')
+BACKOFF_MAX = read_define('MqttReconnect.h', 'MQTT_BACKOFF_MAX')
+TCP_TIMEOUT = read_define('MqttReconnect.h', 'MQTT_TCP_TIMEOUT')
+CONNACK_TIMEOUT = read_define('MqttReconnect.h', 'MQTT_CONNACK_TIMEOUT') * 1000
+NETWORK_PERIOD = read_define('config.h', 'NETWORK_TASK_PERIOD')
+
+
+def backoff_base(failures):
+    # Основа паузы как в backoffDelay(): удвоение до предела
+    delay = BACKOFF_MIN
+    for _ in range(1, failures):
+        if delay >= BACKOFF_MAX:
+            break
+        delay = BACKOFF_MAX if delay > BACKOFF_MAX // 2 else delay * 2
+    return min(delay, BACKOFF_MAX)
+
+
+# ==================== ПОРТЫ С ОТКАЗАМИ ====================
+class Listener:
+    def __init__(self, backlog=64):
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self.sock.bind(('127.0.0.1', 0))
+        self.sock.listen(backlog)
+        self.port = self.sock.getsockname()[1]
+        self.keep = []
+
+    def close(self):
+        for s in self.keep:
+            s.close()
+        self.sock.close()
+
+
+def refused_port():
+    # Свободный порт: привязать и сразу закрыть, на SYN ядро ответит RST
+    listener = Listener()
+    port = listener.port
+    listener.close()
+    return port, None
+
+
+def blackhole_port():
+    # Очередь accept() заполнена и никто ее не разбирает: новые SYN ядро отбрасывает
+    listener = Listener(backlog=0)
+    for _ in range(4):
+        filler = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        filler.setblocking(False)
+        try:
+            filler.connect(('127.0.0.1', listener.port))
+        except BlockingIOError:
+            pass
+        listener.keep.append(filler)
+    return listener.port, listener
+
+
+def silent_port():
+    # Ядро завершает TCP, но CONNECT никто не читает и CONNACK не отправляет
+    listener = Listener()
+    return listener.port, listener
+
+
+def deny_port():
+    # Брокер отвечает CONNACK с кодом 5 и закрывает соединение
+    listener = Listener()
+
+    def serve():
+        while True:
+            try:
+                conn, _ = listener.sock.accept()
+            except OSError:
+                return
+            try:
+                conn.recv(1024)
+                conn.sendall(b'\x20\x02\x00\x05')
+            except OSError:
+                pass
+            conn.close()
+
+    threading.Thread(target=serve, daemon=True).start()
+    return listener.port, listener
+
+
+# Сценарий: порт, ожидаемая причина, длительность попытки (мс): минимум и максимум
+SCENARIOS = [
+    ('refused', refused_port, 'tcp', 0, SLACK_MS),
+    ('blackhole', blackhole_port, 'tcp', TCP_TIMEOUT, TCP_TIMEOUT + NETWORK_PERIOD + SLACK_MS),
+    ('silent', silent_port, 'timeout', CONNACK_TIMEOUT, CONNACK_TIMEOUT + 2 * NETWORK_PERIOD + SLACK_MS),
+    ('deny', deny_port, 'refused', 0, NETWORK_PERIOD + SLACK_MS),
+]
+
+ATTEMPT = re.compile(r'attempt device=(\d+) start=(\d+) end=(\d+) result=(\w+) failures=(\d+) delay=(\d+)')
+FAILURES = re.compile(r'неудачные подключения:(.*)')
+
+
+def run_scenario(binary, name, make_port, reason, min_ms, max_ms, args):
+    port, listener = make_port()
+    try:
+        output = subprocess.run(
+            [binary, '--broker', '127.0.0.1', '--port', str(port), '--devices', str(args.devices),
+             '--rate', '0', '--duration', str(args.duration), '--seed', str(args.seed), '--trace'],
+            check=True, capture_output=True, text=True).stdout
+    finally:
+        if listener:
+            listener.close()
+
+    attempts = [tuple(int(g) if g.isdigit() else g for g in m.groups()) for m in ATTEMPT.finditer(output)]
+    counts = {}
+    match = FAILURES.search(output)
+    if match:
+        for key, value in re.findall(r'(\w+) (\d+)', match.group(1)):
+            counts[key] = int(value)
+
+    errors = []
+    if len(attempts) < 2 * args.devices:
+        errors.append('попыток %d, ожидалось не меньше %d' % (len(attempts), 2 * args.devices))
+
+    latencies = []
+    spacing_error = 0
+    for device in range(args.devices):
+        own = [a for a in attempts if a[0] == device]
+        for i, (_, start, end, result, failures, delay) in enumerate(own):
+            took = end - start
+            latencies.append(took)
+            if result != reason:
+                errors.append('помпа %d: причина %s вместо %s' % (device, result, reason))
+            if not min_ms <= took <= max_ms:
+                errors.append('помпа %d: попытка %d мс, ожидалось %d..%d' % (device, took, min_ms, max_ms))
+            if failures != i + 1:
+                errors.append('помпа %d: неудач подряд %d вместо %d' % (device, failures, i + 1))
+            base = backoff_base(failures)
+            if not base // 2 <= delay <= base:
+                errors.append('помпа %d: пауза %d мс вне [%d, %d]' % (device, delay, base // 2, base))
+
+            # Следующая попытка - через паузу по часам помпы, с шагом сетевой задачи
+            if i + 1 < len(own):
+                gap = own[i + 1][1] - end
+                drift = delay * DRIFT_PPM / 1e6
+                if gap < delay - drift - 1 or gap > delay + drift + NETWORK_PERIOD + SLACK_MS:
+                    errors.append('помпа %d: следующая попытка через %d мс при паузе %d мс' % (device, gap, delay))
+                spacing_error = max(spacing_error, abs(gap - delay))
+
+    expected = {}
+    for attempt in attempts:
+        expected[attempt[3]] = expected.get(attempt[3], 0) + 1
+    for key in ('dns', 'tcp', 'timeout', 'refused', 'lost'):
+        if counts.get(key, 0) != expected.get(key, 0):
+            errors.append('отчет: %s %d, по попыткам %d' % (key, counts.get(key, 0), expected.get(key, 0)))
+
+    print('%-10s %-8s %8d %10d %10d %14d  %s' % (
+        name, reason, len(attempts), min(latencies or [0]), max(latencies or [0]), spacing_error,
+        'OK' if not errors else 'ОШИБКИ: %d' % len(errors)))
+    for error in errors[:10]:
+        print('    ' + error)
+    return not errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Отказы подключения к брокеру на имитаторе парка')
+    parser.add_argument('--fleet-sim', default=os.path.join(ROOT, 'test', 'build', 'fleet_sim'),
+                        help='собранный tools/fleet_sim.cpp')
+    parser.add_argument('--devices', type=int, default=3, help='помп в каждом сценарии')
+    parser.add_argument('--duration', type=float, default=30, help='длительность сценария (с)')
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('--only', choices=[s[0] for s in SCENARIOS], help='один сценарий')
+    args = parser.parse_args()
+
+    if not os.path.exists(args.fleet_sim):
+        subprocess.run(['make', '-C', os.path.join(ROOT, 'test'), 'build/fleet_sim'], check=True)
+
+    print('%-10s %-8s %8s %10s %10s %14s' % ('сценарий', 'причина', 'попыток', 'мин. мс', 'макс. мс',
+                                             'откл. паузы мс'))
+    ok = True
+    for name, make_port, reason, min_ms, max_ms in SCENARIOS:
+        if args.only and args.only != name:
+            continue
+        ok = run_scenario(args.fleet_sim, name, make_port, reason, min_ms, max_ms, args) and ok
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+# файл: tools/embed_web_assets.py
+# Сборка веб-ресурсов из data/ в WebAssets.h: минификация, gzip, ETag
+#
+# Запуск из корня проекта после любого изменения файлов в data/:
+#     python3 tools/embed_web_assets.py
+# Результат (WebAssets.h) хранится в репозитории, потому что Arduino IDE
+# не умеет запускать шаги сборки перед компиляцией.
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DATA_DIR = os.path.join(ROOT, "data")
+OUTPUT = os.path.join(ROOT, "WebAssets.h")
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".png": "image/png",
+    ".jpg": "image/jpeg",
+    ".ico": "image/x-icon",
+}
+
+# Минификация консервативная: переводы строк в JS сохраняются
+# (на них опирается автоматическая расстановка точек с запятой)
+
+
+def minify_html(text):
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    lines = (line.strip() for line in text.splitlines())
+    return "\n".join(line for line in lines if line)
+
+
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    lines = (line.strip() for line in text.splitlines())
+    return "\n".join(line for line in lines if line)
+
+
+def minify_js(text):
+    lines = (line.strip() for line in text.splitlines())
+    return "\n".join(line for line in lines if line and not line.startswith("//"))
+
+
+MINIFIERS = {".html": minify_html, ".css": minify_css, ".js": minify_js}
+
+
+def c_name(filename):
+    return "ASSET_" + re.sub(r"[^A-Za-z0-9]", "_", filename).upper()
+
+
+def c_bytes(data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(rows)
+
+
+def main():
+    files = sorted(f for f in os.listdir(DATA_DIR)
+                   if os.path.splitext(f)[1] in CONTENT_TYPES)
+
+    # Сначала ресурсы, на которые ссылаются страницы: их версия входит в URL
+    sources = {}
+    for name in files:
+        with open(os.path.join(DATA_DIR, name), "rb") as f:
+            sources[name] = f.read()
+
+    assets = {}
+    order = sorted(files, key=lambda f: f.endswith(".html"))
+    for name in order:
+        ext = os.path.splitext(name)[1]
+        raw = sources[name]
+        body = raw
+        if ext in MINIFIERS:
+            text = raw.decode("utf-8")
+            if ext == ".html":
+                # Ссылки на версионные ресурсы: /style.css -> /style.css?v=<хеш>
+                for ref, asset in assets.items():
+                    if asset["immutable"]:
+                        text = text.replace('"/%s"' % ref, '"/%s?v=%s"' % (ref, asset["hash"]))
+            body = MINIFIERS[ext](text).encode("utf-8")
+
+        # mtime=0 - одинаковый вход дает одинаковый WebAssets.h
+        packed = gzip.compress(body, compresslevel=9, mtime=0)
+        assets[name] = {
+            "raw": len(raw),
+            "minified": len(body),
+            "gzip": packed,
+            "hash": hashlib.sha256(body).hexdigest()[:10],
+            "type": CONTENT_TYPES[ext],
+            # Страницы открываются по постоянным адресам - их только перепроверяем
+            "immutable": ext != ".html",
+        }
+
+    out = []
+    out.append("// файл: WebAssets.h")
+    out.append("// Веб-ресурсы из data/, сжатые gzip и встроенные в прошивку")
+    out.append("// Сгенерировано tools/embed_web_assets.py - не редактировать вручную")
+    out.append("")
+    out.append("#ifndef WEB_ASSETS_H")
+    out.append("#define WEB_ASSETS_H")
+    out.append("")
+    out.append('#include "WebAsset.h"')
+    out.append("")
+    for name in files:
+        a = assets[name]
+        out.append("// %s: %d -> %d (мин.) -> %d (gzip) байт"
+                   % (name, a["raw"], a["minified"], len(a["gzip"])))
+        out.append("static constexpr uint8_t %s[] = {" % c_name(name))
+        out.append(c_bytes(a["gzip"]))
+        out.append("};")
+        out.append("")
+    out.append("static constexpr WebAsset WEB_ASSETS[] = {")
+    for name in files:
+        a = assets[name]
+        out.append('    { "/%s", "%s", %s, sizeof(%s), %d, "\\"%s\\"", %s },'
+                   % (name, a["type"], c_name(name), c_name(name), a["raw"],
+                      a["hash"], "true" if a["immutable"] else "false"))
+    out.append("};")
+    out.append("")
+    out.append("static constexpr size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);")
+    out.append("")
+    out.append("#endif")
+    out.append("")
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+    # Отчет о размерах: что браузер скачивает при загрузке страниц
+    print("%-16s %8s %8s %8s" % ("file", "raw", "minified", "gzip"))
+    for name in files:
+        a = assets[name]
+        print("%-16s %8d %8d %8d" % (name, a["raw"], a["minified"], len(a["gzip"])))
+
+    pages = {"dashboard.html": ["style.css", "script.js"], "login.html": ["style.css"]}
+    for page, deps in pages.items():
+        if page not in assets:
+            continue
+        group = [page] + [d for d in deps if d in assets]
+        raw = sum(assets[n]["raw"] for n in group)
+        packed = sum(len(assets[n]["gzip"]) for n in group)
+        print("page %-11s %8d -> %d bytes (%.0f%%)" % (page, raw, packed, 100.0 * packed / raw))
+
+    print("wrote %s" % os.path.relpath(OUTPUT, ROOT))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
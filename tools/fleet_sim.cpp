@@ -0,0 +1,401 @@
+// файл: tools/fleet_sim.cpp
+// Имитатор парка помп (tools/FleetSim.h) против настоящего брокера или брокера в памяти
+//
+// Сборка и запуск (локальный брокер, 50 помп, 5 команд в секунду, 2 минуты):
+//     make -C test build/fleet_sim
+//     test/build/fleet_sim --broker 127.0.0.1 --devices 50 --rate 5 --duration 120
+//
+// Помпы - логика прошивки (имена, топики, разбор команд, проверки налива, уровень воды,
+// учет переподключений), каждая на своих часах и со своим TCP-соединением; отдельный
+// клиент-диспетчер шлет команды "<код>:<id>" и слушает публикации помп. В конце - отчет
+// FleetSim::printReport(). Параметры:
+//   --broker, --port, --user, --password   брокер (по умолчанию 127.0.0.1:1883)
+//   --root                                  MQTT_TOPIC_ROOT
+//   --devices, --rate, --repeat, --drops    помп, команд в секунду, доля повторов,
+//                                           обрывов на помпу в минуту
+//   --duration, --seed                      длительность (с), зерно генератора
+//   --shared-id                             один Client ID на всех (как до уникальных ID)
+//   --trace                                 каждая попытка подключения строкой attempt ...
+//   --virtual [--latency мс] [--fault вид]  брокер в памяти на виртуальном времени;
+//                                           вид: refused, blackhole, silent, deny
+
+#include "FleetSim.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#define MQTT_KEEPALIVE_S 15            // Как MQTT_KEEPALIVE у PubSubClient
+#define RX_CHUNK 4096
+#define DRAIN_MS 2000                  // После --duration: без новых команд дождаться ответов
+
+struct BrokerAddress {
+    const char* host = "127.0.0.1";
+    int port = 1883;
+    const char* user = nullptr;
+    const char* password = nullptr;
+};
+
+// ==================== MQTT 3.1.1 ПОВЕРХ TCP ====================
+/**
+ * Минимальный клиент MQTT 3.1.1 на неблокирующем сокете
+ * Шаги и причины неудач - как в MQTTManager::connect(): DNS, TCP за MQTT_TCP_TIMEOUT,
+ * CONNACK за MQTT_CONNACK_TIMEOUT
+ */
+class TcpLink : public SimLink {
+public:
+    explicit TcpLink(const BrokerAddress& brokerAddress)
+        : address(brokerAddress), fd(-1), phase(PHASE_DOWN), failReason(MQTT_FAIL_NONE),
+          deadline(0), lastSent(0), nextPacketId(1) {}
+
+    ~TcpLink() override { closeSocket(); }
+
+    void connect(const char* clientId, bool cleanSession, uint64_t now) override {
+        closeSocket();
+        rx.clear();
+        tx.clear();
+        failReason = MQTT_FAIL_NONE;
+
+        // ===== ШАГ 1: DNS =====
+        char port[8];
+        snprintf(port, sizeof(port), "%d", address.port);
+        addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo* result = nullptr;
+        if (getaddrinfo(address.host, port, &hints, &result) != 0 || !result) {
+            fail(MQTT_FAIL_DNS);
+            return;
+        }
+
+        // ===== ШАГ 2: TCP без блокировки, с таймаутом =====
+        fd = socket(result->ai_family, SOCK_STREAM, 0);
+        if (fd >= 0) fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        int rc = fd >= 0 ? ::connect(fd, result->ai_addr, result->ai_addrlen) : -1;
+        freeaddrinfo(result);
+        if (rc != 0 && errno != EINPROGRESS) {
+            fail(MQTT_FAIL_TCP);
+            return;
+        }
+        phase = PHASE_TCP;
+        deadline = now + MQTT_TCP_TIMEOUT;
+
+        // CONNECT уходит, как только сокет подключится
+        std::string body;
+        appendString(body, "MQTT");
+        body += (char)4;                                        // Версия 3.1.1
+        uint8_t flags = cleanSession ? 0x02 : 0x00;
+        if (address.user) flags |= 0x80;
+        if (address.password) flags |= 0x40;
+        body += (char)flags;
+        body += (char)(MQTT_KEEPALIVE_S >> 8);
+        body += (char)(MQTT_KEEPALIVE_S & 0xFF);
+        appendString(body, clientId);
+        if (address.user) appendString(body, address.user);
+        if (address.password) appendString(body, address.password);
+        queuePacket(0x10, body);
+    }
+
+    SimLinkStatus poll(uint64_t now) override {
+        if (phase == PHASE_TCP) {
+            pollfd pfd = { fd, POLLOUT, 0 };
+            if (::poll(&pfd, 1, 0) > 0) {
+                int error = 0;
+                socklen_t length = sizeof(error);
+                getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &length);
+                if (error != 0) {
+                    fail(MQTT_FAIL_TCP);               // ECONNREFUSED и другие отказы
+                } else {
+                    phase = PHASE_CONNACK;
+                    deadline = now + MQTT_CONNACK_TIMEOUT * 1000;
+                }
+            } else if (now >= deadline) {
+                fail(MQTT_FAIL_TCP);                   // SYN без ответа
+            }
+        }
+
+        if (phase == PHASE_CONNACK || phase == PHASE_UP) {
+            flush(now);
+            receive();
+            if (phase == PHASE_CONNACK && now >= deadline) fail(MQTT_FAIL_TIMEOUT);
+            if (phase == PHASE_UP && now - lastSent >= MQTT_KEEPALIVE_S * 1000 / 2) {
+                queuePacket(0xC0, std::string());      // PINGREQ
+                flush(now);
+            }
+        }
+
+        switch (phase) {
+            case PHASE_UP: return SIM_LINK_UP;
+            case PHASE_DOWN: return SIM_LINK_DOWN;
+            default: return SIM_LINK_CONNECTING;
+        }
+    }
+
+    MqttFailReason getFailReason() const override { return failReason; }
+
+    bool subscribe(const char* filter, uint8_t qos) override {
+        if (phase != PHASE_UP) return false;
+        std::string body;
+        appendPacketId(body);
+        appendString(body, filter);
+        body += (char)qos;
+        queuePacket(0x82, body);
+        return true;
+    }
+
+    bool publish(const char* topic, const char* payload, uint8_t qos) override {
+        if (phase != PHASE_UP) return false;
+        std::string body;
+        appendString(body, topic);
+        if (qos > 0) appendPacketId(body);
+        body += payload;
+        queuePacket(0x30 | (qos << 1), body);
+        return true;
+    }
+
+    void drop() override { fail(MQTT_FAIL_LOST); }
+
+private:
+    enum Phase : uint8_t { PHASE_DOWN, PHASE_TCP, PHASE_CONNACK, PHASE_UP };
+
+    BrokerAddress address;
+    int fd;
+    Phase phase;
+    MqttFailReason failReason;
+    uint64_t deadline;
+    uint64_t lastSent;
+    uint16_t nextPacketId;
+    std::string rx;
+    std::string tx;
+
+    void closeSocket() {
+        if (fd >= 0) close(fd);
+        fd = -1;
+    }
+
+    void fail(MqttFailReason reason) {
+        closeSocket();
+        phase = PHASE_DOWN;
+        failReason = reason;
+    }
+
+    /** Разрыв: во время ожидания CONNACK брокер отказал, после - соединение потеряно */
+    void lost() { fail(phase == PHASE_UP ? MQTT_FAIL_LOST : MQTT_FAIL_REFUSED); }
+
+    static void appendString(std::string& out, const char* text) {
+        size_t length = strlen(text);
+        out += (char)(length >> 8);
+        out += (char)(length & 0xFF);
+        out.append(text, length);
+    }
+
+    void appendPacketId(std::string& out) {
+        out += (char)(nextPacketId >> 8);
+        out += (char)(nextPacketId & 0xFF);
+        if (++nextPacketId == 0) nextPacketId = 1;
+    }
+
+    void queuePacket(uint8_t header, const std::string& body) {
+        tx += (char)header;
+        size_t length = body.size();
+        do {
+            uint8_t digit = length % 128;
+            length /= 128;
+            tx += (char)(length > 0 ? digit | 0x80 : digit);
+        } while (length > 0);
+        tx += body;
+    }
+
+    void flush(uint64_t now) {
+        while (!tx.empty() && fd >= 0) {
+            ssize_t sent = send(fd, tx.data(), tx.size(), MSG_NOSIGNAL);
+            if (sent < 0) {
+                if (errno != EAGAIN && errno != EWOULDBLOCK) lost();
+                return;
+            }
+            tx.erase(0, sent);
+            lastSent = now;
+        }
+    }
+
+    void receive() {
+        char chunk[RX_CHUNK];
+        for (;;) {
+            ssize_t got = recv(fd, chunk, sizeof(chunk), 0);
+            if (got > 0) {
+                rx.append(chunk, got);
+                continue;
+            }
+            if (got == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+                parse();               // Дочитать пришедшее до разрыва
+                lost();
+                return;
+            }
+            break;
+        }
+        parse();
+    }
+
+    void parse() {
+        for (;;) {
+            // Фиксированный заголовок: тип и длина остатка (до 4 байт по 7 бит)
+            size_t position = 1;
+            size_t length = 0;
+            int shift = 0;
+            for (;;) {
+                if (position >= rx.size()) return;
+                uint8_t digit = rx[position++];
+                length |= (size_t)(digit & 0x7F) << shift;
+                shift += 7;
+                if (!(digit & 0x80)) break;
+            }
+            if (rx.size() < position + length) return;
+
+            uint8_t header = rx[0];
+            std::string body = rx.substr(position, length);
+            rx.erase(0, position + length);
+            handlePacket(header, body);
+            if (phase == PHASE_DOWN) return;
+        }
+    }
+
+    void handlePacket(uint8_t header, const std::string& body) {
+        switch (header >> 4) {
+            case 2:                    // CONNACK
+                if (phase != PHASE_CONNACK) break;
+                if (body.size() >= 2 && body[1] == 0) phase = PHASE_UP;
+                else fail(MQTT_FAIL_REFUSED);
+                break;
+
+            case 3: {                  // PUBLISH
+                uint8_t qos = (header >> 1) & 3;
+                if (body.size() < 2) break;
+                size_t topicLength = ((uint8_t)body[0] << 8) | (uint8_t)body[1];
+                size_t offset = 2 + topicLength;
+                if (body.size() < offset + (qos ? 2 : 0)) break;
+                std::string topic = body.substr(2, topicLength);
+                if (qos > 0) {
+                    queuePacket(0x40, body.substr(offset, 2));         // PUBACK
+                    offset += 2;
+                }
+                deliver(topic.c_str(), (const uint8_t*)body.data() + offset,
+                        (unsigned int)(body.size() - offset));
+                break;
+            }
+
+            default:                   // PUBACK, SUBACK, PINGRESP
+                break;
+        }
+    }
+};
+
+// ==================== ЗАПУСК ====================
+static uint64_t monotonicMs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static bool parseFault(const char* name, SimBrokerFault& fault) {
+    static const struct { const char* name; SimBrokerFault fault; } faults[] = {
+        { "none", SIM_BROKER_OK }, { "refused", SIM_BROKER_REFUSED }, { "blackhole", SIM_BROKER_BLACKHOLE },
+        { "silent", SIM_BROKER_SILENT }, { "deny", SIM_BROKER_DENY },
+    };
+    for (const auto& entry : faults) {
+        if (strcmp(name, entry.name) == 0) {
+            fault = entry.fault;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void usage() {
+    fprintf(stderr, "использование: fleet_sim [--broker адрес] [--port N] [--user U --password P] [--root топик]\n"
+                    "  [--devices N] [--rate команд/с] [--repeat доля] [--drops в минуту] [--duration с]\n"
+                    "  [--seed N] [--shared-id] [--trace] [--virtual [--latency мс] [--fault вид]]\n");
+}
+
+int main(int argc, char** argv) {
+    FleetConfig config;
+    BrokerAddress address;
+    double duration = 60;
+    bool trace = false;
+    bool virtualBroker = false;
+    uint32_t latency = 5;
+    SimBrokerFault fault = SIM_BROKER_OK;
+    config.seed = (uint32_t)time(nullptr);
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool takesValue = true;
+        if (strcmp(arg, "--trace") == 0) { trace = true; takesValue = false; }
+        else if (strcmp(arg, "--virtual") == 0) { virtualBroker = true; takesValue = false; }
+        else if (strcmp(arg, "--shared-id") == 0) { config.sharedClientId = true; takesValue = false; }
+        else if (!value) { usage(); return 2; }
+        else if (strcmp(arg, "--broker") == 0) address.host = value;
+        else if (strcmp(arg, "--port") == 0) address.port = atoi(value);
+        else if (strcmp(arg, "--user") == 0) address.user = value;
+        else if (strcmp(arg, "--password") == 0) address.password = value;
+        else if (strcmp(arg, "--root") == 0) config.root = value;
+        else if (strcmp(arg, "--devices") == 0) config.devices = atoi(value);
+        else if (strcmp(arg, "--rate") == 0) config.rate = atof(value);
+        else if (strcmp(arg, "--repeat") == 0) config.repeat = atof(value);
+        else if (strcmp(arg, "--drops") == 0) config.drops = atof(value);
+        else if (strcmp(arg, "--duration") == 0) duration = atof(value);
+        else if (strcmp(arg, "--seed") == 0) config.seed = (uint32_t)strtoul(value, nullptr, 10);
+        else if (strcmp(arg, "--latency") == 0) latency = (uint32_t)atoi(value);
+        else if (strcmp(arg, "--fault") == 0) {
+            if (!parseFault(value, fault)) { usage(); return 2; }
+        }
+        else { usage(); return 2; }
+        if (takesValue) i++;
+    }
+    if (config.devices <= 0 || duration <= 0) {
+        usage();
+        return 2;
+    }
+
+    uint64_t end = (uint64_t)(duration * 1000);
+    SimBroker broker(latency);
+    FleetSim::LinkFactory factory;
+    if (virtualBroker) {
+        broker.setFault(fault);
+        factory = [&broker](int device) { return broker.createLink(device < 0); };
+    } else {
+        factory = [&address](int) { return std::unique_ptr<SimLink>(new TcpLink(address)); };
+    }
+
+    FleetSim fleet(config, factory);
+    if (virtualBroker) {
+        fleet.run(0, end);
+        if (fleet.getCommander()) fleet.getCommander()->stop();
+        fleet.run(end, end + DRAIN_MS);
+    } else {
+        // Шаг - по настоящим часам: задачи помп сами догоняют пропущенные сроки
+        uint64_t start = monotonicMs();
+        for (uint64_t now = 0; now < end + DRAIN_MS; now = monotonicMs() - start) {
+            if (now >= end && fleet.getCommander()) fleet.getCommander()->stop();
+            fleet.step(now);
+            usleep(1000);
+        }
+    }
+
+    if (trace) {
+        for (const SimAttempt& attempt : fleet.getStats().attempts) {
+            printf("attempt device=%d start=%llu end=%llu result=%s failures=%u delay=%u\n",
+                   attempt.device, (unsigned long long)attempt.start, (unsigned long long)attempt.end,
+                   mqttFailReasonName(attempt.result), (unsigned)attempt.failures,
+                   (unsigned)attempt.retryDelay);
+        }
+    }
+    fleet.printReport(stdout, duration);
+    return 0;
+}
@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+# файл: tools/load_test.py
+# Замер опоздания такта управления (jitter) под нагрузкой веба и MQTT
+#
+# Запуск (помпа в режиме ожидания, чайник можно не ставить):
+#     python3 tools/load_test.py 192.168.1.50 --user admin --password admin \
+#         --broker 192.168.1.10 --device pump-A1B2C3D4E5F6
+#
+# Для каждой фазы (покой, веб, MQTT, веб + MQTT) статистика задач
+# сбрасывается через /api/stats/reset, после нагрузки читается /api/status.
+# Итог - таблица максимального опоздания и промахов дедлайна по задачам.
+# Команды MQTT - "8" (СТОП): без налива они отклоняются, помпа не включается,
+# но каждая проходит разбор, очередь событий и публикацию подтверждения.
+# Для фазы MQTT нужен paho-mqtt (pip install paho-mqtt), без него она пропускается.
+
+import argparse
+import base64
+import json
+import sys
+import threading
+import time
+import urllib.request
+
+try:
+    import paho.mqtt.client as mqtt
+except ImportError:
+    mqtt = None
+
+
+class Device:
+    def __init__(self, host, user, password, timeout):
+        self.base = 'http://%s' % host
+        token = base64.b64encode(('%s:%s' % (user, password)).encode()).decode()
+        self.headers = {'Authorization': 'Basic ' + token}
+        self.timeout = timeout
+
+    def request(self, path, method='GET'):
+        req = urllib.request.Request(self.base + path, method=method, headers=self.headers)
+        with urllib.request.urlopen(req, timeout=self.timeout) as response:
+            return response.read()
+
+    def status(self):
+        return json.loads(self.request('/api/status'))
+
+    def reset_stats(self):
+        self.request('/api/stats/reset', method='POST')
+
+
+def web_load(device, stop, counters, lock):
+    # Опрос без ETag (каждый раз полный документ) и страницы дашборда
+    paths = ['/api/status', '/dashboard.html', '/script.js']
+    i = 0
+    while not stop.is_set():
+        try:
+            device.request(paths[i % len(paths)])
+            key = 'http_ok'
+        except Exception:
+            key = 'http_errors'
+        with lock:
+            counters[key] = counters.get(key, 0) + 1
+        i += 1
+
+
+def sse_load(device, stop, counters, lock):
+    # Подписчик /api/events: держит соединение и читает события
+    while not stop.is_set():
+        try:
+            req = urllib.request.Request(device.base + '/api/events', headers=device.headers)
+            with urllib.request.urlopen(req, timeout=device.timeout) as response:
+                while not stop.is_set():
+                    line = response.readline()
+                    if not line:
+                        break
+                    if line.startswith(b'data:'):
+                        with lock:
+                            counters['sse_events'] = counters.get('sse_events', 0) + 1
+        except Exception:
+            with lock:
+                counters['sse_errors'] = counters.get('sse_errors', 0) + 1
+            time.sleep(0.5)
+
+
+def mqtt_load(args, stop, counters, lock):
+    topic = '%s/%s/filling' % (args.root, args.device)
+    ack_topic = '%s/%s/ack' % (args.root, args.device)
+
+    def on_message(client, userdata, msg):
+        with lock:
+            counters['mqtt_acks'] = counters.get('mqtt_acks', 0) + 1
+
+    # paho-mqtt 2.x требует версию API обработчиков, 1.x ее не знает
+    if hasattr(mqtt, 'CallbackAPIVersion'):
+        client = mqtt.Client(mqtt.CallbackAPIVersion.VERSION1, client_id='smartpump-loadtest')
+    else:
+        client = mqtt.Client(client_id='smartpump-loadtest')
+    client.on_message = on_message
+    client.connect(args.broker, args.port)
+    client.subscribe(ack_topic, qos=0)
+    client.loop_start()
+
+    interval = 1.0 / args.mqtt_rate
+    next_send = time.monotonic()
+    while not stop.is_set():
+        client.publish(topic, '8', qos=1)
+        with lock:
+            counters['mqtt_sent'] = counters.get('mqtt_sent', 0) + 1
+        next_send += interval
+        delay = next_send - time.monotonic()
+        if delay > 0:
+            time.sleep(delay)
+
+    time.sleep(1.0)  # Дождаться последних подтверждений
+    client.loop_stop()
+    client.disconnect()
+
+
+def run_phase(name, device, args, web, use_mqtt):
+    device.reset_stats()
+    time.sleep(0.5)  # Сброс выполняется на следующем проходе планировщика
+
+    stop = threading.Event()
+    lock = threading.Lock()
+    counters = {}
+    threads = []
+    if web:
+        threads += [threading.Thread(target=web_load, args=(device, stop, counters, lock))
+                    for _ in range(args.http_clients)]
+        threads += [threading.Thread(target=sse_load, args=(device, stop, counters, lock))
+                    for _ in range(args.sse_clients)]
+    if use_mqtt:
+        threads.append(threading.Thread(target=mqtt_load, args=(args, stop, counters, lock)))
+
+    for t in threads:
+        t.daemon = True
+        t.start()
+    time.sleep(args.duration)
+    stop.set()
+    for t in threads:
+        t.join(timeout=device.timeout + 2)
+
+    tasks = device.status().get('tasks', [])
+    return name, tasks, counters
+
+
+def print_phase(name, tasks, counters, duration):
+    print('\n=== %s ===' % name)
+    if counters:
+        print('  нагрузка: ' + ', '.join('%s %d (%.1f/с)' % (k, v, v / duration)
+                                        for k, v in sorted(counters.items())))
+    print('  %-10s %4s %8s %10s %10s %8s' % ('задача', 'ядро', 'запусков', 'опозд. мкс', 'макс. мкс', 'промахи'))
+    for task in tasks:
+        print('  %-10s %4d %8d %10d %10d %8d' % (task['name'], task['core'], task['runs'],
+                                                  task['jitterUs'], task['maxUs'], task['misses']))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Опоздание такта управления под нагрузкой веба и MQTT')
+    parser.add_argument('host', help='IP или имя помпы')
+    parser.add_argument('--user', default='admin')
+    parser.add_argument('--password', default='admin')
+    parser.add_argument('--duration', type=float, default=30, help='длительность фазы (с)')
+    parser.add_argument('--http-clients', type=int, default=4, help='потоков опроса HTTP')
+    parser.add_argument('--sse-clients', type=int, default=2, help='подписчиков /api/events')
+    parser.add_argument('--broker', help='MQTT-брокер помпы (без него фаза MQTT пропускается)')
+    parser.add_argument('--port', type=int, default=1883)
+    parser.add_argument('--root', default='/devices', help='MQTT_TOPIC_ROOT')
+    parser.add_argument('--device', default='pump', help='имя устройства в топиках')
+    parser.add_argument('--mqtt-rate', type=float, default=20, help='команд MQTT в секунду')
+    parser.add_argument('--timeout', type=float, default=5)
+    args = parser.parse_args()
+
+    device = Device(args.host, args.user, args.password, args.timeout)
+    use_mqtt = args.broker is not None and mqtt is not None
+    if args.broker and mqtt is None:
+        print('paho-mqtt не установлен, фаза MQTT пропускается', file=sys.stderr)
+
+    phases = [('покой', False, False), ('веб', True, False)]
+    if use_mqtt:
+        phases += [('MQTT', False, True), ('веб + MQTT', True, True)]
+
+    control = {}
+    for name, web, with_mqtt in phases:
+        phase, tasks, counters = run_phase(name, device, args, web, with_mqtt)
+        print_phase(phase, tasks, counters, args.duration)
+        for task in tasks:
+            if task['name'] == 'control':
+                control[phase] = task
+
+    print('\n=== ТАКТ УПРАВЛЕНИЯ (ядро 1) ===')
+    for phase, task in control.items():
+        print('  %-12s опоздание до %6d мкс, промахов %d из %d' %
+              (phase, task['jitterUs'], task['misses'], task['runs']))
+
+
+if __name__ == '__main__':
+    main()